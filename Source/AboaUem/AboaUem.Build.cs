@@ -13,6 +13,7 @@ public class AboaUem : ModuleRules {
     PrivateDependencyModuleNames.AddRange(new string[] {
       "Core",
       "CoreUObject",
+      "DeveloperSettings",
       "Engine",
       "UMG"
     });
@@ -6,23 +6,126 @@
 
 #include "AboaUem.h"
 
+#include "aboa-s7.h"
+#include "AboaUemSettings.h"
+
+#include "Engine/World.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+
 IMPLEMENT_MODULE(FAboaUem, AboaUem)
 
+struct AboaUemGcDeferral {
+  s7_scheme * const s7session;
+  s7_int      const previousLimit;
+  AboaUemGcDeferral(s7_scheme * s7, s7_int const frameLimit)
+    : s7session(s7),
+      previousLimit(s7 ? s7_gc_defer(s7, 0) : 0) {
+    if (s7session)
+      s7_gc_defer(s7session, previousLimit > 0 ? previousLimit : frameLimit);
+      // ^ a nested deferral keeps the limit of the one it runs in
+  }
+  ~AboaUemGcDeferral() {
+    if (s7session)
+      s7_gc_defer(s7session, previousLimit);
+  }
+};
+  // ^ keeps allocation-triggered collections out of Aboa callbacks while
+  //   the heap has headroom left to grow into, tickFrame collects afterward
+
+auto FAboaUem::gcDeferLimit() -> int64 {
+  if (gcDeferFrameMutant != GFrameCounter) {
+    gcDeferFrameMutant = GFrameCounter;
+    auto const growth = GetDefault<UAboaUemSettings>()->GcDeferHeapGrowth;
+    gcDeferLimitMutant = growth > 1.0f
+      ? static_cast<int64>(growth * s7_integer(s7_let_field_ref(
+          sessionMutant->s7session,
+          s7_make_symbol(sessionMutant->s7session, "heap-size"))))
+      : 0;
+  }
+  return gcDeferLimitMutant;
+}
+
+static auto codeCacheDir() -> FString {
+  return GetDefault<UAboaUemSettings>()->bCacheCodeForms
+    ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AboaUE"), TEXT("Cache"))
+    : FString();
+}
+
 void FAboaUem::StartupModule() {
+  auto settings = GetDefault<UAboaUemSettings>();
   sessionMutant = std::make_unique<AboaUeMutant>(
-    bootAboaUe());
+    bootAboaUe({ settings->HeapInitialSize,
+                 settings->HeapGrowthFactor,
+                 settings->HeapMaxSize },
+               codeCacheDir(),
+               settings->bBootFromImage
+                 ? FPaths::Combine(FPaths::ProjectSavedDir(),
+                     TEXT("AboaUE"), TEXT("boot.image"))
+                 : FString()));
+  postActorTickMutant = FWorldDelegates::OnWorldPostActorTick.AddRaw(
+    this, &FAboaUem::tickFrame);
+  postLoadMapMutant = FCoreUObjectDelegates::PostLoadMapWithWorld.AddRaw(
+    this, &FAboaUem::levelLoaded);
 }
 
 void FAboaUem::ShutdownModule() {
-  if (sessionMutant->s7session)
+  FWorldDelegates::OnWorldPostActorTick.Remove(postActorTickMutant);
+  FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(postLoadMapMutant);
+  if (sessionMutant->s7session) {
+    shutdownAboaUe(*sessionMutant);
     s7_free(sessionMutant->s7session);
+  }
+}
+
+auto FAboaUem::tickFrame(
+  UWorld *    world,
+  ELevelTick  tickType,
+  float       deltaSeconds
+) -> void {
+  if (!sessionMutant->s7session || lastFrameTickedMutant == GFrameCounter)
+    return; // !!! the editor ticks more than one world per frame
+  lastFrameTickedMutant = GFrameCounter;
+  auto settings = GetDefault<UAboaUemSettings>();
+  {
+    AboaUemGcDeferral deferral(sessionMutant->s7session, gcDeferLimit());
+    dispatchAboaUeInput(*sessionMutant, settings->CallStepBudget);
+    dispatchAboaUeEvents(*sessionMutant, settings->CallStepBudget);
+    dispatchAboaUeTimers(*sessionMutant, deltaSeconds, settings->CallStepBudget);
+    dispatchAboaUeTasks(*sessionMutant, deltaSeconds, settings->CallStepBudget);
+  }
+  auto const collected =
+    s7_gc_maybe_collect(sessionMutant->s7session,
+                        settings->GcCollectFreeFraction)
+    || s7_gc_sweep_step(sessionMutant->s7session,
+                        settings->GcSweepBudgetMicroseconds);
+    // ^ after all of this frame's Aboa calls, never during one
+  if (collected && settings->bReleaseEmptySlabsAfterGc)
+    releaseAboaUeSlabs(*sessionMutant);
+}
+
+auto FAboaUem::levelLoaded(
+  UWorld *    world
+) -> void {
+  auto settings = GetDefault<UAboaUemSettings>();
+  if (sessionMutant->s7session && settings->bHeapShrinkAfterLevelLoad) {
+    s7_gc_shrink_heap(sessionMutant->s7session, settings->HeapInitialSize);
+      // ^ best effort, a block is kept while any cell in it is still live
+    if (settings->bReleaseEmptySlabsAfterGc)
+      releaseAboaUeSlabs(*sessionMutant);
+  }
 }
 
 auto FAboaUem::callCode( // declaration in aboa-ue.h
   FString         const & callee,
   AboaUeDataDict  const & args
 ) -> AboaUeDataDict {
-  return callAboaUeCode(*sessionMutant, callee, args);
+  if (!sessionMutant->s7session)
+    return AboaUeDataDict();
+  AboaUemGcDeferral deferral(sessionMutant->s7session, gcDeferLimit());
+  auto settings = GetDefault<UAboaUemSettings>();
+  return callAboaUeCode(*sessionMutant, callee, args,
+    { settings->CallErrorLimit, settings->CallStepBudget });
 }
 
 auto FAboaUem::runCodeAtPath(
@@ -33,11 +136,13 @@ auto FAboaUem::runCodeAtPath(
 ) -> AboaUeDataDict {
   auto codeiter = codeCacheMutant.find(path);
   if (codeiter == codeCacheMutant.end() || forceReload) {
-    auto code = loadAboaUeCode(path);
+    auto code = loadAboaUeCode(path, codeCacheDir());
     if (codeiter != codeCacheMutant.end())
       codeCacheMutant.erase(codeiter);
     codeCacheMutant.emplace(
-      std::make_pair(path, code)); // TODO: $$$ OPTIMIZE COPIES
+      std::make_pair(path, code)); // shares the source buffer
+    resetAboaUeCallErrors(*sessionMutant);
+      // ^ the reload may have fixed whatever suspended a callee
     return runAboaUeCode(*sessionMutant, code, callee, args);
   } else
     return runAboaUeCode(*sessionMutant, codeiter->second, callee, args);
@@ -10,8 +10,11 @@
 
 #include <memory>
 
+#include <Engine/EngineBaseTypes.h>
 #include <Modules/ModuleInterface.h>
 
+class UWorld;
+
 class FAboaUem : public IModuleInterface {
 public:
   virtual void StartupModule()  override;
@@ -31,6 +34,27 @@ public:
     // ^ caches and auto-loads observed file changes
 
 private:
+  auto tickFrame(
+    UWorld *    world,
+    ELevelTick  tickType,
+    float       deltaSeconds
+  ) -> void;
+    // ^ called after each world tick, does its work once per frame
+
+  auto levelLoaded(
+    UWorld *    world
+  ) -> void;
+    // ^ gives the heap blocks the previous level emptied back to the OS
+
+  auto gcDeferLimit() -> int64;
+    // ^ GcDeferHeapGrowth times the heap size at the first Aboa call of the
+    //   frame, so all of a frame's calls together grow the heap once at most
+
   std::unique_ptr<AboaUeMutant> sessionMutant;
   std::map<FString, AboaUeCode> codeCacheMutant;
+  FDelegateHandle               postActorTickMutant;
+  FDelegateHandle               postLoadMapMutant;
+  uint64                        lastFrameTickedMutant = 0;
+  uint64                        gcDeferFrameMutant = MAX_uint64;
+  int64                         gcDeferLimitMutant = 0;
 };
@@ -0,0 +1,78 @@
+// Copyright © 2025 Christopher Augustus
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "aboa-ue-helper.h"
+
+#include "aboa-s7.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace aot_sample {
+  auto define(s7_scheme * const s7) -> void;
+} // ^ in aot-sample.cpp, generated from Source/aboa/tests/sample.aboa
+
+static auto const aotSampleChecks = R"ABOA(
+  (map (> (check) (catch $t check (> (type . info) (list 'error type))))
+    (list (> () (fib 10)) (> () (fib 10.0)) (> () (fib 20))
+          (> () (clampit -5)) (> () (clampit 5)) (> () (clampit 50))
+          (> () (clampit 2.5)) (> () (clampit -1.5)) (> () (clampit 1/2))
+          (> () (half 3)) (> () (half 4)) (> () (half 3.0)) (> () (half 1/3))
+          (> () (scaled 3)) (> () (scaled 3/2))
+          (> () (mean 1 2)) (> () (mean 1.0 2))
+          (> () (mean 9223372036854775807 1))
+          (> () (root 4)) (> () (root 2)) (> () (root 9/4)) (> () (root -4))
+          (> () (larger 1 2.0)) (> () (larger 3 2))
+          (> () (steps 0)) (> () (steps 5))
+          (> () (count-even 10))
+          (> () (sign -3)) (> () (sign 0)) (> () (sign 2.5))
+          (> () (dot (float-vector 1 2 3) (float-vector 4 5 6)))
+          (> () (scale! (float-vector 1 2) 3))
+          (> () (scale! (float-vector 1 2) 1/2))
+          (> () (ratio-sum 2000))
+          (> () limit) (> () rate)
+          (> () (fib 'a)) (> () (half "x")) (> () (dot (float-vector 1) (float-vector)))
+          (> () (clampit)) (> () (scale! (float-vector 1) 'k))))
+)ABOA";
+  // ^ errors compare by their type, ratio-sum makes enough garbage
+  //   for collections to run in the middle of compiled code
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAboaUeAotTest,
+  "AboaUE.Aot.CompiledMatchesInterpreted",
+  EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+auto FAboaUeAotTest::RunTest(FString const & parameters) -> bool {
+  auto const s7 = s7_init();
+  aot_sample::define(s7);
+  auto const compiled = s7_eval_c_string(s7, aotSampleChecks);
+  auto const compiledLoc = s7_gc_protect(s7, compiled);
+  auto const path = PluginSubpath(TEXT("AboaUE"), TEXT("Source/aboa/tests/sample.aboa"));
+  if (!s7_load(s7, TCHAR_TO_UTF8(*path)))
+    AddError(FString::Printf(TEXT("Failed to load %s"), *path));
+    // ^ redefines every name as the interpreted closure
+  else {
+    auto const interpreted = s7_eval_c_string(s7, aotSampleChecks);
+    auto mutC = compiled;
+    auto mutI = interpreted;
+    for (; s7_is_pair(mutC) && s7_is_pair(mutI);
+           mutC = s7_cdr(mutC), mutI = s7_cdr(mutI))
+      if (!s7_is_equal(s7, s7_car(mutC), s7_car(mutI))) {
+        auto const c = s7_object_to_c_string(s7, s7_car(mutC));
+        auto const i = s7_object_to_c_string(s7, s7_car(mutI));
+        AddError(FString::Printf(TEXT("compiled %s is not equal? to interpreted %s"),
+          UTF8_TO_TCHAR(c), UTF8_TO_TCHAR(i)));
+        free(c);
+        free(i);
+      }
+    TestTrue(TEXT("as many results"), !s7_is_pair(mutC) && !s7_is_pair(mutI));
+  }
+  s7_gc_unprotect_at(s7, compiledLoc);
+  s7_free(s7);
+  return !HasAnyErrors();
+}
+
+#endif
@@ -0,0 +1,86 @@
+// Copyright © 2025 Christopher Augustus
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "aboa-s7.h"
+
+#include "Async/Async.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+static auto const sessionsWork = R"ABOA(
+  (begin
+    (= (fib n) (? (<< n 2) n (+ (fib (- n 1)) (fib (- n 2)))))
+    (= ht (make-hash-table))
+    (do ((i 0 (+ i 1))) ((== i 2000)) (=> (ht (number->string i)) (* i 1.5)))
+    (= g (gensym))
+    (= sv (subvector (make-vector 20 g) 2 12))
+    (= sf (subvector (make-float-vector 20 1.0) 0 10))
+    (= sb (subvector (make-byte-vector 20 7) 0 10))
+    (= op (open-output-function (> (c) c)))
+    (write-char $\z op)
+    (= s 0)
+    (do ((k 0 (+ k 1))) ((== k 50))
+      (=> s (+ s (length (format $f "~A ~S" (list k 1.5 "x" $\a) (ht "17"))))))
+    (list (fib 20) (ht "1999") (length sv) (sf 3) (sb 3) (symbol? (sv 0))
+          (star) (star 4) s (string->symbol (format $f "sym~D" 42)))))ABOA";
+// ^ touches every cell type whose marking once depended on what any session
+//   had made so far (gensyms, subvectors, output function ports, define*)
+
+static auto const sessionsExpected =
+  TEXT("(6765 2998.5 10 1.0 7 $t 3 4 1040 sym42)");
+// ^ written out, not computed by a first session, so no session runs the
+//   work before the threads race on it
+
+static auto sessionsStar(s7_scheme * const s7, s7_pointer const args) -> s7_pointer {
+  return s7_car(args);
+}
+
+static auto runSessionsWork() -> FString {
+  auto const s7 = s7_init();
+  s7_define_function_star(s7, "star", sessionsStar, "(a (+ 1 2))", "");
+  auto const result = s7_object_to_c_string(s7, s7_eval_c_string(s7, sessionsWork));
+  FString const mutText = UTF8_TO_TCHAR(result);
+  free(result);
+  s7_free(s7);
+  return mutText;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAboaUeSessionsTest,
+  "AboaUE.Sessions.ConcurrentBootAndRun",
+  EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+auto FAboaUeSessionsTest::RunTest(FString const & parameters) -> bool {
+  constexpr int32 sessionCount = 16;
+  constexpr int32 roundCount = 4;
+  auto const start = FPlatformProcess::GetSynchEventFromPool(true);
+  TArray<TFuture<TArray<FString>>> mutSessions;
+  for (int32 s = 0; s < sessionCount; ++s)
+    mutSessions.Add(Async(EAsyncExecution::Thread, [start] {
+      start->Wait();
+      TArray<FString> mutResults;
+      for (int32 r = 0; r < roundCount; ++r)
+        mutResults.Add(runSessionsWork());
+      return mutResults;
+    }));
+  start->Trigger();
+    // ^ every thread boots its first session at once
+  for (auto & mutSession : mutSessions)
+    for (auto const & result : mutSession.Get())
+      if (result != sessionsExpected)
+        AddError(FString::Printf(TEXT("session gave %s, expected %s"),
+          *result, sessionsExpected));
+  FPlatformProcess::ReturnSynchEventToPool(start);
+  return !HasAnyErrors();
+}
+// ^ each session boots, collects and frees on its own thread while the others
+//   run; build with TSan to catch races on tables shared between sessions.
+//   The module's own session has filled the process-wide tables by the time
+//   any test runs, the threads race on everything a session does after that
+
+#endif
@@ -0,0 +1,99 @@
+// Copyright © 2025 Christopher Augustus
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "aboa-s7.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+static auto const stepBudgetWork = R"ABOA(
+  (begin
+    (= (body i) (= x (* i 2)) (=> x (+ x 1)) x)
+    (= (run) (@ loop ((i 0) (s 0)) (? (== i 2000000) s (loop (+ i 1) (+ s (body i))))))
+    (run)))ABOA";
+// ^ a body with a block per pass, so begin_hook runs as often as it can
+
+static auto constexpr stepBudgetPasses = 2000000;
+static auto constexpr stepBudgetStepsPerPass = 8;
+  // ^ it takes 7, each form counted once; it took 13 when every op of the
+  //   eval loop counted, with the ops that return to a form already counted
+
+static int64 mutBeginHookCalls = 0;
+
+static auto countBeginHook(s7_scheme * const, bool * const stop) -> void {
+  ++mutBeginHookCalls;
+  *stop = false;
+}
+
+static auto budgetErrorType(s7_scheme * const s7, s7_pointer const args) -> s7_pointer {
+  return s7_car(args);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAboaUeStepBudgetBench,
+  "AboaUE.StepBudget.CostVersusBeginHook",
+  EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+auto FAboaUeStepBudgetBench::RunTest(FString const & parameters) -> bool {
+  constexpr int32 runCount = 5;
+  constexpr s7_int unspentBudget = 1000000000000;
+  auto const s7 = s7_init();
+  auto const bestOf = [&](auto const & arm, auto const & disarm) -> double {
+    auto mutBest = 1.0e9;
+    for (int32 r = 0; r < runCount; ++r) {
+      arm();
+      auto const start = FPlatformTime::Seconds();
+      auto const result = s7_eval_c_string(s7, stepBudgetWork);
+      mutBest = FMath::Min(mutBest, FPlatformTime::Seconds() - start);
+      disarm();
+      TestEqual(TEXT("the work gives the same result"), s7_integer(result), s7_int(4000000000000));
+    }
+    return mutBest;
+  };
+  auto const unlimited = bestOf([] {}, [] {});
+  auto mutSteps = s7_int(0);
+  auto const budgeted = bestOf(
+    [s7] { s7_set_step_budget(s7, unspentBudget); },
+    [s7, &mutSteps] { mutSteps = unspentBudget - s7_set_step_budget(s7, 0); });
+  auto const hooked = bestOf(
+    [s7] { mutBeginHookCalls = 0; s7_set_begin_hook(s7, countBeginHook); },
+    [s7] { s7_set_begin_hook(s7, nullptr); });
+  AddInfo(FString::Printf(
+    TEXT("unlimited %.1f ms, step budget %.1f ms for %lld steps, begin_hook %.1f ms for %lld calls"),
+    unlimited * 1000.0, budgeted * 1000.0, static_cast<long long>(mutSteps),
+    hooked * 1000.0, static_cast<long long>(mutBeginHookCalls)));
+  TestTrue(TEXT("the budget counts every step the hook sees"), mutSteps >= mutBeginHookCalls);
+  TestTrue(TEXT("the budget counts each form once"),
+    mutSteps <= s7_int(stepBudgetPasses) * stepBudgetStepsPerPass);
+  TestTrue(TEXT("the budget costs no more than a begin_hook that only counts"),
+    budgeted <= hooked);
+
+  auto const loop = s7_eval_c_string(s7, "(> () (do ((i 0 (+ i 1))) ((<< i 0) i)))");
+  auto const loopLoc = s7_gc_protect(s7, loop);
+  auto const handler = s7_make_function(s7, "budget-error-type", budgetErrorType,
+    2, 0, false, "returns the type of the error it catches");
+  auto const handlerLoc = s7_gc_protect(s7, handler);
+  mutBeginHookCalls = 0;
+  s7_set_begin_hook(s7, countBeginHook);
+  s7_set_step_budget(s7, 1000000);
+  auto const stopped = s7_call_with_catch(s7, s7_t(s7), loop, handler);
+  s7_set_step_budget(s7, 0);
+  s7_set_begin_hook(s7, nullptr);
+  AddInfo(FString::Printf(TEXT("a do loop run in C called begin_hook %lld times before the budget stopped it"),
+    static_cast<long long>(mutBeginHookCalls)));
+  TestTrue(TEXT("the budget stops a loop run in C"),
+    s7_is_symbol(stopped) && FCStringAnsi::Strcmp(s7_symbol_name(stopped), "budget-exceeded") == 0);
+  s7_gc_unprotect_at(s7, handlerLoc);
+  s7_gc_unprotect_at(s7, loopLoc);
+  s7_free(s7);
+  return !HasAnyErrors();
+}
+// ^ the budget is counted whether or not one is armed, so unlimited and
+//   budgeted time the same build; begin_hook only runs at the start of a
+//   block and never inside the loops s7 runs in C
+
+#endif
@@ -0,0 +1,189 @@
+// generated by Source/aboa/aot.aboa from sample.aboa,
+// edit that and regenerate instead of editing this
+
+#include "aboa-ue.h"
+
+#include "aboa-ue-aot.h"
+
+namespace aot_sample {
+
+constexpr s7_int k_limit = 10;
+constexpr s7_double k_rate = 0.5;
+
+auto aot_fib(s7_scheme * const s7, s7_pointer p_n) -> s7_pointer;
+auto aot_clampit(s7_scheme * const s7, s7_pointer p_x) -> s7_pointer;
+auto aot_half(s7_scheme * const s7, s7_pointer p_x) -> s7_pointer;
+auto aot_scaled(s7_scheme * const s7, s7_pointer p_x) -> s7_pointer;
+auto aot_mean(s7_scheme * const s7, s7_pointer p_a, s7_pointer p_b) -> s7_pointer;
+auto aot_root(s7_scheme * const s7, s7_pointer p_x) -> s7_pointer;
+auto aot_larger(s7_scheme * const s7, s7_pointer p_a, s7_pointer p_b) -> s7_pointer;
+auto aot_steps(s7_scheme * const s7, s7_pointer p_n) -> s7_pointer;
+auto aot_count_even(s7_scheme * const s7, s7_pointer p_n) -> s7_int;
+auto aot_sign(s7_scheme * const s7, s7_pointer p_x) -> s7_int;
+auto aot_dot(s7_scheme * const s7, s7_pointer p_a, s7_pointer p_b) -> s7_double;
+auto aot_scale_21_(s7_scheme * const s7, s7_pointer p_v, s7_pointer p_k) -> s7_pointer;
+auto aot_ratio_sum(s7_scheme * const s7, s7_pointer p_n) -> s7_pointer;
+
+auto aot_fib(s7_scheme * const s7, s7_pointer p_n) -> s7_pointer {
+  aotRootFrame const roots(s7);
+  return (aotCompare(s7, "<<", p_n, 2, std::less<>()) ? p_n : aotRoot(s7, aotAdd(s7, aotRoot(s7, aot_fib(s7, aotRoot(s7, aotSubtract(s7, p_n, 1)))), aotRoot(s7, aot_fib(s7, aotRoot(s7, aotSubtract(s7, p_n, 2)))))));
+}
+
+auto aot_clampit(s7_scheme * const s7, s7_pointer p_x) -> s7_pointer {
+  aotRootFrame const roots(s7);
+  return (aotCompare(s7, "<<", p_x, 0, std::less<>()) ? aotRoot(s7, s7_make_integer(s7, 0)) : (aotCompare(s7, ">>", p_x, k_limit, std::greater<>()) ? aotRoot(s7, s7_make_integer(s7, k_limit)) : p_x));
+}
+
+auto aot_half(s7_scheme * const s7, s7_pointer p_x) -> s7_pointer {
+  aotRootFrame const roots(s7);
+  return aotRoot(s7, aotCall(s7, "/", {p_x, aotRoot(s7, s7_make_integer(s7, 2))}));
+}
+
+auto aot_scaled(s7_scheme * const s7, s7_pointer p_x) -> s7_pointer {
+  aotRootFrame const roots(s7);
+  return aotRoot(s7, aotMultiply(s7, p_x, k_rate));
+}
+
+auto aot_mean(s7_scheme * const s7, s7_pointer p_a, s7_pointer p_b) -> s7_pointer {
+  aotRootFrame const roots(s7);
+  return aotRoot(s7, aotCall(s7, "/", {aotRoot(s7, aotAdd(s7, p_a, p_b)), aotRoot(s7, s7_make_integer(s7, 2))}));
+}
+
+auto aot_root(s7_scheme * const s7, s7_pointer p_x) -> s7_pointer {
+  aotRootFrame const roots(s7);
+  return aotRoot(s7, aotCall(s7, "sqrt", {p_x}));
+}
+
+auto aot_larger(s7_scheme * const s7, s7_pointer p_a, s7_pointer p_b) -> s7_pointer {
+  aotRootFrame const roots(s7);
+  return aotRoot(s7, aotCall(s7, "max", {p_a, p_b}));
+}
+
+auto aot_steps(s7_scheme * const s7, s7_pointer p_n) -> s7_pointer {
+  aotRootFrame const roots(s7);
+  return [&]() -> s7_pointer { s7_int l_i_1 = 0; s7_pointer l_acc_2 = aotRoot(s7, s7_make_integer(s7, 0)); for (;;) { aotRootFrame const pass(s7); aotRoot(s7, l_acc_2); aotRoot(s7, p_n); if (aotCompare(s7, "==", l_i_1, p_n, std::equal_to<>())) break; { s7_int const nl_i_1 = (l_i_1 + 1); s7_pointer const nl_acc_2 = aotRoot(s7, aotAdd(s7, l_acc_2, aotRoot(s7, aotCall(s7, "/", {aotRoot(s7, s7_make_integer(s7, 1)), aotRoot(s7, s7_make_integer(s7, (l_i_1 + 1)))})))); l_i_1 = nl_i_1; l_acc_2 = nl_acc_2; } } aotRoot(s7, l_acc_2); aotRoot(s7, p_n); return l_acc_2; }();
+}
+
+auto aot_count_even(s7_scheme * const s7, s7_pointer p_n) -> s7_int {
+  return [&]() -> s7_int { s7_int l_found_1 = 0; return [&]() -> s7_int { s7_int l_i_2 = 0; while (!aotCompare(s7, "==", l_i_2, p_n, std::equal_to<>())) { if ((l_i_2 % 2 == 0)) { (void)((l_found_1 = (l_found_1 + 1))); } { s7_int const nl_i_2 = (l_i_2 + 1); l_i_2 = nl_i_2; } } return l_found_1; }(); }();
+}
+
+auto aot_sign(s7_scheme * const s7, s7_pointer p_x) -> s7_int {
+  return (aotCompare(s7, "<<", p_x, 0, std::less<>()) ? -1 : (aotCompare(s7, "==", p_x, 0, std::equal_to<>()) ? 0 : 1));
+}
+
+auto aot_dot(s7_scheme * const s7, s7_pointer p_a, s7_pointer p_b) -> s7_double {
+  return [&]() -> s7_double { s7_int l_i_1 = 0; s7_double l_sum_2 = 0.0; while (!(l_i_1 == s7_vector_length(p_a))) { { s7_int const nl_i_1 = (l_i_1 + 1); s7_double const nl_sum_2 = (l_sum_2 + (aotFloatVectorRef(s7, "dot", p_a, l_i_1) * aotFloatVectorRef(s7, "dot", p_b, l_i_1))); l_i_1 = nl_i_1; l_sum_2 = nl_sum_2; } } return l_sum_2; }();
+}
+
+auto aot_scale_21_(s7_scheme * const s7, s7_pointer p_v, s7_pointer p_k) -> s7_pointer {
+  aotRootFrame const roots(s7);
+  return [&]() -> s7_pointer { s7_int l_i_1 = 0; for (;;) { aotRootFrame const pass(s7); aotRoot(s7, p_k); if ((l_i_1 == s7_vector_length(p_v))) break; (void)(aotFloatVectorSet(s7, "scale!", p_v, l_i_1, aotReal(s7, "scale!", aotRoot(s7, aotMultiply(s7, aotFloatVectorRef(s7, "scale!", p_v, l_i_1), p_k))))); { s7_int const nl_i_1 = (l_i_1 + 1); l_i_1 = nl_i_1; } } aotRoot(s7, p_k); return p_v; }();
+}
+
+auto aot_ratio_sum(s7_scheme * const s7, s7_pointer p_n) -> s7_pointer {
+  aotRootFrame const roots(s7);
+  return [&]() -> s7_pointer { s7_int l_i_1 = 1; s7_pointer l_acc_2 = aotRoot(s7, s7_make_integer(s7, 0)); for (;;) { aotRootFrame const pass(s7); aotRoot(s7, l_acc_2); aotRoot(s7, p_n); if (aotCompare(s7, ">>", l_i_1, p_n, std::greater<>())) break; { s7_int const nl_i_1 = (l_i_1 + 1); s7_pointer const nl_acc_2 = aotRoot(s7, aotAdd(s7, l_acc_2, aotRoot(s7, aotCall(s7, "/", {aotRoot(s7, s7_make_integer(s7, l_i_1)), aotRoot(s7, s7_make_integer(s7, (l_i_1 + 1)))})))); l_i_1 = nl_i_1; l_acc_2 = nl_acc_2; } } aotRoot(s7, l_acc_2); aotRoot(s7, p_n); return l_acc_2; }();
+}
+
+auto s7_fib(s7_scheme * const s7, s7_pointer const args) -> s7_pointer {
+  return aot_fib(s7,
+    aotArg(args, 1));
+}
+
+auto s7_clampit(s7_scheme * const s7, s7_pointer const args) -> s7_pointer {
+  return aot_clampit(s7,
+    aotArg(args, 1));
+}
+
+auto s7_half(s7_scheme * const s7, s7_pointer const args) -> s7_pointer {
+  return aot_half(s7,
+    aotArg(args, 1));
+}
+
+auto s7_scaled(s7_scheme * const s7, s7_pointer const args) -> s7_pointer {
+  return aot_scaled(s7,
+    aotArg(args, 1));
+}
+
+auto s7_mean(s7_scheme * const s7, s7_pointer const args) -> s7_pointer {
+  return aot_mean(s7,
+    aotArg(args, 1),
+    aotArg(args, 2));
+}
+
+auto s7_root(s7_scheme * const s7, s7_pointer const args) -> s7_pointer {
+  return aot_root(s7,
+    aotArg(args, 1));
+}
+
+auto s7_larger(s7_scheme * const s7, s7_pointer const args) -> s7_pointer {
+  return aot_larger(s7,
+    aotArg(args, 1),
+    aotArg(args, 2));
+}
+
+auto s7_steps(s7_scheme * const s7, s7_pointer const args) -> s7_pointer {
+  return aot_steps(s7,
+    aotArg(args, 1));
+}
+
+auto s7_count_even(s7_scheme * const s7, s7_pointer const args) -> s7_pointer {
+  return s7_make_integer(s7, aot_count_even(s7,
+    aotArg(args, 1)));
+}
+
+auto s7_sign(s7_scheme * const s7, s7_pointer const args) -> s7_pointer {
+  return s7_make_integer(s7, aot_sign(s7,
+    aotArg(args, 1)));
+}
+
+auto s7_dot(s7_scheme * const s7, s7_pointer const args) -> s7_pointer {
+  return s7_make_real(s7, aot_dot(s7,
+    aotFloatVectorArg(s7, "dot", args, 1),
+    aotFloatVectorArg(s7, "dot", args, 2)));
+}
+
+auto s7_scale_21_(s7_scheme * const s7, s7_pointer const args) -> s7_pointer {
+  return aot_scale_21_(s7,
+    aotFloatVectorArg(s7, "scale!", args, 1),
+    aotArg(args, 2));
+}
+
+auto s7_ratio_sum(s7_scheme * const s7, s7_pointer const args) -> s7_pointer {
+  return aot_ratio_sum(s7,
+    aotArg(args, 1));
+}
+
+auto define(s7_scheme * const s7) -> void {
+  s7_define_variable(s7, "limit", s7_make_integer(s7, k_limit));
+  s7_define_variable(s7, "rate", s7_make_real(s7, k_rate));
+  s7_define_function(s7, "fib", s7_fib, 1, 0, false,
+    "(fib n) compiled from sample.aboa");
+  s7_define_function(s7, "clampit", s7_clampit, 1, 0, false,
+    "(clampit x) compiled from sample.aboa");
+  s7_define_function(s7, "half", s7_half, 1, 0, false,
+    "(half x) compiled from sample.aboa");
+  s7_define_function(s7, "scaled", s7_scaled, 1, 0, false,
+    "(scaled x) compiled from sample.aboa");
+  s7_define_function(s7, "mean", s7_mean, 2, 0, false,
+    "(mean a b) compiled from sample.aboa");
+  s7_define_function(s7, "root", s7_root, 1, 0, false,
+    "(root x) compiled from sample.aboa");
+  s7_define_function(s7, "larger", s7_larger, 2, 0, false,
+    "(larger a b) compiled from sample.aboa");
+  s7_define_function(s7, "steps", s7_steps, 1, 0, false,
+    "(steps n) compiled from sample.aboa");
+  s7_define_function(s7, "count-even", s7_count_even, 1, 0, false,
+    "(count-even n) compiled from sample.aboa");
+  s7_define_function(s7, "sign", s7_sign, 1, 0, false,
+    "(sign x) compiled from sample.aboa");
+  s7_define_function(s7, "dot", s7_dot, 2, 0, false,
+    "(dot a b) compiled from sample.aboa");
+  s7_define_function(s7, "scale!", s7_scale_21_, 2, 0, false,
+    "(scale! v k) compiled from sample.aboa");
+  s7_define_function(s7, "ratio-sum", s7_ratio_sum, 1, 0, false,
+    "(ratio-sum n) compiled from sample.aboa");
+}
+
+} // namespace aot_sample
@@ -154,9 +154,10 @@
  */
 
 #ifndef SYMBOL_TABLE_SIZE
-  #define SYMBOL_TABLE_SIZE 32749
+  #define SYMBOL_TABLE_SIZE 8192
 #endif
-/* names are hashed into the symbol table (a vector) and collisions are chained as lists */
+/* [c4augustus] initial size (a power of 2) of the open-addressed symbol table, it doubles once half full */
+/* was: names are hashed into the symbol table (a vector) and collisions are chained as lists */
 /* 16381: thash +80 [string_to_symbol_p_p] +40 if 24001, tlet +80 [symbol_p_p], +32 24001 */
 
 #ifndef INITIAL_STACK_SIZE
@@ -179,6 +180,16 @@
  *    might be vulnerable to the GC.
  */
 
+#ifndef GC_SWEEP_START_FRACTION
+  #define GC_SWEEP_START_FRACTION 0.5
+#endif
+/* [c4augustus] s7_gc_sweep_step starts a cycle (a whole mark, then a stepped sweep) once less than this fraction of the heap is free */
+
+#ifndef GC_SWEEP_CHUNK_SIZE
+  #define GC_SWEEP_CHUNK_SIZE 4096
+#endif
+/* [c4augustus] heap cells swept by s7_gc_sweep_step between checks of its time budget */
+
 
 /* ---------------- scheme choices ---------------- */
 
@@ -398,6 +409,8 @@
 
 #if (!MS_WINDOWS)
   #include <pthread.h>
+#else
+  #include <malloc.h> /* [c4augustus] _aligned_malloc */
 #endif
 
 #if __cplusplus
@@ -550,13 +563,17 @@ typedef struct block_t {
 #define block_next(p)                    p->nx.next
 #define block_info(p)                    p->ex.ex_info
 
-typedef block_t hash_entry_t; /* I think this means we waste 8 bytes per entry but can use the mallocate functions */
-#define hash_entry_key(p)                p->dx.d_ptr
-#define hash_entry_value(p)              (p)->ex.ex_ptr
-#define hash_entry_set_value(p, Val)     p->ex.ex_ptr = Val
-#define hash_entry_next(p)               block_next(p)
-#define hash_entry_raw_hash(p)           block_size(p)
-#define hash_entry_set_raw_hash(p, Hash) block_set_size(p, Hash)
+typedef struct {                   /* [c4augustus] hash-table slot, the elements are one flat array of these (was a block_t chain per bin) */
+  s7_pointer key, value;           /*   key NULL: the slot is unused (value NULL) or its entry was removed (value not NULL) */
+  s7_int raw_hash;
+} hash_entry_t;
+#define hash_entry_key(p)                (p)->key
+#define hash_entry_value(p)              (p)->value
+#define hash_entry_set_value(p, Val)     (p)->value = Val
+#define hash_entry_raw_hash(p)           (p)->raw_hash
+#define hash_entry_set_raw_hash(p, Hash) (p)->raw_hash = Hash
+#define hash_entry_is_live(p)            ((p)->key != NULL)
+#define hash_entry_is_unused(p)          (((p)->key == NULL) && ((p)->value == NULL))
 
 typedef block_t vdims_t;
 #define vdims_rank(p)                    p->size
@@ -881,7 +898,7 @@ typedef struct s7_cell {
 
     struct {                        /* hash-tables */
       s7_int mask;
-      hash_entry_t **elements;      /* a pointer into block below: takes up a field in object.hasher but is faster (50 in thash) */
+      hash_entry_t *elements;       /* a pointer into block below: takes up a field in object.hasher but is faster (50 in thash) */
       hash_check_t hash_func;
       hash_map_t *loc;
       block_t *block;
@@ -896,7 +913,6 @@ typedef struct s7_cell {
       union {
 	s7_int len;
 	s7_pointer slow;
-	hash_entry_t *hcur;
       } lw;
       s7_pointer (*next)(s7_scheme *sc, s7_pointer iterator);
     } iter;
@@ -1073,6 +1089,10 @@ typedef struct {
   s7_pointer args, orig_str, curly_arg, port, strport;
 } format_data_t;
 
+typedef enum {FORMAT_OP_TEXT, FORMAT_OP_NEWLINE, FORMAT_OP_DISPLAY, FORMAT_OP_WRITE, FORMAT_OP_INTEGER} format_op_kind_t; // [c4augustus]
+typedef struct {format_op_kind_t kind; s7_int start, len;} format_op_t;
+typedef struct {s7_pointer str; s7_int len, num_ops, num_args, running; format_op_t *ops; char *text; block_t *block;} format_program_t;
+
 typedef struct gc_obj_t {
   s7_pointer p;
   struct gc_obj_t *nxt;
@@ -1089,6 +1109,11 @@ typedef struct {
   s7_int *timing_data, *excl, *lines;
 } profile_data_t;
 
+typedef struct {                      /* [c4augustus] one open-addressed symbol table slot */
+  uint64_t hash;                      /* symbol_slot_hash of the name, compared before touching the entry */
+  s7_pointer entry;                   /* the symbol's (symbol . raw name info) pair, NULL = empty, sc->unused = removed gensym */
+} symbol_slot_t;
+
 
 /* -------------------------------- s7_scheme struct -------------------------------- */
 struct s7_scheme {
@@ -1110,6 +1135,10 @@ struct s7_scheme {
   int64_t heap_size, gc_freed, gc_total_freed, max_heap_size, gc_temps_size;
   s7_double gc_resize_heap_fraction, gc_resize_heap_by_4_fraction;
   s7_int gc_calls, gc_total_time, gc_start, gc_end;
+  s7_int gc_sweep_loc, gc_sweep_end, gc_sweep_pushed, gc_sweep_already_free; // [c4augustus]
+  int64_t gc_defer_heap_limit; // [c4augustus]
+  s7_double heap_growth_factor; // [c4augustus]
+  void (*heap_resize_hook)(s7_scheme *sc, s7_int old_size, s7_int new_size, s7_double seconds); // [c4augustus]
   heap_block_t *heap_blocks;
 
 #if WITH_HISTORY
@@ -1127,6 +1156,8 @@ struct s7_scheme {
   s7_int *protected_objects_free_list;    /* to avoid a linear search for a place to store an object in sc->protected_objects */
   s7_int protected_objects_size, protected_setters_size, protected_setters_loc;
   s7_int protected_objects_free_list_loc;
+  s7_pointer *gc_roots;                   /* [c4augustus] stack of s7_gc_root_frame locals, see s7_gc_push_root_frame */
+  s7_int gc_roots_size, gc_roots_loc;     /* [c4augustus] */
 
   s7_pointer nil;                     /* empty list */
   s7_pointer T;                       /* $t */
@@ -1136,7 +1167,9 @@ struct s7_scheme {
   s7_pointer no_value;                /* the (values) value */
   s7_pointer unused;                  /* a marker for an unoccupied slot in sc->protected_objects (and other similar stuff) */
 
-  s7_pointer symbol_table;            /* symbol table */
+  symbol_slot_t *symbol_table;        /* symbol table [c4augustus] open-addressed, linear probing */
+  s7_int symbol_table_mask, symbol_table_entries, symbol_table_removed; /* [c4augustus] */
+  int32_t symbol_table_shift;         /* [c4augustus] 64 - log2(table size) */
   s7_pointer rootlet, shadow_rootlet; /* rootlet */
   s7_int rootlet_entries;
   s7_pointer unlet;                   /* original bindings of predefined functions */
@@ -1152,12 +1185,13 @@ struct s7_scheme {
   s7_pointer standard_input, standard_output, standard_error;
 
   s7_pointer sharp_readers;           /* the binding pair for the global *$readers* list */
+  s7_pointer load_record;             /* [c4augustus] (port . records) while s7_load_c_string_record loads port, else #f */
   s7_pointer load_hook;               /* *load-hook* hook object */
   s7_pointer autoload_hook;           /* *autoload-hook* hook object */
   s7_pointer unbound_variable_hook;   /* *unbound-variable-hook* hook object */
   s7_pointer missing_close_paren_hook, rootlet_redefinition_hook;
   s7_pointer error_hook, read_error_hook; /* *error-hook* hook object, and *read-error-hook* */
-  bool gc_off, gc_in_progress;        /* gc_off: if true, the GC won't run */
+  bool gc_off, gc_in_progress, gc_sweeping; /* gc_off: if true, the GC won't run, gc_sweeping: see s7_gc_sweep_step */ // [c4augustus]
   uint32_t gc_stats, gensym_counter, f_class, add_class, multiply_class, subtract_class, num_eq_class;
   int32_t format_column, error_argnum;
   uint64_t capture_let_counter;
@@ -1195,7 +1229,7 @@ struct s7_scheme {
   char *typnam;
   int32_t typnam_len, print_width;
   s7_pointer *singletons;
-  block_t *unentry;                   /* hash-table lookup failure indicator */
+  hash_entry_t *unentry;              /* hash-table lookup failure indicator */
 
   #define INITIAL_FILE_NAMES_SIZE 8
   s7_pointer *file_names;
@@ -1220,6 +1254,8 @@ struct s7_scheme {
 
   void (*begin_hook)(s7_scheme *sc, bool *val);
   opcode_t begin_op;
+  s7_int step_countdown, step_budget; /* [c4augustus] see s7_set_step_budget, countdown is S7_INT64_MAX when there is no budget */
+  bool step_reprieve;                 /* [c4augustus] a dynamic-wind after thunk runs on a spent budget, see catch_dynamic_wind_function */
 
   bool debug_or_profile, profiling_gensyms;
   s7_int current_line, s7_call_line, debug, profile, profile_position;
@@ -1230,8 +1266,10 @@ struct s7_scheme {
   shared_info_t *circle_info;
   format_data_t **fdats;
   int32_t num_fdats, safety;
+  format_program_t *format_programs; // [c4augustus]
   gc_list_t *strings, *vectors, *input_ports, *output_ports, *input_string_ports, *continuations, *c_objects, *hash_tables;
   gc_list_t *gensyms, *undefineds, *multivectors, *weak_refs, *weak_hash_iterators, *opt1_funcs;
+  gc_list_t *gc_sweep_parked; // [c4augustus]
 #if (WITH_GMP)
   gc_list_t *big_integers, *big_ratios, *big_reals, *big_complexes, *big_random_states;
   mpz_t mpz_1, mpz_2, mpz_3, mpz_4;
@@ -1259,6 +1297,8 @@ struct s7_scheme {
   char *num_to_str;
 
   block_t *block_lists[NUM_BLOCK_LISTS];
+  struct block_slab_t *block_slabs[NUM_BLOCK_LISTS]; /* [c4augustus] newest (the one being carved) first, see carve_block */
+  s7_allocator_t allocator;                          /* [c4augustus] */
   size_t alloc_string_k;
   char *alloc_string_cells;
 
@@ -1352,6 +1392,9 @@ struct s7_scheme {
              write_byte_symbol, write_char_symbol, write_string_symbol, write_symbol,
              local_documentation_symbol, local_signature_symbol, local_setter_symbol, local_iterator_symbol;
   s7_pointer hash_code_symbol, dummy_equal_hash_table;
+  s7_pointer float_vector_add_symbol, float_vector_scale_symbol, float_vector_fma_symbol, float_vector_lerp_symbol, float_vector_clamp_symbol,
+             float_vector_dot_symbol, float_vector_sum_symbol, float_vector_min_symbol, float_vector_max_symbol; // [c4augustus]
+  s7_pointer sort_by_symbol; // [c4augustus]
 #if (!WITH_PURE_S7)
   s7_pointer is_char_ready_symbol, char_ci_leq_symbol, char_ci_lt_symbol, char_ci_eq_symbol, char_ci_geq_symbol, char_ci_gt_symbol,
              let_to_list_symbol, integer_length_symbol, string_ci_leq_symbol, string_ci_lt_symbol, string_ci_eq_symbol,
@@ -1387,6 +1430,7 @@ struct s7_scheme {
              format_f, format_no_column, format_just_control_string, format_as_objstr, values_uncopied, int_log2,
              memq_2, memq_3, memq_4, memq_any, tree_set_memq_syms, simple_inlet, sublet_curlet, profile_out, simple_list_values,
              lint_let_ref, lint_let_set, geq_2, add_i_random, is_defined_in_rootlet;
+  s7_pointer format_compiled; // [c4augustus]
 
   s7_pointer multiply_2, invert_1, invert_x, divide_2, divide_by_2, max_2, min_2, max_3, min_3,
              num_eq_2, num_eq_xi, num_eq_ix, less_xi, less_xf, less_x0, less_2, greater_xi, greater_xf, greater_2,
@@ -1445,6 +1489,25 @@ struct s7_scheme {
 
 static noreturn void error_nr(s7_scheme *sc, s7_pointer type, s7_pointer info);
 static s7_pointer wrap_string(s7_scheme *sc, const char *str, s7_int len);
+static s7_pointer set_elist_1(s7_scheme *sc, s7_pointer x1); /* [c4augustus] for carve_block */
+static void step_budget_exceeded(s7_scheme *sc); /* [c4augustus] */
+
+/* [c4augustus] one eval step: the eval loop counts one for each form it evaluates, not for the ops that
+ *   return to a form already counted, and so does each pass of the loops that the tail-call and do
+ *   optimizations run in C, since those never return to the eval loop;
+ *   a do loop whose passes are counted when it starts is charged for all of them at once
+ */
+#define step_tick(Sc) ((--((Sc)->step_countdown) < 0) ? step_budget_exceeded(Sc) : (void)0)
+static inline void step_charge(s7_scheme *sc, s7_int from, s7_int to) /* counted loops, up front, for their passes from "from" to "to" */
+{
+  if (to > from)
+    {
+      uint64_t steps = (uint64_t)to - (uint64_t)from; /* to - from can overflow s7_int, this cannot */
+      if (steps > (uint64_t)(sc->step_countdown))
+	step_budget_exceeded(sc);
+      else sc->step_countdown -= (s7_int)steps;
+    }
+}
 
 #if S7_DEBUGGING
   static void gdb_break(void) {};
@@ -1465,8 +1528,6 @@ static FILE *old_fopen(const char *pathname, const char *mode) {return(fopen(pat
 #define fwrite local_fwrite
 #define fopen local_fopen   /* open only used for file_probe (O_RDONLY), creat and write not used */
 
-static s7_pointer set_elist_1(s7_scheme *sc, s7_pointer x1);
-
 static size_t local_fwrite(const void *ptr, size_t size, size_t nmemb, FILE *stream)
 {
   error_nr(cur_sc, cur_sc->io_error_symbol, 
@@ -1582,7 +1643,69 @@ static Vectorized void memclr64(void *p, size_t bytes)
 static void init_block_lists(s7_scheme *sc)
 {
   for (int32_t i = 0; i < NUM_BLOCK_LISTS; i++)
-    sc->block_lists[i] = NULL;
+    {
+      sc->block_lists[i] = NULL;
+      sc->block_slabs[i] = NULL; /* [c4augustus] */
+    }
+}
+
+/* [c4augustus] the data of the blocks in bins 3 to 16 is carved from slabs of one size class each, aligned to the
+ *   slab size so a block finds its slab by masking its data pointer.  The hot path is unchanged: a freed block keeps its
+ *   data and goes back on its bin's list.  Occupancy is counted only when asked for, by walking the free lists.
+ */
+typedef struct block_slab_t {
+  struct block_slab_t *next;
+  void (*release)(void *data, void *ptr, size_t bytes); /* the allocator that made the slab */
+  void *release_data;
+  size_t bytes, first;                                  /* first: offset of the first chunk, past this header */
+  s7_int capacity, carved, free_chunks;                 /* free_chunks: only valid during count_free_chunks's callers */
+} block_slab_t;
+
+#define BLOCK_SLAB_BYTES 65536
+#define block_slab_bytes(Index)          (((16 << (Index)) > BLOCK_SLAB_BYTES) ? (size_t)(16 << (Index)) : (size_t)BLOCK_SLAB_BYTES)
+#define block_slab(p, Index)             ((block_slab_t *)((uintptr_t)block_data(p) & ~((uintptr_t)block_slab_bytes(Index) - 1)))
+
+static void *malloc_slab(void *unused_data, size_t bytes, size_t alignment)
+{
+#if MS_WINDOWS
+  return(_aligned_malloc(bytes, alignment));
+#else
+  void *p = NULL;
+  return((posix_memalign(&p, alignment, bytes) == 0) ? p : NULL);
+#endif
+}
+
+static void free_slab(void *unused_data, void *ptr, size_t unused_bytes)
+{
+#if MS_WINDOWS
+  _aligned_free(ptr);
+#else
+  free(ptr);
+#endif
+}
+
+static s7_allocator_t default_allocator = {malloc_slab, free_slab, NULL};
+
+static void *carve_block(s7_scheme *sc, int32_t index)
+{
+  block_slab_t *slab = sc->block_slabs[index];
+  size_t chunk = (size_t)1 << index;
+  if ((!slab) || (slab->carved == slab->capacity))
+    {
+      size_t bytes = block_slab_bytes(index);
+      slab = (block_slab_t *)((*(sc->allocator.alloc))(sc->allocator.data, bytes, bytes));
+      if (!slab)
+	error_nr(sc, sc->out_of_memory_symbol, set_elist_1(sc, wrap_string(sc, "slab allocation failed", 22)));
+      slab->release = sc->allocator.free;
+      slab->release_data = sc->allocator.data;
+      slab->bytes = bytes;
+      slab->first = (sizeof(block_slab_t) + chunk - 1) & ~(chunk - 1);
+      slab->capacity = (bytes - slab->first) / chunk;
+      slab->carved = 0;
+      slab->next = sc->block_slabs[index];
+      sc->block_slabs[index] = slab;
+    }
+  return((void *)((uint8_t *)slab + slab->first + chunk * slab->carved++));
 }
 
 static inline void liberate(s7_scheme *sc, block_t *p)
@@ -1694,7 +1817,7 @@ static Inline block_t *inline_mallocate(s7_scheme *sc, size_t bytes)
 		  return(p);
 		}}
 	  p = mallocate_block(sc);
-	  block_data(p) = (index < TOP_BLOCK_LIST) ? (void *)permalloc(sc, (size_t)(1 << index)) : Malloc(bytes);
+	  block_data(p) = (index < TOP_BLOCK_LIST) ? carve_block(sc, index) : Malloc(bytes); /* [c4augustus] was permalloc */
 	  block_set_index(p, index);
 	}}
   else p = mallocate_block(sc);
@@ -1728,9 +1851,87 @@ static block_t *reallocate(s7_scheme *sc, block_t *op, size_t bytes)
 
 /* we can't export mallocate et al without also exporting block_t or accessors for it
  *   that is, the block_t* pointer returned can't be used as if it were the void* pointer returned by malloc
- * ideally we'd have a way to release excessive mallocate bins, but they are permalloc'd individually
+ * [c4augustus] the bins come from slabs now, see s7_gc_release_slabs
  */
 
+static void count_free_chunks(s7_scheme *sc, int32_t index)
+{
+  for (block_slab_t *slab = sc->block_slabs[index]; slab; slab = slab->next)
+    slab->free_chunks = 0;
+  for (block_t *b = sc->block_lists[index]; b; b = block_next(b))
+    block_slab(b, index)->free_chunks++;
+}
+
+void s7_set_allocator(s7_scheme *sc, const s7_allocator_t *allocator) // [c4augustus]
+{
+  s7_allocator_t *a = (sc) ? &(sc->allocator) : &default_allocator;
+  if (allocator)
+    (*a) = (*allocator);
+  else
+    {
+      a->alloc = malloc_slab;
+      a->free = free_slab;
+      a->data = NULL;
+    }
+}
+
+s7_int s7_slab_stats(s7_scheme *sc, s7_slab_stats_t *stats, s7_int max_classes) // [c4augustus]
+{
+  s7_int n = 0;
+  for (int32_t i = 3; (i < TOP_BLOCK_LIST) && (n < max_classes); i++, n++)
+    {
+      stats[n].chunk_bytes = 1LL << i;
+      stats[n].slabs = 0;
+      stats[n].chunks = 0;
+      stats[n].free_chunks = 0;
+      count_free_chunks(sc, i);
+      for (block_slab_t *slab = sc->block_slabs[i]; slab; slab = slab->next)
+	{
+	  stats[n].slabs++;
+	  stats[n].chunks += slab->carved;
+	  stats[n].free_chunks += slab->free_chunks;
+	}}
+  return(n);
+}
+
+s7_int s7_gc_release_slabs(s7_scheme *sc) // [c4augustus]
+{
+  s7_int released = 0;
+  for (int32_t i = 3; i < TOP_BLOCK_LIST; i++)
+    {
+      block_slab_t **sp;
+      block_t **bp;
+      bool empty = false;
+      count_free_chunks(sc, i);
+      for (block_slab_t *slab = sc->block_slabs[i]; slab; slab = slab->next)
+	if (slab->free_chunks == slab->carved) {empty = true; break;}
+      if (!empty) continue;
+      for (bp = &(sc->block_lists[i]); *bp; )
+	{
+	  block_t *b = *bp;
+	  block_slab_t *slab = block_slab(b, i);
+	  if (slab->free_chunks == slab->carved)
+	    {
+	      (*bp) = block_next(b);
+	      block_data(b) = NULL;
+	      liberate_block(sc, b);
+	    }
+	  else bp = &(block_next(b));
+	}
+      for (sp = &(sc->block_slabs[i]); *sp; )
+	{
+	  block_slab_t *slab = *sp;
+	  if (slab->free_chunks == slab->carved)
+	    {
+	      (*sp) = slab->next;
+	      released += slab->bytes;
+	      (*(slab->release))(slab->release_data, (void *)slab, slab->bytes);
+	    }
+	  else sp = &(slab->next);
+	}}
+  return(released);
+}
+
 
 /* -------------------------------------------------------------------------------- */
 typedef enum {P_DISPLAY, P_WRITE, P_READABLE, P_KEY, P_CODE} use_write_t;
@@ -3340,9 +3541,9 @@ static s7_pointer slot_expression(s7_pointer p)    \
 #define hash_table_block(p)            (T_Hsh(p))->object.hasher.block
 #define unchecked_hash_table_block(p)  p->object.hasher.block
 #define hash_table_set_block(p, b)     (T_Hsh(p))->object.hasher.block = b
-#define hash_table_element(p, i)       (T_Hsh(p))->object.hasher.elements[i]
 #define hash_table_elements(p)         (T_Hsh(p))->object.hasher.elements /* block data (dx) */
 #define hash_table_entries(p)          hash_table_block(p)->nx.nx_int
+#define hash_table_removed(p)          (T_Hsh(p))->object.hasher.elements[hash_table_mask(p) + 1].raw_hash /* [c4augustus] kept in the slot past the end */
 #define hash_table_checker(p)          (T_Hsh(p))->object.hasher.hash_func
 #define hash_table_mapper(p)           (T_Hsh(p))->object.hasher.loc
 #define hash_table_procedures(p)       T_Lst(hash_table_block(p)->ex.ex_ptr)
@@ -3362,13 +3563,11 @@ static s7_pointer slot_expression(s7_pointer p)    \
 #if S7_DEBUGGING
 #define T_Itr_Pos(p)                   titr_pos(sc, T_Itr(p), __func__, __LINE__)
 #define T_Itr_Len(p)                   titr_len(sc, T_Itr(p), __func__, __LINE__)
-#define T_Itr_Hash(p)                  titr_hash(sc, T_Itr(p), __func__, __LINE__)
 #define T_Itr_Let(p)                   titr_let(sc, T_Itr(p), __func__, __LINE__)
 #define T_Itr_Pair(p)                  titr_pair(sc, T_Itr(p), __func__, __LINE__)
 #else
 #define T_Itr_Pos(p)                   p
 #define T_Itr_Len(p)                   p
-#define T_Itr_Hash(p)                  p
 #define T_Itr_Let(p)                   p
 #define T_Itr_Pair(p)                  p
 #endif
@@ -3381,7 +3580,6 @@ static s7_pointer slot_expression(s7_pointer p)    \
 #define iterator_is_at_end(p)          (!iter_ok(p))                                /* ((full_type(T_Itr(p)) & T_ITER_OK) == 0) */
 #define iterator_slow(p)               T_Lst((T_Itr_Pair(p))->object.iter.lw.slow)
 #define iterator_set_slow(p, Val)      (T_Itr_Pair(p))->object.iter.lw.slow = T_Lst(Val)
-#define iterator_hash_current(p)       (T_Itr_Hash(p))->object.iter.lw.hcur
 #define iterator_current(p)            (T_Itr(p))->object.iter.cur
 #define iterator_current_slot(p)       T_Sln((T_Itr_Let(p))->object.iter.lc.lcur)
 #define iterator_set_current_slot(p, Val) (T_Itr_Let(p))->object.iter.lc.lcur = T_Sln(Val)
@@ -3736,6 +3934,7 @@ static s7_pointer make_permanent_integer(s7_int i)
   s7_pointer p = (s7_pointer)Calloc(1, sizeof(s7_cell)); /* Calloc to clear name */
   full_type(p) = T_IMMUTABLE | T_INTEGER | T_UNHEAP;
   integer(p) = i;
+  set_mark(p); /* [c4augustus] see init_small_ints */
   return(p);
 }
 
@@ -3772,6 +3971,11 @@ static void init_small_ints(void)
     }
   for (int32_t i = 0; i < 10; i++)
     set_number_name(small_ints[i], ones[i], 1);
+  for (int32_t i = 10; i < NUM_SMALL_INTS; i++) /* [c4augustus] the printer no longer names shared cells lazily */
+    {
+      char buf[8];
+      set_number_name(small_ints[i], buf, snprintf(buf, 8, "%d", i));
+    }
 
   /* setup a few other numbers while we're here */
   #define EXTRA_NUMBERS 11
@@ -3812,6 +4016,12 @@ static void init_small_ints(void)
   set_number_name(mostfix, "9223372036854775807", 19);
   set_number_name(leastfix, "-9223372036854775808", 20);
 
+  /* [c4augustus] these cells are shared by every s7_scheme and live outside all heaps, so nothing ever clears their
+   *   mark once a gc sets it.  Setting it here keeps concurrent gc's in different sessions from writing to them.
+   */
+  for (int32_t i = 0; i < NUM_SMALL_INTS; i++) set_mark(small_ints[i]);
+  for (int32_t i = 0; i < EXTRA_NUMBERS; i++) set_mark(&cells[i]);
+
   for (int32_t i = 0; i < NUM_CHARS; i++) t_number_separator_p[i] = true;
   t_number_separator_p[(uint8_t)'i'] = false;
   t_number_separator_p[(uint8_t)'+'] = false;
@@ -4628,8 +4838,15 @@ static int64_t heap_location(s7_scheme *sc, s7_pointer p)
 
 #if TRAP_SEGFAULT
 #include <signal.h>
-static Jmp_Buf senv; /* global here is not a problem -- it is used only to protect s7_is_valid */
-static volatile sig_atomic_t can_jump = 0;
+#if defined(_MSC_VER)
+  #define Thread_local __declspec(thread)
+#elif __cplusplus
+  #define Thread_local thread_local
+#else
+  #define Thread_local _Thread_local
+#endif
+static Thread_local Jmp_Buf senv; /* [c4augustus] per thread, so sessions on other threads can call s7_is_valid */
+static Thread_local volatile sig_atomic_t can_jump = 0;
 static void segv(int32_t unused) {if (can_jump) LongJmp(senv, 1);}
 #endif
 
@@ -6465,6 +6682,32 @@ void s7_gc_unprotect_at(s7_scheme *sc, s7_int loc)
     }
 }
 
+s7_int s7_gc_push_root_frame(s7_scheme *sc) /* [c4augustus] */
+{
+  return(sc->gc_roots_loc);
+}
+
+s7_pointer s7_gc_root(s7_scheme *sc, s7_pointer x) /* [c4augustus] */
+{
+  if (sc->gc_roots_loc == sc->gc_roots_size)
+    {
+      sc->gc_roots_size = (sc->gc_roots_size == 0) ? 64 : (2 * sc->gc_roots_size);
+      sc->gc_roots = (s7_pointer *)Realloc(sc->gc_roots, sc->gc_roots_size * sizeof(s7_pointer));
+    }
+  sc->gc_roots[sc->gc_roots_loc++] = x;
+  return(x);
+}
+
+void s7_gc_pop_root_frame(s7_scheme *sc, s7_int frame) /* [c4augustus] */
+{
+  if ((frame < 0) || (frame > sc->gc_roots_loc))
+    {
+      if (S7_DEBUGGING) fprintf(stderr, "%s: frame %" ld64 " is not on the root stack (top %" ld64 ")\n", __func__, frame, sc->gc_roots_loc);
+      return;
+    }
+  sc->gc_roots_loc = frame;
+}
+
 s7_pointer s7_gc_protected_at(s7_scheme *sc, s7_int loc)
 {
   s7_pointer obj = sc->unspecified;
@@ -6661,6 +6904,11 @@ static void free_hash_table(s7_scheme *sc, s7_pointer table);
 static void remove_gensym_from_symbol_table(s7_scheme *sc, s7_pointer sym);
 static void cull_weak_hash_table(s7_scheme *sc, s7_pointer table);
 
+/* [c4augustus] when s7_gc_sweep_step starts a cycle, sweep runs right after the mark, before any heap cell has been freed:
+ *   then everything in the heap that is not marked is garbage even though its type has not been cleared yet
+ */
+#define is_unreachable(Sc, P) ((Sc->gc_sweeping) ? ((signed_type(P) >= 0) && (((P)->tf.opts.high_flag & T_SHORT_UNHEAP) == 0)) : (is_free_and_clear(P)))
+
 static void sweep(s7_scheme *sc)
 {
   s7_int i, j;
@@ -6672,7 +6920,7 @@ static void sweep(s7_scheme *sc)
         for (i = 0, j = 0; i < gp->loc; i++)		\
           {						\
             s7_pointer s1 = gp->list[i];		\
-            if (is_free_and_clear(s1))			\
+            if (is_unreachable(sc, s1))			\
               {						\
                 Code;					\
               }						\
@@ -6686,7 +6934,6 @@ static void sweep(s7_scheme *sc)
 
   gp = sc->gensyms;
   process_gc_list(remove_gensym_from_symbol_table(sc, s1); liberate(sc, gensym_block(s1)))
-  if (gp->loc == 0) mark_function[T_SYMBOL] = mark_noop;
 
   gp = sc->undefineds;
   process_gc_list(free(undefined_name(s1)))
@@ -6706,7 +6953,7 @@ static void sweep(s7_scheme *sc)
       for (i = 0, j = 0; i < gp->loc; i++)
 	{
 	  s7_pointer s1 = gp->list[i];
-	  if (is_free_and_clear(s1))
+	  if (is_unreachable(sc, s1))
 	    free_hash_table(sc, s1);
 	  else
 	    {
@@ -6728,7 +6975,7 @@ static void sweep(s7_scheme *sc)
       for (i = 0, j = 0; i < gp->loc; i++)
 	{
 	  s7_pointer s1 = gp->list[i];
-	  if (!is_free_and_clear(s1))
+	  if (!is_unreachable(sc, s1))
 	    gp->list[j++] = s1;
 	}
       gp->loc = j;
@@ -6752,11 +6999,11 @@ static void sweep(s7_scheme *sc)
       for (i = 0, j = 0; i < gp->loc; i++)
 	{
 	  s7_pointer s1 = gp->list[i];
-	  if (!is_free_and_clear(s1))
+	  if (!is_unreachable(sc, s1))
 	    {
-	      if (is_free_and_clear(c_pointer_weak1(s1)))
+	      if (is_unreachable(sc, c_pointer_weak1(s1)))
 		c_pointer_weak1(s1) = sc->F;
-	      if (is_free_and_clear(c_pointer_weak2(s1)))
+	      if (is_unreachable(sc, c_pointer_weak2(s1)))
 		c_pointer_weak2(s1) = sc->F;
 	      if ((c_pointer_weak1(s1) != sc->F) ||
 		  (c_pointer_weak2(s1) != sc->F))
@@ -6808,7 +7055,6 @@ static void just_mark(s7_pointer p) {set_mark(p);}
 static void add_gensym(s7_scheme *sc, s7_pointer p)
 {
   add_to_gc_list(sc->gensyms, p);
-  mark_function[T_SYMBOL] = just_mark;
 }
 
 #define add_c_object(sc, p)          add_to_gc_list(sc->c_objects, p)
@@ -6849,6 +7095,7 @@ static void init_gc_caches(s7_scheme *sc)
   sc->weak_refs = make_gc_list();
   sc->weak_hash_iterators = make_gc_list();
   sc->opt1_funcs = make_gc_list();
+  sc->gc_sweep_parked = make_gc_list(); // [c4augustus]
 #if WITH_GMP
   sc->big_integers = make_gc_list();
   sc->big_ratios = make_gc_list();
@@ -6891,14 +7138,11 @@ static inline void gc_mark(s7_pointer p) {if (!is_marked(p)) (*mark_function[unc
 
 static void mark_symbol_vector(s7_pointer p, s7_int len)
 {
+  s7_pointer *e = vector_elements(p);
   set_mark(p);
-  if (mark_function[T_SYMBOL] != mark_noop) /* else no gensyms */
-    {
-      s7_pointer *e = vector_elements(p);
-      for (s7_int i = 0; i < len; i++)
-	if ((is_symbol(e[i])) && (is_gensym(e[i]))) /* need is_symbol: make-vector + set! vector-typer symbol? where init is not a symbol */
-	  set_mark(e[i]);
-    }
+  for (s7_int i = 0; i < len; i++) /* [c4augustus] no shared "any gensyms" shortcut, see init_mark_functions */
+    if ((is_symbol(e[i])) && (is_gensym(e[i]))) /* need is_symbol: make-vector + set! vector-typer symbol? where init is not a symbol */
+      set_mark(e[i]);
 }
 
 static void mark_simple_vector(s7_pointer p, s7_int len)
@@ -7074,13 +7318,6 @@ static void mark_continuation(s7_pointer p)
   gc_mark(continuation_op_stack(p));
 }
 
-static void mark_vector(s7_pointer p)
-{
-  if (is_typed_vector(p))
-    typed_vector_gc_mark(p)(p, vector_length(p));
-  else mark_vector_1(p, vector_length(p));
-}
-
 static void mark_vector_possibly_shared(s7_pointer p)
 {
   /* If a subvector (an inner dimension) of a vector is the only remaining reference
@@ -7116,15 +7353,25 @@ static void mark_vector_possibly_shared(s7_pointer p)
     mark_vector_1(p, vector_length(p));
 }
 
-static void mark_int_or_float_vector(s7_pointer p) {set_mark(p);}
+static void mark_vector(s7_pointer p)
+{
+  if (is_subvector(p)) /* [c4augustus] checked here rather than swapping in mark_vector_possibly_shared when one is made */
+    mark_vector_possibly_shared(p);
+  else
+    if (is_typed_vector(p))
+      typed_vector_gc_mark(p)(p, vector_length(p));
+    else mark_vector_1(p, vector_length(p));
+}
 
-static void mark_int_or_float_vector_possibly_shared(s7_pointer p)
+static void mark_int_or_float_vector(s7_pointer p)
 {
-  if (is_subvector(p))
-    mark_int_or_float_vector_possibly_shared(subvector_vector(p));
+  if (is_subvector(p)) /* [c4augustus] as in mark_vector, this works for byte-vectors also */
+    mark_int_or_float_vector(subvector_vector(p));
   set_mark(p);
 }
 
+static void mark_symbol(s7_pointer p) {if (is_gensym(p)) set_mark(p);} /* [c4augustus] only gensyms are in the heap */
+
 static void mark_c_object(s7_pointer p)
 {
   set_mark(p);
@@ -7160,33 +7407,23 @@ static void mark_hash_table(s7_pointer p)
   if (hash_table_entries(p) > 0)
     {
       s7_int len = hash_table_mask(p) + 1;
-      hash_entry_t **entries = hash_table_elements(p);
-      hash_entry_t **last = (hash_entry_t **)(entries + len);
+      hash_entry_t *xp = hash_table_elements(p);
+      hash_entry_t *last = (hash_entry_t *)(xp + len);
 
       if ((is_weak_hash_table(p)) &&
 	  (weak_hash_iters(p) == 0))
-	while (entries < last)
+	for (; xp < last; xp++)
 	  {
-	    hash_entry_t *xp;
-	    for (xp = *entries++; xp; xp = hash_entry_next(xp))
-	      gc_mark(hash_entry_value(xp));
-	    for (xp = *entries++; xp; xp = hash_entry_next(xp))
+	    if (hash_entry_is_live(xp))
 	      gc_mark(hash_entry_value(xp));
 	  }
       else
-	while (entries < last) /* counting entries here was slightly faster */
-	  {
-	    hash_entry_t *xp;
-	    for (xp = *entries++; xp; xp = hash_entry_next(xp))
-	      {
-		gc_mark(hash_entry_key(xp));
-		gc_mark(hash_entry_value(xp));
-	      }
-	    for (xp = *entries++; xp; xp = hash_entry_next(xp))
-	      {
-		gc_mark(hash_entry_key(xp));
-		gc_mark(hash_entry_value(xp));
-	      }}}
+	for (; xp < last; xp++)
+	  if (hash_entry_is_live(xp))
+	    {
+	      gc_mark(hash_entry_key(xp));
+	      gc_mark(hash_entry_value(xp));
+	    }}
 }
 
 static void mark_iterator(s7_pointer p)
@@ -7214,6 +7451,9 @@ static void mark_output_port(s7_pointer p)
 
 static void init_mark_functions(void)
 {
+  /* [c4augustus] every s7_scheme shares this table, so it is never written after the first s7_init;
+   *   the gensym, subvector, output function port and c-proc* default cases are checked per cell instead
+   */
   mark_function[T_FREE]                = mark_noop;
   mark_function[T_UNDEFINED]           = just_mark;
   mark_function[T_EOF]                 = mark_noop;
@@ -7223,7 +7463,7 @@ static void init_mark_functions(void)
   mark_function[T_BOOLEAN]             = mark_noop;
   mark_function[T_SYNTAX]              = mark_noop;
   mark_function[T_CHARACTER]           = mark_noop;
-  mark_function[T_SYMBOL]              = mark_noop; /* this changes to just_mark when gensyms are in the heap */
+  mark_function[T_SYMBOL]              = mark_symbol;
   mark_function[T_STRING]              = just_mark;
   mark_function[T_INTEGER]             = just_mark;
   mark_function[T_RATIO]               = just_mark;
@@ -7235,21 +7475,21 @@ static void init_mark_functions(void)
   mark_function[T_BIG_COMPLEX]         = just_mark;
   mark_function[T_RANDOM_STATE]        = just_mark;
   mark_function[T_GOTO]                = just_mark;
-  mark_function[T_OUTPUT_PORT]         = just_mark; /* changed to mark_output_port if output function ports are active */
+  mark_function[T_OUTPUT_PORT]         = mark_output_port;
   mark_function[T_C_MACRO]             = just_mark;
   mark_function[T_C_POINTER]           = mark_c_pointer;
   mark_function[T_C_FUNCTION]          = just_mark;
-  mark_function[T_C_FUNCTION_STAR]     = just_mark; /* changes to mark_c_proc_star if defaults involve an expression */
+  mark_function[T_C_FUNCTION_STAR]     = mark_c_proc_star;
   mark_function[T_C_RST_NO_REQ_FUNCTION] = just_mark;
   mark_function[T_PAIR]                = mark_pair;
   mark_function[T_CLOSURE]             = mark_closure;
   mark_function[T_CLOSURE_STAR]        = mark_closure;
   mark_function[T_CONTINUATION]        = mark_continuation;
   mark_function[T_INPUT_PORT]          = mark_input_port;
-  mark_function[T_VECTOR]              = mark_vector; /* this changes if subvector created (similarly below) */
+  mark_function[T_VECTOR]              = mark_vector;
   mark_function[T_INT_VECTOR]          = mark_int_or_float_vector;
   mark_function[T_FLOAT_VECTOR]        = mark_int_or_float_vector;
-  mark_function[T_BYTE_VECTOR]         = just_mark;
+  mark_function[T_BYTE_VECTOR]         = mark_int_or_float_vector;
   mark_function[T_MACRO]               = mark_closure;
   mark_function[T_BACRO]               = mark_closure;
   mark_function[T_MACRO_STAR]          = mark_closure;
@@ -7334,25 +7574,9 @@ static __attribute__ ((format (printf, 3, 4))) void s7_warn(s7_scheme *sc, s7_in
 static void s7_warn(s7_scheme *sc, s7_int len, const char *ctrl, ...);
 #endif
 
-#if S7_DEBUGGING
-static int64_t gc(s7_scheme *sc, const char *func, int32_t line)
-#else
-static int64_t gc(s7_scheme *sc)
-#endif
+static void mark_roots(s7_scheme *sc) /* [c4augustus] shared by gc and s7_gc_sweep_step */
 {
-  s7_cell **old_free_heap_top;
   s7_int i;
-
-  if (sc->gc_in_progress)
-    error_nr(sc, sc->error_symbol, set_elist_1(sc, wrap_string(sc, "GC called recursively", 21)));
-  sc->gc_in_progress = true;
-  sc->gc_start = my_clock();
-  sc->gc_calls++;
-#if S7_DEBUGGING
-  sc->last_gc_line = line;
-#endif
-  sc->continuation_counter = 0;
-
   mark_rootlet(sc);
   mark_owlet(sc);
 
@@ -7401,6 +7625,7 @@ static int64_t gc(s7_scheme *sc)
 
   gc_mark(sc->rec_p1);
   gc_mark(sc->rec_p2);
+  gc_mark(sc->load_record); /* [c4augustus] */
 
   /* these probably don't need to be marked */
   for (s7_pointer p = sc->wrong_type_arg_info; is_pair(p); p = cdr(p)) gc_mark(car(p));
@@ -7436,6 +7661,8 @@ static int64_t gc(s7_scheme *sc)
 	gc_mark(sc->rec_els[i]);
     }
   mark_vector(sc->protected_objects);
+  for (i = 0; i < sc->gc_roots_loc; i++) /* [c4augustus] */
+    gc_mark(sc->gc_roots[i]);
   mark_vector(sc->protected_setters);
   set_mark(sc->protected_setter_symbols);
   if ((is_symbol(sc->profile_prefix)) && (is_gensym(sc->profile_prefix))) set_mark(sc->profile_prefix);
@@ -7473,17 +7700,146 @@ static int64_t gc(s7_scheme *sc)
 	if ((is_marked(s1)) && (!is_marked(opt1_any(s1)))) /* opt1_lambda, but op_unknown* can change to opt1_cfunc etc */
 	  gc_mark(opt1_any(s1));                           /* not set_mark -- need to protect let/body/args as well */
       }}
+}
+
+
+/* -------------------------------- incremental sweep -------------------------------- */
+/* [c4augustus] s7_gc_sweep_step splits a collection into an atomic mark (followed by sweep's gc_list pass, so weak hash tables,
+ *   weak refs and the symbol table never hand out a dead object) and a heap sweep that runs in chunks across calls.
+ *   Nothing unmarked at the end of the mark can become reachable again, so the mutator needs no write barrier;
+ *   it only has to keep the mark when it retypes a live cell (reuse_as_let, reuse_as_slot), and free_cell parks
+ *   its cells on sc->gc_sweep_parked with the mark set so that the sweep does not push them a second time.
+ *   The free list is emptied when the mark ends and the sweep rebuilds it from every unmarked cell it passes.
+ */
+
+static void sweep_heap_chunk(s7_scheme *sc, s7_int bottom)
+{
+  /* sweeps down from gc_sweep_loc to bottom, like gc */
+  s7_pointer *fp = sc->free_heap_top;
+  s7_pointer *tp = (s7_pointer *)(sc->heap + sc->gc_sweep_loc);
+  s7_pointer *chunk_bottom = (s7_pointer *)(sc->heap + bottom);
+
+#if S7_DEBUGGING
+  #define gc_sweep_object(Tp)						\
+    p = (*(--Tp));							\
+    if (signed_type(p) >= 0)						\
+      {									\
+        if (signed_type(p) > 0) {p->debugger_bits = 0; p->gc_func = __func__; p->gc_line = __LINE__;} \
+        signed_type(p) = 0;						\
+        (*fp++) = p;							\
+      }									\
+    else clear_mark(p);
+#else
+  #define gc_sweep_object(Tp) p = (*(--Tp)); if (signed_type(p) >= 0) {signed_type(p) = 0; (*fp++) = p;} else clear_mark(p);
+  /* unlike gc_object, a free cell goes back on the (emptied) free list, and a marked free cell is one parked by free_cell */
+#endif
+  while (tp > chunk_bottom)
+    {
+      s7_pointer p;
+      gc_sweep_object(tp);
+    }
+  sc->gc_sweep_pushed += (fp - sc->free_heap_top);
+  sc->gc_sweep_loc = bottom;
+  sc->free_heap_top = fp;
+}
+
+static void start_gc_sweep(s7_scheme *sc)
+{
+  sc->gc_in_progress = true;
+  sc->gc_start = my_clock();
+  sc->gc_calls++;
+  sc->continuation_counter = 0;
+  mark_roots(sc);
+  sc->gc_sweeping = true; /* is_unreachable now checks the mark */
+  sweep(sc);
+  unmark_semipermanent_objects(sc);
+  sc->gc_sweep_already_free = (s7_int)(sc->free_heap_top - sc->free_heap);
+  sc->gc_sweep_pushed = 0;
+  sc->gc_sweep_end = sc->heap_size; /* cells added by resize_heap_to after this point are already on the free list */
+  sc->gc_sweep_loc = sc->gc_sweep_end;
+  sc->free_heap_top = sc->free_heap;
+  sc->previous_free_heap_top = sc->free_heap;
+  sc->gc_total_time += (my_clock() - sc->gc_start);
+  sc->gc_in_progress = false;
+}
+
+static void finish_gc_sweep(s7_scheme *sc)
+{
+  s7_int start = my_clock();
+  s7_int temps = (s7_int)(sc->previous_free_heap_top - sc->free_heap_top);
+  s7_pointer *saved_temps = NULL;
+  gc_list_t *gp = sc->gc_sweep_parked;
+
+  /* we can get here from new_cell, so the gc temps just above free_heap_top have to survive the pushes below */
+  if (temps > sc->gc_temps_size) temps = sc->gc_temps_size;
+  if (temps > 0)
+    {
+      saved_temps = (s7_pointer *)Malloc(temps * sizeof(s7_pointer));
+      memcpy((void *)saved_temps, (void *)(sc->free_heap_top), temps * sizeof(s7_pointer));
+    }
+  sweep_heap_chunk(sc, 0);
+  for (s7_int i = 0; i < gp->loc; i++)
+    {
+      s7_pointer p = gp->list[i];
+      clear_mark(p);
+      (*(sc->free_heap_top++)) = p;
+    }
+  gp->loc = 0;
+  sc->gc_sweeping = false;
+
+  if (temps > 0)
+    {
+      s7_int room = sc->heap_size - (s7_int)(sc->free_heap_top - sc->free_heap);
+      if (temps > room) temps = room;
+      memcpy((void *)(sc->free_heap_top), (void *)saved_temps, temps * sizeof(s7_pointer));
+      free(saved_temps);
+    }
+  else temps = 0;
+  sc->previous_free_heap_top = sc->free_heap_top + temps;
+
+  sc->gc_freed = (int64_t)(sc->gc_sweep_pushed - sc->gc_sweep_already_free);
+  sc->gc_total_freed += sc->gc_freed;
+  sc->gc_end = my_clock();
+  sc->gc_total_time += (sc->gc_end - start);
+  if (show_gc_stats(sc))
+    s7_warn(sc, 256, "incremental gc freed %" ld64 "/%" ld64 " (free: %" p64 "), cycle time: %f\n",
+	    sc->gc_freed, sc->heap_size, (intptr_t)(sc->free_heap_top - sc->free_heap), (double)(sc->gc_end - sc->gc_start) / ticks_per_second());
+}
+
+#if S7_DEBUGGING
+static int64_t gc(s7_scheme *sc, const char *func, int32_t line)
+#else
+static int64_t gc(s7_scheme *sc)
+#endif
+{
+  s7_cell **old_free_heap_top;
+  s7_int i;
+
+  if (sc->gc_in_progress)
+    error_nr(sc, sc->error_symbol, set_elist_1(sc, wrap_string(sc, "GC called recursively", 21)));
+  if (sc->gc_sweeping) finish_gc_sweep(sc); // [c4augustus]
+  sc->gc_in_progress = true;
+  sc->gc_start = my_clock();
+  sc->gc_calls++;
+#if S7_DEBUGGING
+  sc->last_gc_line = line;
+#endif
+  sc->continuation_counter = 0;
+  mark_roots(sc);
 
   /* free up all unmarked objects */
   old_free_heap_top = sc->free_heap_top;
   {
     s7_pointer *fp = sc->free_heap_top;
-    s7_pointer *tp = sc->heap;
-    s7_pointer *heap_top = (s7_pointer *)(sc->heap + sc->heap_size);
+    s7_pointer *tp = (s7_pointer *)(sc->heap + sc->heap_size);
+    s7_pointer *heap_bottom = sc->heap;
+    /* [c4augustus] swept from the top down so that the lowest cells end up on top of the free list: allocation then
+     *   favors the oldest heap blocks and the newest ones can empty out for s7_gc_shrink_heap
+     */
 
 #if S7_DEBUGGING
   #define gc_object(Tp)							\
-    p = (*Tp++);							\
+    p = (*(--Tp));							\
     if (signed_type(p) > 0)						\
       {								        \
         p->debugger_bits = 0; p->gc_func = func; p->gc_line = line;	\
@@ -7493,7 +7849,7 @@ static int64_t gc(s7_scheme *sc)
       }									\
     else if (signed_type(p) < 0) clear_mark(p);
 #else
-  #define gc_object(Tp) p = (*Tp++); if (signed_type(p) > 0) {signed_type(p) = 0; (*fp++) = p;} else if (signed_type(p) < 0) clear_mark(p);
+  #define gc_object(Tp) p = (*(--Tp)); if (signed_type(p) > 0) {signed_type(p) = 0; (*fp++) = p;} else if (signed_type(p) < 0) clear_mark(p);
   /* this appears to be about 10% faster than the previous form
    *   if the sign bit is on, but no other bits, this version will take no action (it thinks the cell is on the free list), but
    *   it means we've marked a free cell as in-use: since types are set as soon as removed from the free list, this has to be a bug
@@ -7502,7 +7858,7 @@ static int64_t gc(s7_scheme *sc)
    *   of long-lived objects.
    */
 #endif
-    while (tp < heap_top)          /* != here or ^ makes no difference, and going to 64 (from 32) doesn't matter */
+    while (tp > heap_bottom)       /* != here or ^ makes no difference, and going to 64 (from 32) doesn't matter */
       {
 	s7_pointer p;
 	LOOP_8(gc_object(tp));
@@ -7565,6 +7921,14 @@ static int64_t gc(s7_scheme *sc)
 static s7_pointer make_symbol(s7_scheme *sc, const char *name, s7_int len); /* calls new_symbol */
 #define make_symbol_with_strlen(Sc, Name) make_symbol(Sc, Name, safe_strlen(Name))
 
+static int64_t grown_heap_size(s7_scheme *sc, int64_t size) // [c4augustus]
+{
+  /* resize_heap_to fills the new cells 32 at a time */
+  int64_t new_size = (int64_t)(size * sc->heap_growth_factor);
+  if (new_size < (size + 32)) new_size = size + 32;
+  return(32 * ((new_size + 31) / 32));
+}
+
 #if S7_DEBUGGING
 #define resize_heap_to(Sc, Size) resize_heap_to_1(Sc, Size, __func__, __LINE__)
 static void resize_heap_to_1(s7_scheme *sc, int64_t size, const char *func, int line)
@@ -7574,6 +7938,7 @@ static void resize_heap_to(s7_scheme *sc, int64_t size)
 {
   int64_t old_size = sc->heap_size;
   int64_t old_free = sc->free_heap_top - sc->free_heap;
+  s7_int start = my_clock(); // [c4augustus]
   s7_cell *cells;
   s7_cell **cp;
   heap_block_t *hp;
@@ -7586,7 +7951,9 @@ static void resize_heap_to(s7_scheme *sc, int64_t size)
 
   if (size == 0)
     {
-      if (old_free < old_size * sc->gc_resize_heap_by_4_fraction)
+      if (sc->heap_growth_factor > 1.0) /* [c4augustus] see s7_set_heap_growth_factor */
+	sc->heap_size = grown_heap_size(sc, sc->heap_size);
+      else if (old_free < old_size * sc->gc_resize_heap_by_4_fraction)
 	sc->heap_size *= 4;          /* *8 if < 1M (or whatever) doesn't make much difference */
       else sc->heap_size *= 2;
       if (sc->gc_resize_heap_fraction > .4)
@@ -7594,7 +7961,7 @@ static void resize_heap_to(s7_scheme *sc, int64_t size)
     }
   else
     if (size > sc->heap_size)
-      while (sc->heap_size < size) sc->heap_size *= 2;
+      while (sc->heap_size < size) sc->heap_size = (sc->heap_growth_factor > 1.0) ? grown_heap_size(sc, sc->heap_size) : (sc->heap_size * 2); // [c4augustus]
     else return;
   /* do not call new_cell here! */
 #if POINTER_32
@@ -7649,6 +8016,8 @@ static void resize_heap_to(s7_scheme *sc, int64_t size)
       else s7_warn(sc, 512, "heap grows to %" ld64 " (old free/size: %" ld64 "/%" ld64 ") from %s\n",
 		   sc->heap_size, old_free, old_size, str);
     }
+  if (sc->heap_resize_hook) /* [c4augustus] */
+    (*(sc->heap_resize_hook))(sc, old_size, sc->heap_size, (s7_double)(my_clock() - start) / (s7_double)ticks_per_second());
   if (sc->heap_size >= sc->max_heap_size)
     error_nr(sc, make_symbol(sc, "heap-too-big", 12),
 	     set_elist_3(sc, wrap_string(sc, "heap has grown past (*s7* 'max-heap-size): ~S > ~S", 50),
@@ -7668,10 +8037,17 @@ static void try_to_call_gc(s7_scheme *sc)
 #endif
 {
   /* called only from new_cell */
-  if (sc->gc_off)     /* we can't just return here!  Someone needs a new cell, and once the heap free list is exhausted, segfault */
+  if ((sc->gc_off) || /* we can't just return here!  Someone needs a new cell, and once the heap free list is exhausted, segfault */
+      (sc->heap_size < sc->gc_defer_heap_limit)) /* [c4augustus] see s7_gc_defer */
     resize_heap(sc);
   else
     {
+      if (sc->gc_sweeping) /* [c4augustus] the free list ran dry before s7_gc_sweep_step finished its cycle */
+	{
+	  finish_gc_sweep(sc);
+	  if ((int64_t)(sc->free_heap_top - sc->free_heap) >= (sc->heap_size / 4))
+	    return;
+	}
       if ((sc->gc_resize_heap_fraction > 0.5) && (sc->heap_size >= 4194304))
 	  sc->gc_resize_heap_fraction = 0.5;
 #if S7_DEBUGGING
@@ -7728,6 +8104,125 @@ s7_pointer s7_gc_on(s7_scheme *sc, bool on)
   return(s7_make_boolean(sc, on));
 }
 
+bool s7_gc_sweep_step(s7_scheme *sc, s7_int budget_us) // [c4augustus]
+{
+  s7_int start, deadline;
+  if ((sc->gc_off) || (sc->gc_in_progress))
+    return(false);
+  start = my_clock();
+  deadline = start + (budget_us * ticks_per_second()) / 1000000;
+  if (!sc->gc_sweeping)
+    {
+      if ((sc->free_heap_top - sc->free_heap) >= (sc->heap_size * GC_SWEEP_START_FRACTION))
+	return(false);
+      start_gc_sweep(sc);
+      start = my_clock(); /* start_gc_sweep has its own time */
+    }
+  do { /* always sweep at least one chunk: the free list is empty right after the mark */
+    if (sc->gc_sweep_loc <= GC_SWEEP_CHUNK_SIZE)
+      {
+	sc->gc_total_time += (my_clock() - start);
+	finish_gc_sweep(sc);
+	/* same policy as try_to_call_gc, judged by what survived the mark rather than by the free list, which has paid
+	 *   for everything allocated during the cycle.  No heap-too-big error out here between evaluations.
+	 */
+	if (((sc->heap_size - (sc->gc_sweep_end - sc->gc_sweep_pushed)) < (sc->heap_size * sc->gc_resize_heap_fraction)) &&
+	    ((sc->heap_size * 4) < sc->max_heap_size))
+	  resize_heap(sc);
+	return(true);
+      }
+    sweep_heap_chunk(sc, sc->gc_sweep_loc - GC_SWEEP_CHUNK_SIZE);
+  } while (my_clock() < deadline);
+  sc->previous_free_heap_top = sc->free_heap_top; /* called between evaluations, so there are no gc temps to keep */
+  sc->gc_total_time += (my_clock() - start);
+  return(false);
+}
+
+bool s7_gc_maybe_collect(s7_scheme *sc, s7_double threshold) // [c4augustus]
+{
+  if ((sc->gc_off) || (sc->gc_in_progress) ||
+      ((sc->free_heap_top - sc->free_heap) >= (sc->heap_size * threshold)))
+    return(false);
+  call_gc(sc);
+  if (((int64_t)(sc->free_heap_top - sc->free_heap) < (sc->heap_size * sc->gc_resize_heap_fraction)) &&
+      ((sc->heap_size * 4) < sc->max_heap_size)) /* as in s7_gc_sweep_step */
+    resize_heap(sc);
+  return(true);
+}
+
+s7_int s7_gc_defer(s7_scheme *sc, s7_int heap_limit) // [c4augustus]
+{
+  s7_int old_limit = sc->gc_defer_heap_limit;
+  sc->gc_defer_heap_limit = (heap_limit < (sc->max_heap_size / 4)) ? heap_limit : (sc->max_heap_size / 4); /* resize_heap can quadruple it */
+  return(old_limit);
+}
+
+void s7_set_heap_growth_factor(s7_scheme *sc, s7_double factor) // [c4augustus]
+{
+  sc->heap_growth_factor = factor;
+}
+
+void s7_set_heap_resize_hook(s7_scheme *sc, void (*hook)(s7_scheme *sc, s7_int old_size, s7_int new_size, s7_double seconds)) // [c4augustus]
+{
+  sc->heap_resize_hook = hook;
+}
+
+static bool heap_block_is_free(s7_scheme *sc, heap_block_t *hp) // [c4augustus]
+{
+  s7_cell *cells = (s7_cell *)(hp->start);
+  for (int64_t k = hp->offset; k < sc->heap_size; k++)
+    if ((sc->heap[k] != &cells[k - hp->offset]) || /* petrified: the block's cell lives on outside the heap */
+	(!is_free_and_clear(sc->heap[k])))
+      return(false);
+  return(true);
+}
+
+s7_int s7_gc_shrink_heap(s7_scheme *sc, s7_int min_size) // [c4augustus]
+{
+  /* the GC does not move cells, so only the newest heap blocks can go, and only if nothing in them survives */
+  int64_t old_size = sc->heap_size;
+  s7_int start;
+  if ((sc->gc_off) || (sc->gc_in_progress))
+    return(sc->heap_size);
+  start = my_clock();
+  call_gc(sc);
+  while ((sc->heap_blocks->next) &&
+	 (sc->heap_blocks->offset >= min_size) &&
+	 (heap_block_is_free(sc, sc->heap_blocks)))
+    {
+      heap_block_t *hp = sc->heap_blocks;
+      s7_pointer *fp = sc->free_heap, *tp;
+      for (tp = sc->free_heap; tp < sc->free_heap_top; tp++)
+	if (((intptr_t)(*tp) < hp->start) || ((intptr_t)(*tp) >= hp->end))
+	  (*fp++) = (*tp);
+      sc->free_heap_top = fp;
+      for (s7_int i = sc->saved_pointers_loc - 1; i >= 0; i--)
+	if (sc->saved_pointers[i] == (void *)(hp->start))
+	  {
+	    sc->saved_pointers[i] = sc->saved_pointers[--sc->saved_pointers_loc];
+	    break;
+	  }
+      free((void *)(hp->start));
+      sc->heap_size = hp->offset;
+      sc->heap_blocks = hp->next;
+      free(hp);
+    }
+  if (sc->heap_size < old_size)
+    {
+      int64_t free_cells = sc->free_heap_top - sc->free_heap;
+      sc->heap = (s7_cell **)Realloc(sc->heap, sc->heap_size * sizeof(s7_cell *));
+      sc->free_heap = (s7_cell **)Realloc(sc->free_heap, sc->heap_size * sizeof(s7_cell *));
+      sc->free_heap_trigger = (s7_cell **)(sc->free_heap + GC_TRIGGER_SIZE);
+      sc->free_heap_top = sc->free_heap + free_cells;
+      sc->previous_free_heap_top = sc->free_heap_top;
+      if (show_heap_stats(sc))
+	s7_warn(sc, 256, "heap shrinks to %" ld64 " (old size: %" ld64 ")\n", sc->heap_size, old_size);
+      if (sc->heap_resize_hook)
+	(*(sc->heap_resize_hook))(sc, old_size, sc->heap_size, (s7_double)(my_clock() - start) / (s7_double)ticks_per_second());
+    }
+  return(sc->heap_size);
+}
+
 #if S7_DEBUGGING
 static void check_free_heap_size_1(s7_scheme *sc, s7_int size, const char *func, int32_t line)
 #define check_free_heap_size(Sc, Size) check_free_heap_size_1(Sc, Size, __func__, __LINE__)
@@ -7826,7 +8321,12 @@ static void free_cell(s7_scheme *sc, s7_pointer p)
   p->explicit_free_line = line;
 #endif
   clear_type(p);
-  (*(sc->free_heap_top++)) = p;
+  if (sc->gc_sweeping) /* [c4augustus] park it until the sweep is done, see finish_gc_sweep */
+    {
+      set_type_bit(p, T_GC_MARK);
+      add_to_gc_list(sc->gc_sweep_parked, p);
+    }
+  else (*(sc->free_heap_top++)) = p;
 }
 
 static inline s7_pointer petrify(s7_scheme *sc, s7_pointer x)
@@ -7835,6 +8335,7 @@ static inline s7_pointer petrify(s7_scheme *sc, s7_pointer x)
   s7_pointer p = (s7_pointer)alloc_big_pointer(sc, loc);
   sc->heap[loc] = p;
   free_cell(sc, p);
+  clear_mark(x);        /* [c4augustus] an incremental sweep can no longer reach x */
   unheap(sc, x);        /* set_immutable(x); */ /* if there are GC troubles, this might catch them? */
   return(x);
 }
@@ -7853,6 +8354,7 @@ static void remove_gensym_from_heap(s7_scheme *sc, s7_pointer x) /* x known to b
   x->gc_func = func;
   x->gc_line = line;
 #endif
+  clear_mark(x); /* [c4augustus] an incremental sweep can no longer reach x */
   unheap(sc, x); /* set UNHEAP bit in type(x) */
   {
     gc_list_t *gp = sc->gensyms;
@@ -7863,7 +8365,6 @@ static void remove_gensym_from_heap(s7_scheme *sc, s7_pointer x) /* x known to b
 	    gp->list[i] = gp->list[j];
 	  gp->list[i] = NULL;
 	  gp->loc--;
-	  if (gp->loc == 0) mark_function[T_SYMBOL] = mark_noop;
 	  break;
 	}}
 }
@@ -8324,7 +8825,89 @@ static s7_pointer make_semipermanent_slot(s7_scheme *sc, s7_pointer symbol, s7_p
   return(slot);
 }
 
-static /* inline */ s7_pointer new_symbol(s7_scheme *sc, const char *name, s7_int len, uint64_t hash, uint32_t location) /* inline useless here 20-Oct-22 */
+/* [c4augustus] the symbol table is open-addressed with linear probing.  raw_string_hash is just the first 16 bytes
+ *   of the name, so symbol_slot_hash also mixes in the length and (for long names) the last 8 bytes, then
+ *   Fibonacci-hashes the result so the top bits pick the slot.  The full slot hash sits beside each entry,
+ *   so a probe only touches the symbol's pair when the hashes match.
+ */
+#define symbol_slot_is_live(Sc, Slot) (((Slot)->entry) && ((Slot)->entry != (Sc)->unused))
+
+static inline uint64_t symbol_slot_hash(uint64_t hash, const char *name, s7_int len)
+{
+  uint64_t h = hash ^ ((uint64_t)len << 56);
+  if (len > 16)
+    {
+      uint64_t tail;
+      memcpy((void *)&tail, (const void *)(name + len - 8), 8);
+      h ^= (tail * 0xff51afd7ed558ccdULL);
+    }
+  return(h * 0x9e3779b97f4a7c15ULL);
+}
+
+static inline bool symbol_names_are_equal(const char *name1, const char *name2, s7_int len)
+{
+  return((len > 16) ? (memcmp((const void *)name1, (const void *)name2, len) == 0) : local_strncmp(name1, name2, len));
+  /* libc memcmp is vectorized on every platform we ship, local_strncmp wins for short names */
+}
+
+static void init_symbol_table(s7_scheme *sc, s7_int size)
+{
+  int32_t bits = 0;
+  while (((s7_int)1 << bits) < size) bits++;
+  sc->symbol_table = (symbol_slot_t *)Calloc((s7_int)1 << bits, sizeof(symbol_slot_t));
+  sc->symbol_table_mask = ((s7_int)1 << bits) - 1;
+  sc->symbol_table_shift = 64 - bits;
+  sc->symbol_table_entries = 0;
+  sc->symbol_table_removed = 0;
+}
+
+static void symbol_table_place(s7_scheme *sc, uint64_t slot_hash, s7_pointer entry)
+{
+  symbol_slot_t *table = sc->symbol_table;
+  s7_int i = (s7_int)(slot_hash >> sc->symbol_table_shift);
+  while (table[i].entry) i = (i + 1) & sc->symbol_table_mask; /* removed slots are left for lookups to step over */
+  table[i].hash = slot_hash;
+  table[i].entry = entry;
+}
+
+static void resize_symbol_table(s7_scheme *sc)
+{
+  symbol_slot_t *old_table = sc->symbol_table;
+  s7_int old_size = sc->symbol_table_mask + 1, entries = sc->symbol_table_entries;
+  init_symbol_table(sc, (entries * 4 > old_size) ? (2 * old_size) : old_size); /* mostly removed gensyms: just rehash */
+  for (s7_int i = 0; i < old_size; i++)
+    if (symbol_slot_is_live(sc, &old_table[i]))
+      symbol_table_place(sc, old_table[i].hash, old_table[i].entry);
+  sc->symbol_table_entries = entries;
+  free(old_table);
+}
+
+static void add_to_symbol_table(s7_scheme *sc, s7_pointer entry, const char *name, s7_int len, uint64_t hash)
+{
+  if (2 * (sc->symbol_table_entries + sc->symbol_table_removed + 1) > sc->symbol_table_mask + 1)
+    resize_symbol_table(sc);
+  symbol_table_place(sc, symbol_slot_hash(hash, name, len), entry);
+  sc->symbol_table_entries++;
+}
+
+static inline s7_pointer symbol_table_find(s7_scheme *sc, const char *name, s7_int len, uint64_t hash)
+{ /* returns the entry pair or NULL, name here might not be null-terminated */
+  uint64_t slot_hash = symbol_slot_hash(hash, name, len);
+  symbol_slot_t *table = sc->symbol_table;
+  for (s7_int i = (s7_int)(slot_hash >> sc->symbol_table_shift); table[i].entry; i = (i + 1) & sc->symbol_table_mask)
+    if (table[i].hash == slot_hash)
+      {
+	s7_pointer x = table[i].entry;
+	if ((x != sc->unused) &&
+	    (hash == pair_raw_hash(x)) &&
+	    ((uint64_t)len == pair_raw_len(x)) &&
+	    ((len <= 8) || (symbol_names_are_equal(name, pair_raw_name(x), len)))) /* if len <= 8, hash is the name */
+	  return(x);
+      }
+  return(NULL);
+}
+
+static /* inline */ s7_pointer new_symbol(s7_scheme *sc, const char *name, s7_int len, uint64_t hash) /* inline useless here 20-Oct-22 */
 {
   /* name might not be null-terminated, these are semipermanent symbols even in s7_gensym; g_gensym handles everything separately */
   uint8_t *base = alloc_symbol(sc);
@@ -8371,54 +8954,30 @@ static /* inline */ s7_pointer new_symbol(s7_scheme *sc, const char *name, s7_in
     }
   full_type(p) = T_PAIR | T_IMMUTABLE | T_UNHEAP;  /* add x to the symbol table */
   set_car(p, x);
-  set_cdr(p, vector_element(sc->symbol_table, location));
-  vector_element(sc->symbol_table, location) = p;
+  set_cdr(p, sc->nil);
   pair_set_raw_hash(p, hash);
   pair_set_raw_len(p, (uint64_t)len); /* symbol name length, so it ought to fit! */
   pair_set_raw_name(p, string_value(str));
+  add_to_symbol_table(sc, p, string_value(str), len, hash); /* [c4augustus] after the keyword's own symbol, which might resize */
   return(x);
 }
 
 static Inline s7_pointer inline_make_symbol(s7_scheme *sc, const char *name, s7_int len) /* inline out: ca 40=2% in tload */
 { /* name here might not be null-terminated */
   uint64_t hash = raw_string_hash((const uint8_t *)name, len);
-  uint32_t location = hash % SYMBOL_TABLE_SIZE;
-
-  if (len <= 8)
-    {
-      for (s7_pointer x = vector_element(sc->symbol_table, location); is_pair(x); x = cdr(x))
-	if ((hash == pair_raw_hash(x)) &&
-	    ((uint64_t)len == pair_raw_len(x)))
-	  return(car(x));
-    }
-  else /* checking name[len=='\0' and using strcmp if so was not a big win */
-    for (s7_pointer x = vector_element(sc->symbol_table, location); is_pair(x); x = cdr(x))
-      if ((hash == pair_raw_hash(x)) &&
-	  ((uint64_t)len == pair_raw_len(x)) &&
-	  (strings_are_equal_with_length(name, pair_raw_name(x), len))) /* length here because name might not be null-terminated */
-	return(car(x));
-  return(new_symbol(sc, name, len, hash, location));
+  s7_pointer x = symbol_table_find(sc, name, len, hash);
+  return((x) ? car(x) : new_symbol(sc, name, len, hash));
 }
 
 static s7_pointer make_symbol(s7_scheme *sc, const char *name, s7_int len) {return(inline_make_symbol(sc, name, len));}
 
 s7_pointer s7_make_symbol(s7_scheme *sc, const char *name) {return(inline_make_symbol(sc, name, safe_strlen(name)));}
 
-static s7_pointer symbol_table_find_by_name(s7_scheme *sc, const char *name, uint64_t hash, uint32_t location, s7_int len)
-{
-  for (s7_pointer x = vector_element(sc->symbol_table, location); is_not_null(x); x = cdr(x))
-    if ((hash == pair_raw_hash(x)) &&
-	(strings_are_equal_with_length(name, pair_raw_name(x), len)))
-      return(car(x));
-  return(sc->nil);
-}
-
 s7_pointer s7_symbol_table_find_name(s7_scheme *sc, const char *name)
 {
   s7_int len = safe_strlen(name);
-  uint64_t hash = raw_string_hash((const uint8_t *)name, len);
-  s7_pointer result = symbol_table_find_by_name(sc, name, hash, hash % SYMBOL_TABLE_SIZE, len);
-  return((is_null(result)) ? NULL : result);
+  s7_pointer result = symbol_table_find(sc, name, len, raw_string_hash((const uint8_t *)name, len));
+  return((result) ? car(result) : NULL);
 }
 
 
@@ -8430,8 +8989,7 @@ static s7_pointer g_symbol_table(s7_scheme *sc, s7_pointer unused_args)
   #define H_symbol_table "(symbol-table) returns a vector containing the current symbol-table symbols"
   #define Q_symbol_table s7_make_signature(sc, 1, sc->is_vector_symbol)
 
-  s7_pointer *els, *entries = vector_elements(sc->symbol_table);
-  int32_t syms = 0;
+  s7_pointer *els;
   s7_pointer lst;
   /* this can't be optimized by returning the actual symbol-table (a vector of lists), because
    *    gensyms can cause the table's lists and symbols to change at any time.  This wreaks havoc
@@ -8440,14 +8998,11 @@ static s7_pointer g_symbol_table(s7_scheme *sc, s7_pointer unused_args)
    *    (< (for-each-symbol func num) (for-each (^ (sym) (? (>> num 0) (for-each-symbol func (- num 1)) (func sym))) (symbol-table)))
    *    (for-each-symbol (^ (sym) (gensym) 1))
    */
-  for (int32_t i = 0; i < SYMBOL_TABLE_SIZE; i++)
-    for (s7_pointer x = entries[i]; is_not_null(x); x = cdr(x))
-      syms++;
-  sc->w = make_simple_vector(sc, syms);
+  sc->w = make_simple_vector(sc, sc->symbol_table_entries);
   els = vector_elements(sc->w);
-  for (int32_t i = 0, j = 0; i < SYMBOL_TABLE_SIZE; i++)
-    for (s7_pointer x = entries[i]; is_not_null(x); x = cdr(x))
-      els[j++] = car(x);
+  for (s7_int i = 0, j = 0; i <= sc->symbol_table_mask; i++)
+    if (symbol_slot_is_live(sc, &sc->symbol_table[i]))
+      els[j++] = car(sc->symbol_table[i].entry);
   lst = sc->w;
   sc->w = sc->unused;
   return(lst);
@@ -8456,10 +9011,10 @@ static s7_pointer g_symbol_table(s7_scheme *sc, s7_pointer unused_args)
 bool s7_for_each_symbol_name(s7_scheme *sc, bool (*symbol_func)(const char *symbol_name, void *data), void *data)
 {
   /* this includes the special constants $<unspecified> and so on for simplicity -- are there any others? */
-  for (int32_t i = 0; i < SYMBOL_TABLE_SIZE; i++)
-    for (s7_pointer x = vector_element(sc->symbol_table, i); is_not_null(x); x = cdr(x))
-      if (symbol_func(symbol_name(car(x)), data))
-	return(true);
+  for (s7_int i = 0; i <= sc->symbol_table_mask; i++)
+    if ((symbol_slot_is_live(sc, &sc->symbol_table[i])) &&
+	(symbol_func(symbol_name(car(sc->symbol_table[i].entry)), data)))
+      return(true);
   return((symbol_func("$t", data))             || (symbol_func("$f", data))             ||
 	 (symbol_func("$<unspecified>", data)) || (symbol_func("$<undefined>", data))   ||
 	 (symbol_func("$<eof>", data))         ||
@@ -8468,10 +9023,10 @@ bool s7_for_each_symbol_name(s7_scheme *sc, bool (*symbol_func)(const char *symb
 
 bool s7_for_each_symbol(s7_scheme *sc, bool (*symbol_func)(const char *symbol_name, void *data), void *data)
 {
-  for (int32_t i = 0; i < SYMBOL_TABLE_SIZE; i++)
-    for (s7_pointer x = vector_element(sc->symbol_table, i); is_not_null(x); x = cdr(x))
-      if (symbol_func(symbol_name(car(x)), data))
-	return(true);
+  for (s7_int i = 0; i <= sc->symbol_table_mask; i++)
+    if ((symbol_slot_is_live(sc, &sc->symbol_table[i])) &&
+	(symbol_func(symbol_name(car(sc->symbol_table[i].entry)), data)))
+      return(true);
   return(false);
 }
 
@@ -8481,17 +9036,16 @@ static void remove_gensym_from_symbol_table(s7_scheme *sc, s7_pointer sym)
 {
   /* sym is a free cell at this point (we're called after the GC), but the name_cell is still intact */
   s7_pointer name = symbol_name_cell(sym);
-  uint32_t location = string_hash(name) % SYMBOL_TABLE_SIZE;
-  s7_pointer x = vector_element(sc->symbol_table, location);
-  if (car(x) == sym)
-    vector_element(sc->symbol_table, location) = cdr(x);
-  else
-    for (s7_pointer y = x, z = cdr(x); is_pair(z); y = z, z = cdr(z))
-      if (car(z) == sym)
-	{
-	  set_cdr(y, cdr(z));
-	  return;
-	}
+  symbol_slot_t *table = sc->symbol_table;
+  uint64_t slot_hash = symbol_slot_hash(string_hash(name), string_value(name), string_length(name));
+  for (s7_int i = (s7_int)(slot_hash >> sc->symbol_table_shift); table[i].entry; i = (i + 1) & sc->symbol_table_mask)
+    if ((table[i].hash == slot_hash) && (table[i].entry != sc->unused) && (car(table[i].entry) == sym))
+      {
+	table[i].entry = sc->unused; /* [c4augustus] probes step over it, the next resize drops it */
+	sc->symbol_table_entries--;
+	sc->symbol_table_removed++;
+	return;
+      }
 }
 
 s7_pointer s7_gensym(s7_scheme *sc, const char *prefix)
@@ -8504,8 +9058,7 @@ s7_pointer s7_gensym(s7_scheme *sc, const char *prefix)
   {
     s7_int slen = catstrs(name, len, "{", (prefix) ? prefix : "", "}-", pos_int_to_str_direct(sc, sc->gensym_counter++), (char *)NULL);
     uint64_t hash = raw_string_hash((const uint8_t *)name, slen);
-    int32_t location = hash % SYMBOL_TABLE_SIZE;
-    s7_pointer x = new_symbol(sc, name, slen, hash, location);  /* not T_GENSYM -- might be called from outside */
+    s7_pointer x = new_symbol(sc, name, slen, hash);  /* not T_GENSYM -- might be called from outside */
     liberate(sc, b);
     return(x);
   }
@@ -8528,7 +9081,6 @@ static s7_pointer g_gensym(s7_scheme *sc, s7_pointer args)
   const char *prefix;
   char *name, *p, *base;
   s7_int len, plen, nlen;
-  uint32_t location;
   uint64_t hash;
   s7_pointer x, str, stc;
   block_t *b, *ib;
@@ -8565,9 +9117,8 @@ static s7_pointer g_gensym(s7_scheme *sc, s7_pointer args)
   memcpy((void *)(name + plen + 3), (void *)p, len);
   nlen = len + plen + 2;
   hash = raw_string_hash((const uint8_t *)name, nlen);
-  location = hash % SYMBOL_TABLE_SIZE;
 
-  if ((WITH_WARNINGS) && (!is_null(symbol_table_find_by_name(sc, name, hash, location, nlen))))
+  if ((WITH_WARNINGS) && (symbol_table_find(sc, name, nlen, hash)))
     s7_warn(sc, nlen + 32, "%s is already in use!", name);
 
   /* make-string for symbol name */
@@ -8593,11 +9144,11 @@ static s7_pointer g_gensym(s7_scheme *sc, s7_pointer args)
   if (S7_DEBUGGING) full_type(stc) = 0;
   set_full_type(stc, T_PAIR | T_IMMUTABLE | T_UNHEAP);
   set_car(stc, x);
-  set_cdr(stc, vector_element(sc->symbol_table, location));
-  vector_element(sc->symbol_table, location) = stc;
+  set_cdr(stc, sc->nil);
   pair_set_raw_hash(stc, hash);
   pair_set_raw_len(stc, (uint64_t)string_length(str));
   pair_set_raw_name(stc, string_value(str));
+  add_to_symbol_table(sc, stc, name, nlen, hash); /* [c4augustus] */
 
   add_gensym(sc, x);
   return(x);
@@ -8974,7 +9525,7 @@ static s7_pointer reuse_as_let(s7_scheme *sc, s7_pointer let, s7_pointer next_le
   let->debugger_bits = 0;
   if (!in_heap(let)) {fprintf(stderr, "reusing an unheaped %s as a let?\n", s7_type_names[type(let)]); abort();}
 #endif
-  set_full_type(T_Pair(let), T_LET | T_SAFE_PROCEDURE);
+  set_full_type(T_Pair(let), T_LET | T_SAFE_PROCEDURE | (full_type(let) & T_GC_MARK)); /* [c4augustus] keep the mark for s7_gc_sweep_step */
   let_set_slots(let, slot_end);
   let_set_outlet(let, next_let);
   let_set_id(let, ++sc->let_number);
@@ -8983,7 +9534,7 @@ static s7_pointer reuse_as_let(s7_scheme *sc, s7_pointer let, s7_pointer next_le
 
 static s7_pointer reuse_as_slot(s7_pointer slot, s7_pointer symbol, s7_pointer value)
 {
-  set_full_type(T_Pair(slot), T_SLOT);
+  set_full_type(T_Pair(slot), T_SLOT | (full_type(slot) & T_GC_MARK)); /* [c4augustus] keep the mark for s7_gc_sweep_step */
   slot_set_symbol_and_value(slot, symbol, value);
   return(slot);
 }
@@ -9271,7 +9822,6 @@ static void init_unlet(s7_scheme *sc)
 {
   int32_t k = 0;
   s7_pointer *inits;
-  s7_pointer *els = vector_elements(sc->symbol_table);
   block_t *block = mallocate(sc, UNLET_ENTRIES * sizeof(s7_pointer));
   sc->unlet = (s7_pointer)Calloc(1, sizeof(s7_cell));  /* freed explicitly in s7_free */
   set_full_type(sc->unlet, T_VECTOR | T_UNHEAP);
@@ -9285,10 +9835,10 @@ static void init_unlet(s7_scheme *sc)
   s7_vector_fill(sc, sc->unlet, sc->nil);
 
   inits[k++] = initial_slot(sc->else_symbol);
-  for (int32_t i = 0; i < SYMBOL_TABLE_SIZE; i++)
-    for (s7_pointer x = els[i]; is_pair(x); x = cdr(x))
+  for (s7_int i = 0; i <= sc->symbol_table_mask; i++)
+    if (symbol_slot_is_live(sc, &sc->symbol_table[i]))
       {
-	s7_pointer sym = car(x);
+	s7_pointer sym = car(sc->symbol_table[i].entry);
 	if ((!is_gensym(sym)) && (is_slot(initial_slot(sym))))
 	  {
 	    s7_pointer val = initial_value(sym);
@@ -10501,6 +11051,14 @@ s7_pointer s7_symbol_local_value(s7_scheme *sc, s7_pointer sym, s7_pointer let)
 /* -------------------------------- symbol->value -------------------------------- */
 #define lookup_global(Sc, Sym) ((is_global(Sym)) ? global_value(Sym) : lookup_checked(Sc, Sym))
 
+/* [c4augustus] the head of a call whose symbol has only ever been bound at top level (set_local clears
+ *   T_GLOBAL for good the first time a let, parameter, define or varlet binds it anywhere else)
+ *   resolves to its global slot, so checking the function cached at the call site is a bit test
+ *   and a load instead of a walk out through every let to the rootlet, which matters once
+ *   a reload has redefined the function and symbol_ctr no longer short-circuits closure_is_ok
+ */
+#define lookup_call_head(Sc, Sym) ((is_global(Sym)) ? global_value(Sym) : lookup_unexamined(Sc, Sym))
+
 static s7_pointer s7_starlet(s7_scheme *sc, s7_int choice);
 
 static s7_pointer g_symbol_to_value(s7_scheme *sc, s7_pointer args)
@@ -10770,7 +11328,7 @@ static s7_pointer make_macro(s7_scheme *sc, opcode_t op, bool named)
 
       if (((op == OP_DEFINE_EXPANSION) || (op == OP_DEFINE_EXPANSION_STAR)) &&
 	  (!is_let(sc->curlet)))
-	set_full_type(mac_name, T_EXPANSION | T_SYMBOL | (full_type(mac_name) & T_UNHEAP));
+	set_full_type(mac_name, T_EXPANSION | T_SYMBOL | (full_type(mac_name) & (T_UNHEAP | T_GC_MARK))); // [c4augustus]
 
       /* symbol? macro name has already been checked, find name in let, and define it */
       mac_slot = symbol_to_local_slot(sc, mac_name, sc->curlet); /* returns global_slot(symbol) if sc->curlet == nil */
@@ -13701,15 +14259,6 @@ static dtoa_np dtoa_find_cachedpow10(int exp, int* k)
 #define dtoa_absv(n)   ((n) < 0 ? -(n) : (n))
 #define dtoa_minv(a, b) ((a) < (b) ? (a) : (b))
 
-static uint64_t dtoa_tens[] =
-  { 10000000000000000000U, 1000000000000000000U, 100000000000000000U,
-    10000000000000000U, 1000000000000000U, 100000000000000U,
-    10000000000000U, 1000000000000U, 100000000000U,
-    10000000000U, 1000000000U, 100000000U,
-    10000000U, 1000000U, 100000U,
-    10000U, 1000U, 100U,
-    10U, 1U};
-
 static uint64_t dtoa_get_dbits(double d)
 {
   union {double dbl; uint64_t i;} dbl_bits = {d};
@@ -13756,7 +14305,7 @@ static void dtoa_get_normalized_boundaries(dtoa_np* fp, dtoa_np* lower, dtoa_np*
   u_shift = 64 - 52 - 2;
   upper->frac <<= u_shift;
   upper->exp = upper->exp - u_shift;
-  l_shift = fp->frac == dtoa_hiddenbit ? 2 : 1;
+  l_shift = ((fp->frac == dtoa_hiddenbit) && (fp->exp != -dtoa_expbias + 1)) ? 2 : 1; /* [c4augustus] not for the smallest normal */
   lower->frac = (fp->frac << l_shift) - 1;
   lower->exp = fp->exp - l_shift;
   lower->frac <<= lower->exp - upper->exp;
@@ -13779,70 +14328,76 @@ static dtoa_np dtoa_multiply(dtoa_np* a, dtoa_np* b)
   return(fp);
 }
 
-static void dtoa_round_digit(char* digits, int32_t ndigits, uint64_t delta, uint64_t rem, uint64_t kappa, uint64_t frac)
+/* [c4augustus] grisu3 in place of fpconv's grisu2: digit generation runs on the
+ *   widened interval of the scaled boundaries, then "weeds" the last digit toward
+ *   the exact value; when the 64-bit approximation cannot prove the result is both
+ *   the shortest and the closest (about 0.5% of doubles) it reports failure and
+ *   dtoa_shortest_fallback searches with snprintf/strtod instead
+ *   (after Loitsch, "Printing Floating-Point Numbers Quickly and Accurately with Integers")
+ */
+static bool dtoa_round_weed(char *digits, int32_t ndigits, uint64_t distance_too_high_w, uint64_t unsafe_interval,
+			    uint64_t rest, uint64_t ten_kappa, uint64_t unit)
 {
-  while ((rem < frac) && (delta - rem >= kappa) &&
-	 ((rem + kappa < frac) || (frac - rem > rem + kappa - frac)))
+  uint64_t small_distance = distance_too_high_w - unit;
+  uint64_t big_distance = distance_too_high_w + unit;
+  while ((rest < small_distance) && (unsafe_interval - rest >= ten_kappa) &&
+	 ((rest + ten_kappa < small_distance) || (small_distance - rest >= rest + ten_kappa - small_distance)))
     {
       digits[ndigits - 1]--;
-      rem += kappa;
+      rest += ten_kappa;
     }
+  if ((rest < big_distance) && (unsafe_interval - rest >= ten_kappa) &&
+      ((rest + ten_kappa < big_distance) || (big_distance - rest > rest + ten_kappa - big_distance)))
+    return(false);
+  return((2 * unit <= rest) && (rest <= unsafe_interval - 4 * unit));
 }
 
-static int32_t dtoa_generate_digits(dtoa_np* fp, dtoa_np* upper, dtoa_np* lower, char* digits, int* K)
+static bool dtoa_generate_digits(dtoa_np *lower, dtoa_np *w, dtoa_np *upper, char *digits, int32_t *ndigits, int32_t *kappa)
 {
-  uint64_t part1, part2, wfrac = upper->frac - fp->frac, delta = upper->frac - lower->frac;
-  uint64_t *unit;
-  int32_t idx = 0, kappa = 10;
-  dtoa_np one;
+  uint64_t unit = 1, too_low = lower->frac - unit, too_high = upper->frac + unit;
+  uint64_t unsafe_interval = too_high - too_low;
+  uint64_t one = 1ULL << -w->exp;
+  uint32_t integrals = (uint32_t)(too_high >> -w->exp);
+  uint64_t fractionals = too_high & (one - 1);
+  uint32_t divisor = 1;
+  int32_t idx = 0;
 
-  one.frac = 1ULL << -upper->exp;
-  one.exp  = upper->exp;
-  part1 = upper->frac >> -one.exp;
-  part2 = upper->frac & (one.frac - 1);
-
-  /* 1000000000 */
-  for (uint64_t *divp = dtoa_tens + 10; kappa > 0; divp++)
+  /* integrals is at least 8 since the scaled values have their top bit set */
+  for (*kappa = 1; (*kappa < 10) && ((uint64_t)divisor * 10 <= integrals); (*kappa)++)
+    divisor *= 10;
+  while (*kappa > 0)
     {
-      uint64_t tmp, div = *divp;
-      unsigned digit = part1 / div;
-      if (digit || idx)
-	digits[idx++] = digit + '0';
-      part1 -= digit * div;
-      kappa--;
-      tmp = (part1 << -one.exp) + part2;
-      if (tmp <= delta)
+      uint64_t rest;
+      digits[idx++] = (char)('0' + integrals / divisor);
+      integrals %= divisor;
+      (*kappa)--;
+      rest = ((uint64_t)integrals << -w->exp) + fractionals;
+      if (rest < unsafe_interval)
 	{
-	  *K += kappa;
-	  dtoa_round_digit(digits, idx, delta, tmp, div << -one.exp, wfrac);
-	  return(idx);
-        }}
-
-  /* 10 */
-  unit = dtoa_tens + 18;
-  while(true)
+	  *ndigits = idx;
+	  return(dtoa_round_weed(digits, idx, too_high - w->frac, unsafe_interval, rest, (uint64_t)divisor << -w->exp, unit));
+	}
+      divisor /= 10;
+    }
+  while (true)
     {
-      unsigned digit;
-      part2 *= 10;
-      delta *= 10;
-      kappa--;
-      digit = part2 >> -one.exp;
-      if (digit || idx)
-	digits[idx++] = digit + '0';
-      part2 &= one.frac - 1;
-      if (part2 < delta)
+      fractionals *= 10;
+      unit *= 10;
+      unsafe_interval *= 10;
+      digits[idx++] = (char)('0' + (fractionals >> -w->exp));
+      fractionals &= one - 1;
+      (*kappa)--;
+      if (fractionals < unsafe_interval)
 	{
-	  *K += kappa;
-	  dtoa_round_digit(digits, idx, delta, part2, one.frac, wfrac * *unit);
-	  return(idx);
+	  *ndigits = idx;
+	  return(dtoa_round_weed(digits, idx, (too_high - w->frac) * unit, unsafe_interval, fractionals, one, unit));
 	}
-      unit--;
     }
 }
 
-static int32_t dtoa_grisu2(double d, char* digits, int* K)
+static int32_t dtoa_grisu3(double d, char *digits, int32_t *K)
 {
-  int32_t k;
+  int32_t k, kappa, ndigits;
   dtoa_np cp, lower, upper;
   dtoa_np w = dtoa_build_np(d);
   dtoa_get_normalized_boundaries(&w, &lower, &upper);
@@ -13851,10 +14406,32 @@ static int32_t dtoa_grisu2(double d, char* digits, int* K)
   w = dtoa_multiply(&w, &cp);
   upper = dtoa_multiply(&upper, &cp);
   lower = dtoa_multiply(&lower, &cp);
-  lower.frac++;
-  upper.frac--;
-  *K = -k;
-  return(dtoa_generate_digits(&w, &upper, &lower, digits, K));
+  if (!dtoa_generate_digits(&lower, &w, &upper, digits, &ndigits, &kappa))
+    return(0);
+  *K = -k + kappa;
+  return(ndigits);
+}
+
+static int32_t dtoa_shortest_fallback(double d, char *digits, int32_t *K)
+{
+  /* the first precision that reads back as d is the shortest, and %e rounds to the closest such string */
+  char buf[32];
+  int32_t ndigits = 0;
+  for (int32_t prec = 0; prec < 17; prec++)
+    {
+      snprintf(buf, 32, "%.*e", prec, d);
+      if (strtod(buf, NULL) == d) break;
+    }
+  for (char *p = (buf[0] == '-') ? buf + 1 : buf; *p != 'e'; p++)
+    if ((*p >= '0') && (*p <= '9')) /* the point is LANG's */
+      digits[ndigits++] = *p;
+  *K = (int32_t)strtol(strchr(buf, 'e') + 1, NULL, 10) - ndigits + 1;
+  while ((ndigits > 1) && (digits[ndigits - 1] == '0'))
+    {
+      ndigits--;
+      (*K)++;
+    }
+  return(ndigits);
 }
 
 static int32_t dtoa_emit_digits(char* digits, int32_t ndigits, char* dest, int32_t K, bool neg)
@@ -13961,7 +14538,7 @@ static int32_t dtoa_filter_special(double fp, char* dest, bool neg)
 
 static inline int32_t fpconv_dtoa(double d, char dest[24])
 {
-  char digit[23];
+  char digit[24];
   int32_t str_len = 0, spec, K, ndigits;
   bool neg = false;
 
@@ -13974,7 +14551,9 @@ static inline int32_t fpconv_dtoa(double d, char dest[24])
   spec = dtoa_filter_special(d, dest + str_len, neg);
   if (spec) return(str_len + spec);
   K = 0;
-  ndigits = dtoa_grisu2(d, digit, &K);
+  ndigits = dtoa_grisu3(d, digit, &K);
+  if (ndigits == 0)
+    ndigits = dtoa_shortest_fallback(d, digit, &K);
   str_len += dtoa_emit_digits(digit, ndigits, dest + str_len, K, neg);
   return(str_len);
 }
@@ -14889,28 +15468,31 @@ static s7_int string_to_integer(const char *str, int32_t radix, bool *overflow)
 #endif
  if (radix == 10)
     {
-      while (true)
+      /* [c4augustus] 18 digits cannot overflow, so only the ones past that are checked, against the
+       *   magnitude limit instead of per-step overflow builtins (which some compilers lack)
+       */
+      uint64_t uval = 0, limit = (negative) ? ((uint64_t)S7_INT64_MAX + 1) : (uint64_t)S7_INT64_MAX;
+      const char *start = tmp;
+      while (((dig = digits[(uint8_t)(*tmp)]) <= 9) && (tmp - start < 18))
 	{
-	  dig = digits[(uint8_t)(*tmp++)];
-	  if (dig > 9) break;
-#if HAVE_OVERFLOW_CHECKS
-	  if ((multiply_overflow(lval, (s7_int)10, &lval)) ||
-	      (add_overflow(lval, (s7_int)dig, &lval)))
+	  uval = uval * 10 + dig;
+	  tmp++;
+	}
+      while ((dig = digits[(uint8_t)(*tmp)]) <= 9)
+	{
+	  if (uval > (limit - dig) / 10)
 	    {
-	      if ((radix == 10) &&
-		  (strncmp(str, "-9223372036854775808", 20) == 0) &&
-		  (digits[(uint8_t)(*tmp++)] > 9)) /* i.e. next thing is not a digit -- "/" for example */
-		return(S7_INT64_MIN);
 	      *overflow = true;
 	      return((negative) ? S7_INT64_MIN : S7_INT64_MAX);
 	    }
-#else
-	  lval = dig + (lval * 10);
-	  dig = digits[(uint8_t)(*tmp++)];
-	  if (dig > 9) break;
-	  lval = dig + (lval * 10);
-#endif
-	}}
+	  uval = uval * 10 + dig;
+	  tmp++;
+	}
+      tmp++;
+      if (uval > (uint64_t)S7_INT64_MAX) /* -9223372036854775808 */
+	return(S7_INT64_MIN);
+      lval = (s7_int)uval;
+    }
   else
     while (true)
       {
@@ -14970,6 +15552,555 @@ static s7_int string_to_integer(const char *str, int32_t radix, bool *overflow)
  * 1.0e00000000000000000001           10.0
  */
 
+/* [c4augustus] correctly rounded base 10 string->double for the reader and string->number:
+ *   the first 19 significant digits are gathered into w with the decimal exponent q, so the
+ *   number is w * 10^q.  Small exact cases use Clinger's fast path (w <= 2^53, |q| <= 22),
+ *   the rest Eisel-Lemire (w times a 128-bit truncation of 5^q, which Mushtak and Lemire show
+ *   is always enough to round correctly).  When digits past the 19th were dropped and w and w+1
+ *   round differently, strtod settles it on a "<digits>e<exp>" copy that has no decimal point
+ *   for LANG to misread.
+ */
+#define DEC_MIN_POW5  -342
+#define DEC_MAX_POW10  308
+#define DEC_INF_BITS   0x7FF0000000000000U
+#define DEC_FRAC_MASK  0x000FFFFFFFFFFFFFU
+#define DEC_SLOW_DIGITS 780 /* past ~770 significant digits the rest can only break a tie */
+
+static const uint64_t dec_pow5_128[] = { /* 5^q for q = -342..308, high word then low word */
+    0xeef453d6923bd65aU, 0x113faa2906a13b3fU, 0x9558b4661b6565f8U, 0x4ac7ca59a424c507U,
+    0xbaaee17fa23ebf76U, 0x5d79bcf00d2df649U, 0xe95a99df8ace6f53U, 0xf4d82c2c107973dcU,
+    0x91d8a02bb6c10594U, 0x79071b9b8a4be869U, 0xb64ec836a47146f9U, 0x9748e2826cdee284U,
+    0xe3e27a444d8d98b7U, 0xfd1b1b2308169b25U, 0x8e6d8c6ab0787f72U, 0xfe30f0f5e50e20f7U,
+    0xb208ef855c969f4fU, 0xbdbd2d335e51a935U, 0xde8b2b66b3bc4723U, 0xad2c788035e61382U,
+    0x8b16fb203055ac76U, 0x4c3bcb5021afcc31U, 0xaddcb9e83c6b1793U, 0xdf4abe242a1bbf3dU,
+    0xd953e8624b85dd78U, 0xd71d6dad34a2af0dU, 0x87d4713d6f33aa6bU, 0x8672648c40e5ad68U,
+    0xa9c98d8ccb009506U, 0x680efdaf511f18c2U, 0xd43bf0effdc0ba48U, 0x0212bd1b2566def2U,
+    0x84a57695fe98746dU, 0x014bb630f7604b57U, 0xa5ced43b7e3e9188U, 0x419ea3bd35385e2dU,
+    0xcf42894a5dce35eaU, 0x52064cac828675b9U, 0x818995ce7aa0e1b2U, 0x7343efebd1940993U,
+    0xa1ebfb4219491a1fU, 0x1014ebe6c5f90bf8U, 0xca66fa129f9b60a6U, 0xd41a26e077774ef6U,
+    0xfd00b897478238d0U, 0x8920b098955522b4U, 0x9e20735e8cb16382U, 0x55b46e5f5d5535b0U,
+    0xc5a890362fddbc62U, 0xeb2189f734aa831dU, 0xf712b443bbd52b7bU, 0xa5e9ec7501d523e4U,
+    0x9a6bb0aa55653b2dU, 0x47b233c92125366eU, 0xc1069cd4eabe89f8U, 0x999ec0bb696e840aU,
+    0xf148440a256e2c76U, 0xc00670ea43ca250dU, 0x96cd2a865764dbcaU, 0x380406926a5e5728U,
+    0xbc807527ed3e12bcU, 0xc605083704f5ecf2U, 0xeba09271e88d976bU, 0xf7864a44c633682eU,
+    0x93445b8731587ea3U, 0x7ab3ee6afbe0211dU, 0xb8157268fdae9e4cU, 0x5960ea05bad82964U,
+    0xe61acf033d1a45dfU, 0x6fb92487298e33bdU, 0x8fd0c16206306babU, 0xa5d3b6d479f8e056U,
+    0xb3c4f1ba87bc8696U, 0x8f48a4899877186cU, 0xe0b62e2929aba83cU, 0x331acdabfe94de87U,
+    0x8c71dcd9ba0b4925U, 0x9ff0c08b7f1d0b14U, 0xaf8e5410288e1b6fU, 0x07ecf0ae5ee44dd9U,
+    0xdb71e91432b1a24aU, 0xc9e82cd9f69d6150U, 0x892731ac9faf056eU, 0xbe311c083a225cd2U,
+    0xab70fe17c79ac6caU, 0x6dbd630a48aaf406U, 0xd64d3d9db981787dU, 0x092cbbccdad5b108U,
+    0x85f0468293f0eb4eU, 0x25bbf56008c58ea5U, 0xa76c582338ed2621U, 0xaf2af2b80af6f24eU,
+    0xd1476e2c07286faaU, 0x1af5af660db4aee1U, 0x82cca4db847945caU, 0x50d98d9fc890ed4dU,
+    0xa37fce126597973cU, 0xe50ff107bab528a0U, 0xcc5fc196fefd7d0cU, 0x1e53ed49a96272c8U,
+    0xff77b1fcbebcdc4fU, 0x25e8e89c13bb0f7aU, 0x9faacf3df73609b1U, 0x77b191618c54e9acU,
+    0xc795830d75038c1dU, 0xd59df5b9ef6a2417U, 0xf97ae3d0d2446f25U, 0x4b0573286b44ad1dU,
+    0x9becce62836ac577U, 0x4ee367f9430aec32U, 0xc2e801fb244576d5U, 0x229c41f793cda73fU,
+    0xf3a20279ed56d48aU, 0x6b43527578c1110fU, 0x9845418c345644d6U, 0x830a13896b78aaa9U,
+    0xbe5691ef416bd60cU, 0x23cc986bc656d553U, 0xedec366b11c6cb8fU, 0x2cbfbe86b7ec8aa8U,
+    0x94b3a202eb1c3f39U, 0x7bf7d71432f3d6a9U, 0xb9e08a83a5e34f07U, 0xdaf5ccd93fb0cc53U,
+    0xe858ad248f5c22c9U, 0xd1b3400f8f9cff68U, 0x91376c36d99995beU, 0x23100809b9c21fa1U,
+    0xb58547448ffffb2dU, 0xabd40a0c2832a78aU, 0xe2e69915b3fff9f9U, 0x16c90c8f323f516cU,
+    0x8dd01fad907ffc3bU, 0xae3da7d97f6792e3U, 0xb1442798f49ffb4aU, 0x99cd11cfdf41779cU,
+    0xdd95317f31c7fa1dU, 0x40405643d711d583U, 0x8a7d3eef7f1cfc52U, 0x482835ea666b2572U,
+    0xad1c8eab5ee43b66U, 0xda3243650005eecfU, 0xd863b256369d4a40U, 0x90bed43e40076a82U,
+    0x873e4f75e2224e68U, 0x5a7744a6e804a291U, 0xa90de3535aaae202U, 0x711515d0a205cb36U,
+    0xd3515c2831559a83U, 0x0d5a5b44ca873e03U, 0x8412d9991ed58091U, 0xe858790afe9486c2U,
+    0xa5178fff668ae0b6U, 0x626e974dbe39a872U, 0xce5d73ff402d98e3U, 0xfb0a3d212dc8128fU,
+    0x80fa687f881c7f8eU, 0x7ce66634bc9d0b99U, 0xa139029f6a239f72U, 0x1c1fffc1ebc44e80U,
+    0xc987434744ac874eU, 0xa327ffb266b56220U, 0xfbe9141915d7a922U, 0x4bf1ff9f0062baa8U,
+    0x9d71ac8fada6c9b5U, 0x6f773fc3603db4a9U, 0xc4ce17b399107c22U, 0xcb550fb4384d21d3U,
+    0xf6019da07f549b2bU, 0x7e2a53a146606a48U, 0x99c102844f94e0fbU, 0x2eda7444cbfc426dU,
+    0xc0314325637a1939U, 0xfa911155fefb5308U, 0xf03d93eebc589f88U, 0x793555ab7eba27caU,
+    0x96267c7535b763b5U, 0x4bc1558b2f3458deU, 0xbbb01b9283253ca2U, 0x9eb1aaedfb016f16U,
+    0xea9c227723ee8bcbU, 0x465e15a979c1cadcU, 0x92a1958a7675175fU, 0x0bfacd89ec191ec9U,
+    0xb749faed14125d36U, 0xcef980ec671f667bU, 0xe51c79a85916f484U, 0x82b7e12780e7401aU,
+    0x8f31cc0937ae58d2U, 0xd1b2ecb8b0908810U, 0xb2fe3f0b8599ef07U, 0x861fa7e6dcb4aa15U,
+    0xdfbdcece67006ac9U, 0x67a791e093e1d49aU, 0x8bd6a141006042bdU, 0xe0c8bb2c5c6d24e0U,
+    0xaecc49914078536dU, 0x58fae9f773886e18U, 0xda7f5bf590966848U, 0xaf39a475506a899eU,
+    0x888f99797a5e012dU, 0x6d8406c952429603U, 0xaab37fd7d8f58178U, 0xc8e5087ba6d33b83U,
+    0xd5605fcdcf32e1d6U, 0xfb1e4a9a90880a64U, 0x855c3be0a17fcd26U, 0x5cf2eea09a55067fU,
+    0xa6b34ad8c9dfc06fU, 0xf42faa48c0ea481eU, 0xd0601d8efc57b08bU, 0xf13b94daf124da26U,
+    0x823c12795db6ce57U, 0x76c53d08d6b70858U, 0xa2cb1717b52481edU, 0x54768c4b0c64ca6eU,
+    0xcb7ddcdda26da268U, 0xa9942f5dcf7dfd09U, 0xfe5d54150b090b02U, 0xd3f93b35435d7c4cU,
+    0x9efa548d26e5a6e1U, 0xc47bc5014a1a6dafU, 0xc6b8e9b0709f109aU, 0x359ab6419ca1091bU,
+    0xf867241c8cc6d4c0U, 0xc30163d203c94b62U, 0x9b407691d7fc44f8U, 0x79e0de63425dcf1dU,
+    0xc21094364dfb5636U, 0x985915fc12f542e4U, 0xf294b943e17a2bc4U, 0x3e6f5b7b17b2939dU,
+    0x979cf3ca6cec5b5aU, 0xa705992ceecf9c42U, 0xbd8430bd08277231U, 0x50c6ff782a838353U,
+    0xece53cec4a314ebdU, 0xa4f8bf5635246428U, 0x940f4613ae5ed136U, 0x871b7795e136be99U,
+    0xb913179899f68584U, 0x28e2557b59846e3fU, 0xe757dd7ec07426e5U, 0x331aeada2fe589cfU,
+    0x9096ea6f3848984fU, 0x3ff0d2c85def7621U, 0xb4bca50b065abe63U, 0x0fed077a756b53a9U,
+    0xe1ebce4dc7f16dfbU, 0xd3e8495912c62894U, 0x8d3360f09cf6e4bdU, 0x64712dd7abbbd95cU,
+    0xb080392cc4349decU, 0xbd8d794d96aacfb3U, 0xdca04777f541c567U, 0xecf0d7a0fc5583a0U,
+    0x89e42caaf9491b60U, 0xf41686c49db57244U, 0xac5d37d5b79b6239U, 0x311c2875c522ced5U,
+    0xd77485cb25823ac7U, 0x7d633293366b828bU, 0x86a8d39ef77164bcU, 0xae5dff9c02033197U,
+    0xa8530886b54dbdebU, 0xd9f57f830283fdfcU, 0xd267caa862a12d66U, 0xd072df63c324fd7bU,
+    0x8380dea93da4bc60U, 0x4247cb9e59f71e6dU, 0xa46116538d0deb78U, 0x52d9be85f074e608U,
+    0xcd795be870516656U, 0x67902e276c921f8bU, 0x806bd9714632dff6U, 0x00ba1cd8a3db53b6U,
+    0xa086cfcd97bf97f3U, 0x80e8a40eccd228a4U, 0xc8a883c0fdaf7df0U, 0x6122cd128006b2cdU,
+    0xfad2a4b13d1b5d6cU, 0x796b805720085f81U, 0x9cc3a6eec6311a63U, 0xcbe3303674053bb0U,
+    0xc3f490aa77bd60fcU, 0xbedbfc4411068a9cU, 0xf4f1b4d515acb93bU, 0xee92fb5515482d44U,
+    0x991711052d8bf3c5U, 0x751bdd152d4d1c4aU, 0xbf5cd54678eef0b6U, 0xd262d45a78a0635dU,
+    0xef340a98172aace4U, 0x86fb897116c87c34U, 0x9580869f0e7aac0eU, 0xd45d35e6ae3d4da0U,
+    0xbae0a846d2195712U, 0x8974836059cca109U, 0xe998d258869facd7U, 0x2bd1a438703fc94bU,
+    0x91ff83775423cc06U, 0x7b6306a34627ddcfU, 0xb67f6455292cbf08U, 0x1a3bc84c17b1d542U,
+    0xe41f3d6a7377eecaU, 0x20caba5f1d9e4a93U, 0x8e938662882af53eU, 0x547eb47b7282ee9cU,
+    0xb23867fb2a35b28dU, 0xe99e619a4f23aa43U, 0xdec681f9f4c31f31U, 0x6405fa00e2ec94d4U,
+    0x8b3c113c38f9f37eU, 0xde83bc408dd3dd04U, 0xae0b158b4738705eU, 0x9624ab50b148d445U,
+    0xd98ddaee19068c76U, 0x3badd624dd9b0957U, 0x87f8a8d4cfa417c9U, 0xe54ca5d70a80e5d6U,
+    0xa9f6d30a038d1dbcU, 0x5e9fcf4ccd211f4cU, 0xd47487cc8470652bU, 0x7647c3200069671fU,
+    0x84c8d4dfd2c63f3bU, 0x29ecd9f40041e073U, 0xa5fb0a17c777cf09U, 0xf468107100525890U,
+    0xcf79cc9db955c2ccU, 0x7182148d4066eeb4U, 0x81ac1fe293d599bfU, 0xc6f14cd848405530U,
+    0xa21727db38cb002fU, 0xb8ada00e5a506a7cU, 0xca9cf1d206fdc03bU, 0xa6d90811f0e4851cU,
+    0xfd442e4688bd304aU, 0x908f4a166d1da663U, 0x9e4a9cec15763e2eU, 0x9a598e4e043287feU,
+    0xc5dd44271ad3cdbaU, 0x40eff1e1853f29fdU, 0xf7549530e188c128U, 0xd12bee59e68ef47cU,
+    0x9a94dd3e8cf578b9U, 0x82bb74f8301958ceU, 0xc13a148e3032d6e7U, 0xe36a52363c1faf01U,
+    0xf18899b1bc3f8ca1U, 0xdc44e6c3cb279ac1U, 0x96f5600f15a7b7e5U, 0x29ab103a5ef8c0b9U,
+    0xbcb2b812db11a5deU, 0x7415d448f6b6f0e7U, 0xebdf661791d60f56U, 0x111b495b3464ad21U,
+    0x936b9fcebb25c995U, 0xcab10dd900beec34U, 0xb84687c269ef3bfbU, 0x3d5d514f40eea742U,
+    0xe65829b3046b0afaU, 0x0cb4a5a3112a5112U, 0x8ff71a0fe2c2e6dcU, 0x47f0e785eaba72abU,
+    0xb3f4e093db73a093U, 0x59ed216765690f56U, 0xe0f218b8d25088b8U, 0x306869c13ec3532cU,
+    0x8c974f7383725573U, 0x1e414218c73a13fbU, 0xafbd2350644eeacfU, 0xe5d1929ef90898faU,
+    0xdbac6c247d62a583U, 0xdf45f746b74abf39U, 0x894bc396ce5da772U, 0x6b8bba8c328eb783U,
+    0xab9eb47c81f5114fU, 0x066ea92f3f326564U, 0xd686619ba27255a2U, 0xc80a537b0efefebdU,
+    0x8613fd0145877585U, 0xbd06742ce95f5f36U, 0xa798fc4196e952e7U, 0x2c48113823b73704U,
+    0xd17f3b51fca3a7a0U, 0xf75a15862ca504c5U, 0x82ef85133de648c4U, 0x9a984d73dbe722fbU,
+    0xa3ab66580d5fdaf5U, 0xc13e60d0d2e0ebbaU, 0xcc963fee10b7d1b3U, 0x318df905079926a8U,
+    0xffbbcfe994e5c61fU, 0xfdf17746497f7052U, 0x9fd561f1fd0f9bd3U, 0xfeb6ea8bedefa633U,
+    0xc7caba6e7c5382c8U, 0xfe64a52ee96b8fc0U, 0xf9bd690a1b68637bU, 0x3dfdce7aa3c673b0U,
+    0x9c1661a651213e2dU, 0x06bea10ca65c084eU, 0xc31bfa0fe5698db8U, 0x486e494fcff30a62U,
+    0xf3e2f893dec3f126U, 0x5a89dba3c3efccfaU, 0x986ddb5c6b3a76b7U, 0xf89629465a75e01cU,
+    0xbe89523386091465U, 0xf6bbb397f1135823U, 0xee2ba6c0678b597fU, 0x746aa07ded582e2cU,
+    0x94db483840b717efU, 0xa8c2a44eb4571cdcU, 0xba121a4650e4ddebU, 0x92f34d62616ce413U,
+    0xe896a0d7e51e1566U, 0x77b020baf9c81d17U, 0x915e2486ef32cd60U, 0x0ace1474dc1d122eU,
+    0xb5b5ada8aaff80b8U, 0x0d819992132456baU, 0xe3231912d5bf60e6U, 0x10e1fff697ed6c69U,
+    0x8df5efabc5979c8fU, 0xca8d3ffa1ef463c1U, 0xb1736b96b6fd83b3U, 0xbd308ff8a6b17cb2U,
+    0xddd0467c64bce4a0U, 0xac7cb3f6d05ddbdeU, 0x8aa22c0dbef60ee4U, 0x6bcdf07a423aa96bU,
+    0xad4ab7112eb3929dU, 0x86c16c98d2c953c6U, 0xd89d64d57a607744U, 0xe871c7bf077ba8b7U,
+    0x87625f056c7c4a8bU, 0x11471cd764ad4972U, 0xa93af6c6c79b5d2dU, 0xd598e40d3dd89bcfU,
+    0xd389b47879823479U, 0x4aff1d108d4ec2c3U, 0x843610cb4bf160cbU, 0xcedf722a585139baU,
+    0xa54394fe1eedb8feU, 0xc2974eb4ee658828U, 0xce947a3da6a9273eU, 0x733d226229feea32U,
+    0x811ccc668829b887U, 0x0806357d5a3f525fU, 0xa163ff802a3426a8U, 0xca07c2dcb0cf26f7U,
+    0xc9bcff6034c13052U, 0xfc89b393dd02f0b5U, 0xfc2c3f3841f17c67U, 0xbbac2078d443ace2U,
+    0x9d9ba7832936edc0U, 0xd54b944b84aa4c0dU, 0xc5029163f384a931U, 0x0a9e795e65d4df11U,
+    0xf64335bcf065d37dU, 0x4d4617b5ff4a16d5U, 0x99ea0196163fa42eU, 0x504bced1bf8e4e45U,
+    0xc06481fb9bcf8d39U, 0xe45ec2862f71e1d6U, 0xf07da27a82c37088U, 0x5d767327bb4e5a4cU,
+    0x964e858c91ba2655U, 0x3a6a07f8d510f86fU, 0xbbe226efb628afeaU, 0x890489f70a55368bU,
+    0xeadab0aba3b2dbe5U, 0x2b45ac74ccea842eU, 0x92c8ae6b464fc96fU, 0x3b0b8bc90012929dU,
+    0xb77ada0617e3bbcbU, 0x09ce6ebb40173744U, 0xe55990879ddcaabdU, 0xcc420a6a101d0515U,
+    0x8f57fa54c2a9eab6U, 0x9fa946824a12232dU, 0xb32df8e9f3546564U, 0x47939822dc96abf9U,
+    0xdff9772470297ebdU, 0x59787e2b93bc56f7U, 0x8bfbea76c619ef36U, 0x57eb4edb3c55b65aU,
+    0xaefae51477a06b03U, 0xede622920b6b23f1U, 0xdab99e59958885c4U, 0xe95fab368e45ecedU,
+    0x88b402f7fd75539bU, 0x11dbcb0218ebb414U, 0xaae103b5fcd2a881U, 0xd652bdc29f26a119U,
+    0xd59944a37c0752a2U, 0x4be76d3346f0495fU, 0x857fcae62d8493a5U, 0x6f70a4400c562ddbU,
+    0xa6dfbd9fb8e5b88eU, 0xcb4ccd500f6bb952U, 0xd097ad07a71f26b2U, 0x7e2000a41346a7a7U,
+    0x825ecc24c873782fU, 0x8ed400668c0c28c8U, 0xa2f67f2dfa90563bU, 0x728900802f0f32faU,
+    0xcbb41ef979346bcaU, 0x4f2b40a03ad2ffb9U, 0xfea126b7d78186bcU, 0xe2f610c84987bfa8U,
+    0x9f24b832e6b0f436U, 0x0dd9ca7d2df4d7c9U, 0xc6ede63fa05d3143U, 0x91503d1c79720dbbU,
+    0xf8a95fcf88747d94U, 0x75a44c6397ce912aU, 0x9b69dbe1b548ce7cU, 0xc986afbe3ee11abaU,
+    0xc24452da229b021bU, 0xfbe85badce996168U, 0xf2d56790ab41c2a2U, 0xfae27299423fb9c3U,
+    0x97c560ba6b0919a5U, 0xdccd879fc967d41aU, 0xbdb6b8e905cb600fU, 0x5400e987bbc1c920U,
+    0xed246723473e3813U, 0x290123e9aab23b68U, 0x9436c0760c86e30bU, 0xf9a0b6720aaf6521U,
+    0xb94470938fa89bceU, 0xf808e40e8d5b3e69U, 0xe7958cb87392c2c2U, 0xb60b1d1230b20e04U,
+    0x90bd77f3483bb9b9U, 0xb1c6f22b5e6f48c2U, 0xb4ecd5f01a4aa828U, 0x1e38aeb6360b1af3U,
+    0xe2280b6c20dd5232U, 0x25c6da63c38de1b0U, 0x8d590723948a535fU, 0x579c487e5a38ad0eU,
+    0xb0af48ec79ace837U, 0x2d835a9df0c6d851U, 0xdcdb1b2798182244U, 0xf8e431456cf88e65U,
+    0x8a08f0f8bf0f156bU, 0x1b8e9ecb641b58ffU, 0xac8b2d36eed2dac5U, 0xe272467e3d222f3fU,
+    0xd7adf884aa879177U, 0x5b0ed81dcc6abb0fU, 0x86ccbb52ea94baeaU, 0x98e947129fc2b4e9U,
+    0xa87fea27a539e9a5U, 0x3f2398d747b36224U, 0xd29fe4b18e88640eU, 0x8eec7f0d19a03aadU,
+    0x83a3eeeef9153e89U, 0x1953cf68300424acU, 0xa48ceaaab75a8e2bU, 0x5fa8c3423c052dd7U,
+    0xcdb02555653131b6U, 0x3792f412cb06794dU, 0x808e17555f3ebf11U, 0xe2bbd88bbee40bd0U,
+    0xa0b19d2ab70e6ed6U, 0x5b6aceaeae9d0ec4U, 0xc8de047564d20a8bU, 0xf245825a5a445275U,
+    0xfb158592be068d2eU, 0xeed6e2f0f0d56712U, 0x9ced737bb6c4183dU, 0x55464dd69685606bU,
+    0xc428d05aa4751e4cU, 0xaa97e14c3c26b886U, 0xf53304714d9265dfU, 0xd53dd99f4b3066a8U,
+    0x993fe2c6d07b7fabU, 0xe546a8038efe4029U, 0xbf8fdb78849a5f96U, 0xde98520472bdd033U,
+    0xef73d256a5c0f77cU, 0x963e66858f6d4440U, 0x95a8637627989aadU, 0xdde7001379a44aa8U,
+    0xbb127c53b17ec159U, 0x5560c018580d5d52U, 0xe9d71b689dde71afU, 0xaab8f01e6e10b4a6U,
+    0x9226712162ab070dU, 0xcab3961304ca70e8U, 0xb6b00d69bb55c8d1U, 0x3d607b97c5fd0d22U,
+    0xe45c10c42a2b3b05U, 0x8cb89a7db77c506aU, 0x8eb98a7a9a5b04e3U, 0x77f3608e92adb242U,
+    0xb267ed1940f1c61cU, 0x55f038b237591ed3U, 0xdf01e85f912e37a3U, 0x6b6c46dec52f6688U,
+    0x8b61313bbabce2c6U, 0x2323ac4b3b3da015U, 0xae397d8aa96c1b77U, 0xabec975e0a0d081aU,
+    0xd9c7dced53c72255U, 0x96e7bd358c904a21U, 0x881cea14545c7575U, 0x7e50d64177da2e54U,
+    0xaa242499697392d2U, 0xdde50bd1d5d0b9e9U, 0xd4ad2dbfc3d07787U, 0x955e4ec64b44e864U,
+    0x84ec3c97da624ab4U, 0xbd5af13bef0b113eU, 0xa6274bbdd0fadd61U, 0xecb1ad8aeacdd58eU,
+    0xcfb11ead453994baU, 0x67de18eda5814af2U, 0x81ceb32c4b43fcf4U, 0x80eacf948770ced7U,
+    0xa2425ff75e14fc31U, 0xa1258379a94d028dU, 0xcad2f7f5359a3b3eU, 0x096ee45813a04330U,
+    0xfd87b5f28300ca0dU, 0x8bca9d6e188853fcU, 0x9e74d1b791e07e48U, 0x775ea264cf55347eU,
+    0xc612062576589ddaU, 0x95364afe032a819eU, 0xf79687aed3eec551U, 0x3a83ddbd83f52205U,
+    0x9abe14cd44753b52U, 0xc4926a9672793543U, 0xc16d9a0095928a27U, 0x75b7053c0f178294U,
+    0xf1c90080baf72cb1U, 0x5324c68b12dd6339U, 0x971da05074da7beeU, 0xd3f6fc16ebca5e04U,
+    0xbce5086492111aeaU, 0x88f4bb1ca6bcf585U, 0xec1e4a7db69561a5U, 0x2b31e9e3d06c32e6U,
+    0x9392ee8e921d5d07U, 0x3aff322e62439fd0U, 0xb877aa3236a4b449U, 0x09befeb9fad487c3U,
+    0xe69594bec44de15bU, 0x4c2ebe687989a9b4U, 0x901d7cf73ab0acd9U, 0x0f9d37014bf60a11U,
+    0xb424dc35095cd80fU, 0x538484c19ef38c95U, 0xe12e13424bb40e13U, 0x2865a5f206b06fbaU,
+    0x8cbccc096f5088cbU, 0xf93f87b7442e45d4U, 0xafebff0bcb24aafeU, 0xf78f69a51539d749U,
+    0xdbe6fecebdedd5beU, 0xb573440e5a884d1cU, 0x89705f4136b4a597U, 0x31680a88f8953031U,
+    0xabcc77118461cefcU, 0xfdc20d2b36ba7c3eU, 0xd6bf94d5e57a42bcU, 0x3d32907604691b4dU,
+    0x8637bd05af6c69b5U, 0xa63f9a49c2c1b110U, 0xa7c5ac471b478423U, 0x0fcf80dc33721d54U,
+    0xd1b71758e219652bU, 0xd3c36113404ea4a9U, 0x83126e978d4fdf3bU, 0x645a1cac083126eaU,
+    0xa3d70a3d70a3d70aU, 0x3d70a3d70a3d70a4U, 0xccccccccccccccccU, 0xcccccccccccccccdU,
+    0x8000000000000000U, 0x0000000000000000U, 0xa000000000000000U, 0x0000000000000000U,
+    0xc800000000000000U, 0x0000000000000000U, 0xfa00000000000000U, 0x0000000000000000U,
+    0x9c40000000000000U, 0x0000000000000000U, 0xc350000000000000U, 0x0000000000000000U,
+    0xf424000000000000U, 0x0000000000000000U, 0x9896800000000000U, 0x0000000000000000U,
+    0xbebc200000000000U, 0x0000000000000000U, 0xee6b280000000000U, 0x0000000000000000U,
+    0x9502f90000000000U, 0x0000000000000000U, 0xba43b74000000000U, 0x0000000000000000U,
+    0xe8d4a51000000000U, 0x0000000000000000U, 0x9184e72a00000000U, 0x0000000000000000U,
+    0xb5e620f480000000U, 0x0000000000000000U, 0xe35fa931a0000000U, 0x0000000000000000U,
+    0x8e1bc9bf04000000U, 0x0000000000000000U, 0xb1a2bc2ec5000000U, 0x0000000000000000U,
+    0xde0b6b3a76400000U, 0x0000000000000000U, 0x8ac7230489e80000U, 0x0000000000000000U,
+    0xad78ebc5ac620000U, 0x0000000000000000U, 0xd8d726b7177a8000U, 0x0000000000000000U,
+    0x878678326eac9000U, 0x0000000000000000U, 0xa968163f0a57b400U, 0x0000000000000000U,
+    0xd3c21bcecceda100U, 0x0000000000000000U, 0x84595161401484a0U, 0x0000000000000000U,
+    0xa56fa5b99019a5c8U, 0x0000000000000000U, 0xcecb8f27f4200f3aU, 0x0000000000000000U,
+    0x813f3978f8940984U, 0x4000000000000000U, 0xa18f07d736b90be5U, 0x5000000000000000U,
+    0xc9f2c9cd04674edeU, 0xa400000000000000U, 0xfc6f7c4045812296U, 0x4d00000000000000U,
+    0x9dc5ada82b70b59dU, 0xf020000000000000U, 0xc5371912364ce305U, 0x6c28000000000000U,
+    0xf684df56c3e01bc6U, 0xc732000000000000U, 0x9a130b963a6c115cU, 0x3c7f400000000000U,
+    0xc097ce7bc90715b3U, 0x4b9f100000000000U, 0xf0bdc21abb48db20U, 0x1e86d40000000000U,
+    0x96769950b50d88f4U, 0x1314448000000000U, 0xbc143fa4e250eb31U, 0x17d955a000000000U,
+    0xeb194f8e1ae525fdU, 0x5dcfab0800000000U, 0x92efd1b8d0cf37beU, 0x5aa1cae500000000U,
+    0xb7abc627050305adU, 0xf14a3d9e40000000U, 0xe596b7b0c643c719U, 0x6d9ccd05d0000000U,
+    0x8f7e32ce7bea5c6fU, 0xe4820023a2000000U, 0xb35dbf821ae4f38bU, 0xdda2802c8a800000U,
+    0xe0352f62a19e306eU, 0xd50b2037ad200000U, 0x8c213d9da502de45U, 0x4526f422cc340000U,
+    0xaf298d050e4395d6U, 0x9670b12b7f410000U, 0xdaf3f04651d47b4cU, 0x3c0cdd765f114000U,
+    0x88d8762bf324cd0fU, 0xa5880a69fb6ac800U, 0xab0e93b6efee0053U, 0x8eea0d047a457a00U,
+    0xd5d238a4abe98068U, 0x72a4904598d6d880U, 0x85a36366eb71f041U, 0x47a6da2b7f864750U,
+    0xa70c3c40a64e6c51U, 0x999090b65f67d924U, 0xd0cf4b50cfe20765U, 0xfff4b4e3f741cf6dU,
+    0x82818f1281ed449fU, 0xbff8f10e7a8921a4U, 0xa321f2d7226895c7U, 0xaff72d52192b6a0dU,
+    0xcbea6f8ceb02bb39U, 0x9bf4f8a69f764490U, 0xfee50b7025c36a08U, 0x02f236d04753d5b4U,
+    0x9f4f2726179a2245U, 0x01d762422c946590U, 0xc722f0ef9d80aad6U, 0x424d3ad2b7b97ef5U,
+    0xf8ebad2b84e0d58bU, 0xd2e0898765a7deb2U, 0x9b934c3b330c8577U, 0x63cc55f49f88eb2fU,
+    0xc2781f49ffcfa6d5U, 0x3cbf6b71c76b25fbU, 0xf316271c7fc3908aU, 0x8bef464e3945ef7aU,
+    0x97edd871cfda3a56U, 0x97758bf0e3cbb5acU, 0xbde94e8e43d0c8ecU, 0x3d52eeed1cbea317U,
+    0xed63a231d4c4fb27U, 0x4ca7aaa863ee4bddU, 0x945e455f24fb1cf8U, 0x8fe8caa93e74ef6aU,
+    0xb975d6b6ee39e436U, 0xb3e2fd538e122b44U, 0xe7d34c64a9c85d44U, 0x60dbbca87196b616U,
+    0x90e40fbeea1d3a4aU, 0xbc8955e946fe31cdU, 0xb51d13aea4a488ddU, 0x6babab6398bdbe41U,
+    0xe264589a4dcdab14U, 0xc696963c7eed2dd1U, 0x8d7eb76070a08aecU, 0xfc1e1de5cf543ca2U,
+    0xb0de65388cc8ada8U, 0x3b25a55f43294bcbU, 0xdd15fe86affad912U, 0x49ef0eb713f39ebeU,
+    0x8a2dbf142dfcc7abU, 0x6e3569326c784337U, 0xacb92ed9397bf996U, 0x49c2c37f07965404U,
+    0xd7e77a8f87daf7fbU, 0xdc33745ec97be906U, 0x86f0ac99b4e8dafdU, 0x69a028bb3ded71a3U,
+    0xa8acd7c0222311bcU, 0xc40832ea0d68ce0cU, 0xd2d80db02aabd62bU, 0xf50a3fa490c30190U,
+    0x83c7088e1aab65dbU, 0x792667c6da79e0faU, 0xa4b8cab1a1563f52U, 0x577001b891185938U,
+    0xcde6fd5e09abcf26U, 0xed4c0226b55e6f86U, 0x80b05e5ac60b6178U, 0x544f8158315b05b4U,
+    0xa0dc75f1778e39d6U, 0x696361ae3db1c721U, 0xc913936dd571c84cU, 0x03bc3a19cd1e38e9U,
+    0xfb5878494ace3a5fU, 0x04ab48a04065c723U, 0x9d174b2dcec0e47bU, 0x62eb0d64283f9c76U,
+    0xc45d1df942711d9aU, 0x3ba5d0bd324f8394U, 0xf5746577930d6500U, 0xca8f44ec7ee36479U,
+    0x9968bf6abbe85f20U, 0x7e998b13cf4e1ecbU, 0xbfc2ef456ae276e8U, 0x9e3fedd8c321a67eU,
+    0xefb3ab16c59b14a2U, 0xc5cfe94ef3ea101eU, 0x95d04aee3b80ece5U, 0xbba1f1d158724a12U,
+    0xbb445da9ca61281fU, 0x2a8a6e45ae8edc97U, 0xea1575143cf97226U, 0xf52d09d71a3293bdU,
+    0x924d692ca61be758U, 0x593c2626705f9c56U, 0xb6e0c377cfa2e12eU, 0x6f8b2fb00c77836cU,
+    0xe498f455c38b997aU, 0x0b6dfb9c0f956447U, 0x8edf98b59a373fecU, 0x4724bd4189bd5eacU,
+    0xb2977ee300c50fe7U, 0x58edec91ec2cb657U, 0xdf3d5e9bc0f653e1U, 0x2f2967b66737e3edU,
+    0x8b865b215899f46cU, 0xbd79e0d20082ee74U, 0xae67f1e9aec07187U, 0xecd8590680a3aa11U,
+    0xda01ee641a708de9U, 0xe80e6f4820cc9495U, 0x884134fe908658b2U, 0x3109058d147fdcddU,
+    0xaa51823e34a7eedeU, 0xbd4b46f0599fd415U, 0xd4e5e2cdc1d1ea96U, 0x6c9e18ac7007c91aU,
+    0x850fadc09923329eU, 0x03e2cf6bc604ddb0U, 0xa6539930bf6bff45U, 0x84db8346b786151cU,
+    0xcfe87f7cef46ff16U, 0xe612641865679a63U, 0x81f14fae158c5f6eU, 0x4fcb7e8f3f60c07eU,
+    0xa26da3999aef7749U, 0xe3be5e330f38f09dU, 0xcb090c8001ab551cU, 0x5cadf5bfd3072cc5U,
+    0xfdcb4fa002162a63U, 0x73d9732fc7c8f7f6U, 0x9e9f11c4014dda7eU, 0x2867e7fddcdd9afaU,
+    0xc646d63501a1511dU, 0xb281e1fd541501b8U, 0xf7d88bc24209a565U, 0x1f225a7ca91a4226U,
+    0x9ae757596946075fU, 0x3375788de9b06958U, 0xc1a12d2fc3978937U, 0x0052d6b1641c83aeU,
+    0xf209787bb47d6b84U, 0xc0678c5dbd23a49aU, 0x9745eb4d50ce6332U, 0xf840b7ba963646e0U,
+    0xbd176620a501fbffU, 0xb650e5a93bc3d898U, 0xec5d3fa8ce427affU, 0xa3e51f138ab4cebeU,
+    0x93ba47c980e98cdfU, 0xc66f336c36b10137U, 0xb8a8d9bbe123f017U, 0xb80b0047445d4184U,
+    0xe6d3102ad96cec1dU, 0xa60dc059157491e5U, 0x9043ea1ac7e41392U, 0x87c89837ad68db2fU,
+    0xb454e4a179dd1877U, 0x29babe4598c311fbU, 0xe16a1dc9d8545e94U, 0xf4296dd6fef3d67aU,
+    0x8ce2529e2734bb1dU, 0x1899e4a65f58660cU, 0xb01ae745b101e9e4U, 0x5ec05dcff72e7f8fU,
+    0xdc21a1171d42645dU, 0x76707543f4fa1f73U, 0x899504ae72497ebaU, 0x6a06494a791c53a8U,
+    0xabfa45da0edbde69U, 0x0487db9d17636892U, 0xd6f8d7509292d603U, 0x45a9d2845d3c42b6U,
+    0x865b86925b9bc5c2U, 0x0b8a2392ba45a9b2U, 0xa7f26836f282b732U, 0x8e6cac7768d7141eU,
+    0xd1ef0244af2364ffU, 0x3207d795430cd926U, 0x8335616aed761f1fU, 0x7f44e6bd49e807b8U,
+    0xa402b9c5a8d3a6e7U, 0x5f16206c9c6209a6U, 0xcd036837130890a1U, 0x36dba887c37a8c0fU,
+    0x802221226be55a64U, 0xc2494954da2c9789U, 0xa02aa96b06deb0fdU, 0xf2db9baa10b7bd6cU,
+    0xc83553c5c8965d3dU, 0x6f92829494e5acc7U, 0xfa42a8b73abbf48cU, 0xcb772339ba1f17f9U,
+    0x9c69a97284b578d7U, 0xff2a760414536efbU, 0xc38413cf25e2d70dU, 0xfef5138519684abaU,
+    0xf46518c2ef5b8cd1U, 0x7eb258665fc25d69U, 0x98bf2f79d5993802U, 0xef2f773ffbd97a61U,
+    0xbeeefb584aff8603U, 0xaafb550ffacfd8faU, 0xeeaaba2e5dbf6784U, 0x95ba2a53f983cf38U,
+    0x952ab45cfa97a0b2U, 0xdd945a747bf26183U, 0xba756174393d88dfU, 0x94f971119aeef9e4U,
+    0xe912b9d1478ceb17U, 0x7a37cd5601aab85dU, 0x91abb422ccb812eeU, 0xac62e055c10ab33aU,
+    0xb616a12b7fe617aaU, 0x577b986b314d6009U, 0xe39c49765fdf9d94U, 0xed5a7e85fda0b80bU,
+    0x8e41ade9fbebc27dU, 0x14588f13be847307U, 0xb1d219647ae6b31cU, 0x596eb2d8ae258fc8U,
+    0xde469fbd99a05fe3U, 0x6fca5f8ed9aef3bbU, 0x8aec23d680043beeU, 0x25de7bb9480d5854U,
+    0xada72ccc20054ae9U, 0xaf561aa79a10ae6aU, 0xd910f7ff28069da4U, 0x1b2ba1518094da04U,
+    0x87aa9aff79042286U, 0x90fb44d2f05d0842U, 0xa99541bf57452b28U, 0x353a1607ac744a53U,
+    0xd3fa922f2d1675f2U, 0x42889b8997915ce8U, 0x847c9b5d7c2e09b7U, 0x69956135febada11U,
+    0xa59bc234db398c25U, 0x43fab9837e699095U, 0xcf02b2c21207ef2eU, 0x94f967e45e03f4bbU,
+    0x8161afb94b44f57dU, 0x1d1be0eebac278f5U, 0xa1ba1ba79e1632dcU, 0x6462d92a69731732U,
+    0xca28a291859bbf93U, 0x7d7b8f7503cfdcfeU, 0xfcb2cb35e702af78U, 0x5cda735244c3d43eU,
+    0x9defbf01b061adabU, 0x3a0888136afa64a7U, 0xc56baec21c7a1916U, 0x088aaa1845b8fdd0U,
+    0xf6c69a72a3989f5bU, 0x8aad549e57273d45U, 0x9a3c2087a63f6399U, 0x36ac54e2f678864bU,
+    0xc0cb28a98fcf3c7fU, 0x84576a1bb416a7ddU, 0xf0fdf2d3f3c30b9fU, 0x656d44a2a11c51d5U,
+    0x969eb7c47859e743U, 0x9f644ae5a4b1b325U, 0xbc4665b596706114U, 0x873d5d9f0dde1feeU,
+    0xeb57ff22fc0c7959U, 0xa90cb506d155a7eaU, 0x9316ff75dd87cbd8U, 0x09a7f12442d588f2U,
+    0xb7dcbf5354e9beceU, 0x0c11ed6d538aeb2fU, 0xe5d3ef282a242e81U, 0x8f1668c8a86da5faU,
+    0x8fa475791a569d10U, 0xf96e017d694487bcU, 0xb38d92d760ec4455U, 0x37c981dcc395a9acU,
+    0xe070f78d3927556aU, 0x85bbe253f47b1417U, 0x8c469ab843b89562U, 0x93956d7478ccec8eU,
+    0xaf58416654a6babbU, 0x387ac8d1970027b2U, 0xdb2e51bfe9d0696aU, 0x06997b05fcc0319eU,
+    0x88fcf317f22241e2U, 0x441fece3bdf81f03U, 0xab3c2fddeeaad25aU, 0xd527e81cad7626c3U,
+    0xd60b3bd56a5586f1U, 0x8a71e223d8d3b074U, 0x85c7056562757456U, 0xf6872d5667844e49U,
+    0xa738c6bebb12d16cU, 0xb428f8ac016561dbU, 0xd106f86e69d785c7U, 0xe13336d701beba52U,
+    0x82a45b450226b39cU, 0xecc0024661173473U, 0xa34d721642b06084U, 0x27f002d7f95d0190U,
+    0xcc20ce9bd35c78a5U, 0x31ec038df7b441f4U, 0xff290242c83396ceU, 0x7e67047175a15271U,
+    0x9f79a169bd203e41U, 0x0f0062c6e984d386U, 0xc75809c42c684dd1U, 0x52c07b78a3e60868U,
+    0xf92e0c3537826145U, 0xa7709a56ccdf8a82U, 0x9bbcc7a142b17ccbU, 0x88a66076400bb691U,
+    0xc2abf989935ddbfeU, 0x6acff893d00ea435U, 0xf356f7ebf83552feU, 0x0583f6b8c4124d43U,
+    0x98165af37b2153deU, 0xc3727a337a8b704aU, 0xbe1bf1b059e9a8d6U, 0x744f18c0592e4c5cU,
+    0xeda2ee1c7064130cU, 0x1162def06f79df73U, 0x9485d4d1c63e8be7U, 0x8addcb5645ac2ba8U,
+    0xb9a74a0637ce2ee1U, 0x6d953e2bd7173692U, 0xe8111c87c5c1ba99U, 0xc8fa8db6ccdd0437U,
+    0x910ab1d4db9914a0U, 0x1d9c9892400a22a2U, 0xb54d5e4a127f59c8U, 0x2503beb6d00cab4bU,
+    0xe2a0b5dc971f303aU, 0x2e44ae64840fd61dU, 0x8da471a9de737e24U, 0x5ceaecfed289e5d2U,
+    0xb10d8e1456105dadU, 0x7425a83e872c5f47U, 0xdd50f1996b947518U, 0xd12f124e28f77719U,
+    0x8a5296ffe33cc92fU, 0x82bd6b70d99aaa6fU, 0xace73cbfdc0bfb7bU, 0x636cc64d1001550bU,
+    0xd8210befd30efa5aU, 0x3c47f7e05401aa4eU, 0x8714a775e3e95c78U, 0x65acfaec34810a71U,
+    0xa8d9d1535ce3b396U, 0x7f1839a741a14d0dU, 0xd31045a8341ca07cU, 0x1ede48111209a050U,
+    0x83ea2b892091e44dU, 0x934aed0aab460432U, 0xa4e4b66b68b65d60U, 0xf81da84d5617853fU,
+    0xce1de40642e3f4b9U, 0x36251260ab9d668eU, 0x80d2ae83e9ce78f3U, 0xc1d72b7c6b426019U,
+    0xa1075a24e4421730U, 0xb24cf65b8612f81fU, 0xc94930ae1d529cfcU, 0xdee033f26797b627U,
+    0xfb9b7cd9a4a7443cU, 0x169840ef017da3b1U, 0x9d412e0806e88aa5U, 0x8e1f289560ee864eU,
+    0xc491798a08a2ad4eU, 0xf1a6f2bab92a27e2U, 0xf5b5d7ec8acb58a2U, 0xae10af696774b1dbU,
+    0x9991a6f3d6bf1765U, 0xacca6da1e0a8ef29U, 0xbff610b0cc6edd3fU, 0x17fd090a58d32af3U,
+    0xeff394dcff8a948eU, 0xddfc4b4cef07f5b0U, 0x95f83d0a1fb69cd9U, 0x4abdaf101564f98eU,
+    0xbb764c4ca7a4440fU, 0x9d6d1ad41abe37f1U, 0xea53df5fd18d5513U, 0x84c86189216dc5edU,
+    0x92746b9be2f8552cU, 0x32fd3cf5b4e49bb4U, 0xb7118682dbb66a77U, 0x3fbc8c33221dc2a1U,
+    0xe4d5e82392a40515U, 0x0fabaf3feaa5334aU, 0x8f05b1163ba6832dU, 0x29cb4d87f2a7400eU,
+    0xb2c71d5bca9023f8U, 0x743e20e9ef511012U, 0xdf78e4b2bd342cf6U, 0x914da9246b255416U,
+    0x8bab8eefb6409c1aU, 0x1ad089b6c2f7548eU, 0xae9672aba3d0c320U, 0xa184ac2473b529b1U,
+    0xda3c0f568cc4f3e8U, 0xc9e5d72d90a2741eU, 0x8865899617fb1871U, 0x7e2fa67c7a658892U,
+    0xaa7eebfb9df9de8dU, 0xddbb901b98feeab7U, 0xd51ea6fa85785631U, 0x552a74227f3ea565U,
+    0x8533285c936b35deU, 0xd53a88958f87275fU, 0xa67ff273b8460356U, 0x8a892abaf368f137U,
+    0xd01fef10a657842cU, 0x2d2b7569b0432d85U, 0x8213f56a67f6b29bU, 0x9c3b29620e29fc73U,
+    0xa298f2c501f45f42U, 0x8349f3ba91b47b8fU, 0xcb3f2f7642717713U, 0x241c70a936219a73U,
+    0xfe0efb53d30dd4d7U, 0xed238cd383aa0110U, 0x9ec95d1463e8a506U, 0xf4363804324a40aaU,
+    0xc67bb4597ce2ce48U, 0xb143c6053edcd0d5U, 0xf81aa16fdc1b81daU, 0xdd94b7868e94050aU,
+    0x9b10a4e5e9913128U, 0xca7cf2b4191c8326U, 0xc1d4ce1f63f57d72U, 0xfd1c2f611f63a3f0U,
+    0xf24a01a73cf2dccfU, 0xbc633b39673c8cecU, 0x976e41088617ca01U, 0xd5be0503e085d813U,
+    0xbd49d14aa79dbc82U, 0x4b2d8644d8a74e18U, 0xec9c459d51852ba2U, 0xddf8e7d60ed1219eU,
+    0x93e1ab8252f33b45U, 0xcabb90e5c942b503U, 0xb8da1662e7b00a17U, 0x3d6a751f3b936243U,
+    0xe7109bfba19c0c9dU, 0x0cc512670a783ad4U, 0x906a617d450187e2U, 0x27fb2b80668b24c5U,
+    0xb484f9dc9641e9daU, 0xb1f9f660802dedf6U, 0xe1a63853bbd26451U, 0x5e7873f8a0396973U,
+    0x8d07e33455637eb2U, 0xdb0b487b6423e1e8U, 0xb049dc016abc5e5fU, 0x91ce1a9a3d2cda62U,
+    0xdc5c5301c56b75f7U, 0x7641a140cc7810fbU, 0x89b9b3e11b6329baU, 0xa9e904c87fcb0a9dU,
+    0xac2820d9623bf429U, 0x546345fa9fbdcd44U, 0xd732290fbacaf133U, 0xa97c177947ad4095U,
+    0x867f59a9d4bed6c0U, 0x49ed8eabcccc485dU, 0xa81f301449ee8c70U, 0x5c68f256bfff5a74U,
+    0xd226fc195c6a2f8cU, 0x73832eec6fff3111U, 0x83585d8fd9c25db7U, 0xc831fd53c5ff7eabU,
+    0xa42e74f3d032f525U, 0xba3e7ca8b77f5e55U, 0xcd3a1230c43fb26fU, 0x28ce1bd2e55f35ebU,
+    0x80444b5e7aa7cf85U, 0x7980d163cf5b81b3U, 0xa0555e361951c366U, 0xd7e105bcc332621fU,
+    0xc86ab5c39fa63440U, 0x8dd9472bf3fefaa7U, 0xfa856334878fc150U, 0xb14f98f6f0feb951U,
+    0x9c935e00d4b9d8d2U, 0x6ed1bf9a569f33d3U, 0xc3b8358109e84f07U, 0x0a862f80ec4700c8U,
+    0xf4a642e14c6262c8U, 0xcd27bb612758c0faU, 0x98e7e9cccfbd7dbdU, 0x8038d51cb897789cU,
+    0xbf21e44003acdd2cU, 0xe0470a63e6bd56c3U, 0xeeea5d5004981478U, 0x1858ccfce06cac74U,
+    0x95527a5202df0ccbU, 0x0f37801e0c43ebc8U, 0xbaa718e68396cffdU, 0xd30560258f54e6baU,
+    0xe950df20247c83fdU, 0x47c6b82ef32a2069U, 0x91d28b7416cdd27eU, 0x4cdc331d57fa5441U,
+    0xb6472e511c81471dU, 0xe0133fe4adf8e952U, 0xe3d8f9e563a198e5U, 0x58180fddd97723a6U,
+    0x8e679c2f5e44ff8fU, 0x570f09eaa7ea7648U
+};
+
+static const double dec_exact_pow10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+					  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+static inline uint64_t dec_multiply_64(uint64_t a, uint64_t b, uint64_t *hi)
+{
+#if defined(__SIZEOF_INT128__)
+  unsigned __int128 r = (unsigned __int128)a * b;
+  *hi = (uint64_t)(r >> 64);
+  return((uint64_t)r);
+#else
+  uint64_t a_lo = (uint32_t)a, a_hi = a >> 32, b_lo = (uint32_t)b, b_hi = b >> 32;
+  uint64_t p0 = a_lo * b_lo, p1 = a_lo * b_hi, p2 = a_hi * b_lo;
+  uint64_t mid = (p0 >> 32) + (uint32_t)p1 + (uint32_t)p2;
+  *hi = a_hi * b_hi + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+  return((mid << 32) | (uint32_t)p0);
+#endif
+}
+
+static inline int32_t dec_leading_zeros(uint64_t x) /* x != 0 */
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return(__builtin_clzll(x));
+#else
+  int32_t n = 0;
+  while (!(x & 0x8000000000000000U)) {x <<= 1; n++;}
+  return(n);
+#endif
+}
+
+static uint64_t dec_eisel_lemire(uint64_t w, int32_t q) /* returns the bits of w * 10^q, sign excluded */
+{
+  int32_t lz, upperbit, shift, power2;
+  uint64_t lo, hi, mantissa;
+  const uint64_t *pow5;
+
+  if ((w == 0) || (q < DEC_MIN_POW5)) return(0);
+  if (q > DEC_MAX_POW10) return(DEC_INF_BITS);
+  lz = dec_leading_zeros(w);
+  w <<= lz;
+  pow5 = dec_pow5_128 + 2 * (q - DEC_MIN_POW5);
+  lo = dec_multiply_64(w, pow5[0], &hi);
+  if ((hi & 0x1FF) == 0x1FF) /* the low 9 bits of the 55 we keep might still carry */
+    {
+      uint64_t hi2;
+      dec_multiply_64(w, pow5[1], &hi2);
+      lo += hi2;
+      if (hi2 > lo) hi++;
+    }
+  upperbit = (int32_t)(hi >> 63);
+  shift = upperbit + 9;
+  mantissa = hi >> shift;
+  power2 = ((((152170 + 65536) * q) >> 16) + 63) + upperbit - lz + 1023; /* floor(q * log2(10)) + 63 */
+  if (power2 <= 0) /* subnormal */
+    {
+      if (-power2 + 1 >= 64) return(0);
+      mantissa >>= -power2 + 1;
+      mantissa += (mantissa & 1);
+      mantissa >>= 1;
+      return((mantissa < (1ULL << 52)) ? mantissa : ((1ULL << 52) | (mantissa & DEC_FRAC_MASK)));
+    }
+  /* exactly halfway between two doubles (only possible when 5^q fits in 64 bits): round to even */
+  if ((lo <= 1) && (q >= -4) && (q <= 23) &&
+      ((mantissa & 3) == 1) && ((mantissa << shift) == hi))
+    mantissa &= ~1ULL;
+  mantissa += (mantissa & 1);
+  mantissa >>= 1;
+  if (mantissa >= (2ULL << 52))
+    {
+      mantissa = 1ULL << 52;
+      power2++;
+    }
+  if (power2 >= 0x7FF) return(DEC_INF_BITS);
+  return(((uint64_t)power2 << 52) | (mantissa & DEC_FRAC_MASK));
+}
+
+static s7_double decimal_string_to_double_slow(const char *str, bool negative)
+{
+  char buf[DEC_SLOW_DIGITS + 16];
+  int32_t n = 0, dig, exponent = 0;
+  bool after_point = false, sticky = false;
+  const char *p = str;
+
+  while (*p == '0') p++;
+  for (; ; p++)
+    {
+      if ((*p == '.') && (!after_point))
+	{
+	  after_point = true;
+	  continue;
+	}
+      dig = digits[(uint8_t)(*p)];
+      if (dig >= 10) break;
+      if (n < DEC_SLOW_DIGITS)
+	{
+	  if ((n > 0) || (dig != 0))
+	    buf[n++] = (char)('0' + dig);
+	  if (after_point) exponent--;
+	}
+      else
+	{
+	  if (!after_point) exponent++;
+	  if (dig != 0) sticky = true;
+	}}
+  if (sticky) /* a trailing 1 keeps "just above the tie" above it */
+    {
+      buf[n++] = '1';
+      exponent--;
+    }
+  if ((*p) && (exponent_table[(uint8_t)(*p)]))
+    {
+      int32_t e = 0;
+      bool exp_negative = false;
+      p++;
+      if (*p == '+')
+	p++;
+      else
+	if (*p == '-')
+	  {
+	    p++;
+	    exp_negative = true;
+	  }
+      while ((dig = digits[(uint8_t)(*p++)]) < 10)
+	if (e < 100000) e = e * 10 + dig;
+      exponent += (exp_negative) ? -e : e;
+    }
+  if (n == 0) return((negative) ? -0.0 : 0.0);
+  snprintf((char *)(buf + n), 16, "e%d", exponent);
+  return((negative) ? -strtod(buf, NULL) : strtod(buf, NULL));
+}
+
+static s7_double decimal_string_to_double(const char *ur_str)
+{
+  uint64_t w = 0, bits;
+  int32_t ndigits = 0, q = 0, dig;
+  bool negative = false, truncated = false;
+  const char *str = ur_str;
+  union {uint64_t bits; s7_double d;} u;
+
+  if (*str == '-')
+    {
+      str++;
+      negative = true;
+    }
+  else
+    if (*str == '+')
+      str++;
+  while (*str == '0') str++;
+
+  for (; (dig = digits[(uint8_t)(*str)]) < 10; str++)
+    if (ndigits < 19)
+      {
+	w = w * 10 + dig;
+	ndigits++;
+      }
+    else
+      {
+	q++;
+	if (dig != 0) truncated = true;
+      }
+  if (*str == '.')
+    {
+      for (str++; (dig = digits[(uint8_t)(*str)]) < 10; str++)
+	if (ndigits < 19)
+	  {
+	    q--;
+	    if ((w != 0) || (dig != 0))
+	      {
+		w = w * 10 + dig;
+		ndigits++;
+	      }}
+	else
+	  if (dig != 0) truncated = true;
+    }
+
+  if ((*str) && (exponent_table[(uint8_t)(*str)]))
+    {
+      int32_t exponent = 0;
+      bool exp_negative = false;
+      str++;
+      if (*str == '+')
+	str++;
+      else
+	if (*str == '-')
+	  {
+	    str++;
+	    exp_negative = true;
+	  }
+      while ((dig = digits[(uint8_t)(*str++)]) < 10) /* 2e00000000000000000000000000000000000000001 is 20.0 */
+	if (exponent < 100000) exponent = exponent * 10 + dig;
+      q += (exp_negative) ? -exponent : exponent;
+    }
+
+  if (w == 0) return((negative) ? -0.0 : 0.0);
+  if ((!truncated) && (q >= -22) && (q <= 22) && (w <= (1ULL << 53)))
+    {
+      s7_double x = (s7_double)w;
+      x = (q < 0) ? (x / dec_exact_pow10[-q]) : (x * dec_exact_pow10[q]);
+      return((negative) ? -x : x);
+    }
+  bits = dec_eisel_lemire(w, q);
+  if ((truncated) && (dec_eisel_lemire(w + 1, q) != bits))
+    return(decimal_string_to_double_slow(ur_str + (((*ur_str == '-') || (*ur_str == '+')) ? 1 : 0), negative));
+  u.bits = bits;
+  return((negative) ? -u.d : u.d);
+}
+
 #if WITH_GMP
 static s7_double string_to_double_with_radix(const char *ur_str, int32_t radix, bool *overflow)
 #else
@@ -14994,6 +16125,9 @@ static s7_double string_to_double_with_radix_1(const char *ur_str, int32_t radix
    * '@' can now be used as the exponent marker (26-Mar-12).
    * Another slight ambiguity: 1+1/2i is parsed as 1 + 0.5i, not 1+1/(2i), or (1+1)/(2i) or (1+1/2)i etc
    */
+#if (!WITH_GMP)
+  if (radix == 10) return(decimal_string_to_double(ur_str)); /* [c4augustus] */
+#endif
   if (*str == '-')
     {
       str++;
@@ -15353,6 +16487,41 @@ static s7_pointer make_symbol_or_number(s7_scheme *sc, const char *name, int32_t
 }
 #endif
 
+#if (!WITH_GMP)
+static s7_pointer make_plain_decimal(s7_scheme *sc, const char *q) /* [c4augustus] */
+{
+  /* [+-]digits[.digits][e[+-]digits], the bulk of numeric data, skips make_atom's general scan; NULL if it's anything else */
+  const char *p = q;
+  bool is_real = false;
+  s7_int ndigits = 0;
+
+  if ((*p == '+') || (*p == '-')) p++;
+  for (; digits[(uint8_t)(*p)] < 10; p++) ndigits++;
+  if (*p == '.')
+    {
+      is_real = true;
+      for (p++; digits[(uint8_t)(*p)] < 10; p++) ndigits++;
+    }
+  if (ndigits == 0) return(NULL);
+  if ((*p == 'e') || (*p == 'E'))
+    {
+      is_real = true;
+      p++;
+      if ((*p == '+') || (*p == '-')) p++;
+      if (digits[(uint8_t)(*p)] >= 10) return(NULL);
+      while (digits[(uint8_t)(*p)] < 10) p++;
+    }
+  if (*p) return(NULL);
+  if (is_real)
+    return(make_real(sc, decimal_string_to_double(q)));
+  {
+    bool overflow = false;
+    s7_int x = string_to_integer(q, 10, &overflow);
+    return((overflow) ? NULL : make_integer(sc, x));
+  }
+}
+#endif
+
 static s7_pointer make_atom(s7_scheme *sc, char *q, int32_t radix, bool want_symbol, bool with_error)
 {
   /* make symbol or number from string, a number starts with + - . or digit, but so does 1+ for example */
@@ -15443,6 +16612,17 @@ static s7_pointer make_atom(s7_scheme *sc, char *q, int32_t radix, bool want_sym
     }
 
   /* now it's possibly a number -- the first character(s) could be part of a number in the current radix */
+#if (!WITH_GMP)
+  if ((radix == 10)
+#if WITH_NUMBER_SEPARATOR
+      && (sc->number_separator == '\0')
+#endif
+     )
+    {
+      s7_pointer x = make_plain_decimal(sc, q);
+      if (x) return(x);
+    }
+#endif
   {
     char *slash1 = NULL, *slash2 = NULL, *plus = NULL, *ex1 = NULL, *ex2 = NULL;
     bool has_i = false, has_dec_point2 = false;
@@ -26563,6 +27743,7 @@ static s7_pointer make_permanent_string(const char *str)           /* for (s7) s
   string_block(x) = NULL;
   string_value(x) = (char *)str;
   string_hash(x) = 0;
+  set_mark(x); /* [c4augustus] shared by every s7_scheme, see init_small_ints */
   return(x);
 }
 
@@ -26574,7 +27755,7 @@ s7_pointer s7_make_permanent_string(s7_scheme *sc, const char *str) /* keep s7_s
 static void init_strings(void)
 {
   nil_string = make_permanent_string("");
-  nil_string->tf.flag = T_STRING | T_UNHEAP;
+  nil_string->tf.flag = T_STRING | T_UNHEAP | T_GC_MARK; /* [c4augustus] */
   set_optimize_op(nil_string, OP_CONSTANT);
 
   car_a_list_string = make_permanent_string("a pair whose car is also a pair");
@@ -29080,7 +30261,7 @@ static block_t *mallocate_port(s7_scheme *sc)
   else
     { /* this is mallocate without the index calc */
       p = mallocate_block(sc);
-      block_data(p) = (void *)permalloc(sc, (size_t)(1 << PORT_LIST));
+      block_data(p) = carve_block(sc, PORT_LIST); /* [c4augustus] was permalloc */
       block_set_index(p, PORT_LIST);
     }
   block_set_size(p, sizeof(port_t));
@@ -29801,7 +30982,6 @@ static s7_pointer g_open_output_function(s7_scheme *sc, s7_pointer args)
 
   port = s7_open_output_function(sc, output_scheme_function_wrapper);
   port_set_string_or_function(port, func);
-  mark_function[T_OUTPUT_PORT] = mark_output_port;
   return(port);
 }
 
@@ -30538,7 +31718,7 @@ s7_pointer s7_load_with_environment(s7_scheme *sc, const char *filename, s7_poin
 
 s7_pointer s7_load(s7_scheme *sc, const char *filename) {return(s7_load_with_environment(sc, filename, sc->nil));}
 
-s7_pointer s7_load_c_string_with_environment(s7_scheme *sc, const char *content, s7_int bytes, s7_pointer e)
+static s7_pointer load_c_string(s7_scheme *sc, const char *content, s7_int bytes, s7_pointer e, bool record) /* [c4augustus] record: see s7_load_c_string_record */
 {
   s7_pointer port;
   s7_int port_loc;
@@ -30551,6 +31731,7 @@ s7_pointer s7_load_c_string_with_environment(s7_scheme *sc, const char *content,
   port_loc = gc_protect_1(sc, port);
   set_loader_port(port);
   push_input_port(sc, port);
+  if (record) sc->load_record = cons(sc, port, sc->nil); /* [c4augustus] */
   set_curlet(sc, (e == sc->rootlet) ? sc->nil : e);
   push_stack(sc, OP_LOAD_RETURN_IF_EOF, port, sc->code);
   s7_gc_unprotect_at(sc, port_loc);
@@ -30572,11 +31753,80 @@ s7_pointer s7_load_c_string_with_environment(s7_scheme *sc, const char *content,
   return(sc->value);
 }
 
+s7_pointer s7_load_c_string_with_environment(s7_scheme *sc, const char *content, s7_int bytes, s7_pointer e)
+{
+  return(load_c_string(sc, content, bytes, e, false));
+}
+
 s7_pointer s7_load_c_string(s7_scheme *sc, const char *content, s7_int bytes)
 {
   return(s7_load_c_string_with_environment(sc, content, bytes, sc->nil));
 }
 
+s7_pointer s7_load_c_string_record(s7_scheme *sc, const char *content, s7_int bytes, s7_pointer *record) /* [c4augustus] */
+{
+  /* op_load_return_if_eof pushes (form line . position) on sc->load_record as each top-level form is read, line and
+   *   position being where the reader stopped, which is what an error in that form reports, see fill_error_location
+   */
+  s7_pointer result, old_record = sc->load_record;
+  s7_int old_loc = gc_protect_1(sc, old_record); /* a load in a load */
+  result = load_c_string(sc, content, bytes, sc->nil, true);
+  (*record) = (car(sc->load_record) == sc->T) ? proper_list_reverse_in_place(sc, cdr(sc->load_record)) : sc->F;
+  sc->load_record = old_record;
+  s7_gc_unprotect_at(sc, old_loc);
+  return(result);
+}
+
+s7_pointer s7_load_c_string_replay(s7_scheme *sc, const char *content, s7_int bytes, s7_pointer record) /* [c4augustus] */
+{
+  /* the loader port on content is current while each form runs, as it is in a load, and is set to the line and position
+   *   recorded for that form, so errors, *function*, port-line-number etc see what they would have seen
+   */
+  s7_pointer port;
+  volatile s7_pointer next = record; /* still valid after a jump back to here */
+  s7_int port_loc, record_loc;
+  declare_jump_info();
+  TRACK(sc);
+
+  if (content[bytes] != 0)
+    error_nr(sc, make_symbol(sc, "bad-data", 8), set_elist_1(sc, wrap_string(sc, "s7_load_c_string content is not terminated", 42)));
+  port = open_input_string(sc, content, bytes);
+  port_loc = gc_protect_1(sc, port);
+  record_loc = gc_protect_1(sc, record);
+  set_loader_port(port);
+  push_input_port(sc, port);
+  sc->value = sc->unspecified;
+
+  store_jump_info(sc);
+  set_jump_info(sc, LOAD_SET_JUMP);
+  if (jump_loc == ERROR_JUMP)
+    next = sc->nil;        /* a load stops at the first error */
+  else
+    if (jump_loc != NO_JUMP)
+      eval(sc, sc->cur_op); /* finish the form the jump landed in */
+  while (is_pair(next))
+    {
+      s7_pointer rec = car(next);
+      next = cdr(next);
+      port_line_number(port) = integer(cadr(rec));
+      port_position(port) = integer(cddr(rec));
+      push_stack_direct(sc, OP_EVAL_DONE);
+      sc->code = car(rec);
+      sc->curlet = sc->nil;
+      eval(sc, OP_EVAL);
+    }
+  pop_input_port(sc);
+  if (is_input_port(port))
+    s7_close_input_port(sc, port);
+  restore_jump_info(sc);
+  s7_gc_unprotect_at(sc, record_loc);
+  s7_gc_unprotect_at(sc, port_loc);
+
+  if (is_multiple_value(sc->value))
+    sc->value = splice_in_values(sc, multiple_value(sc->value));
+  return(sc->value);
+}
+
 static s7_pointer g_load(s7_scheme *sc, s7_pointer args)
 {
   #define H_load "(load file (@ (rootlet))) loads the scheme file 'file'. The 'let' argument \
@@ -31306,17 +32556,6 @@ static s7_pointer titr_pair(s7_scheme *sc, s7_pointer p, const char *func, int32
   return(p);
 }
 
-static s7_pointer titr_hash(s7_scheme *sc, s7_pointer p, const char *func, int32_t line)
-{
-  if (!is_hash_table(iterator_sequence(p)))
-    {
-      fprintf(stderr, "%s%s[%d]: hash iterator sequence is %s%s\n",
-	      BOLD_TEXT, func, line, check_name(sc, unchecked_type(iterator_sequence(p))), UNBOLD_TEXT);
-      if (sc->stop_at_error) abort();
-    }
-  return(p);
-}
-
 static s7_pointer titr_len(s7_scheme *sc, s7_pointer p, const char *func, int32_t line)
 {
   if ((is_hash_table(iterator_sequence(p))) || (is_pair(iterator_sequence(p))))
@@ -31362,7 +32601,7 @@ static bool is_iterator_b_7p(s7_scheme *sc, s7_pointer obj) {return(g_is_iterato
 
 static s7_pointer iterator_copy(s7_scheme *sc, s7_pointer p)
 {
-  /* fields are obj cur [loc|lcur] [len|slow|hcur] next, but untangling them in debugging case is a pain */
+  /* fields are obj cur [loc|lcur] [len|slow] next, but untangling them in debugging case is a pain */
   s7_pointer iter;
   new_cell(sc, iter, T_ITERATOR | T_SAFE_PROCEDURE);
   memcpy((void *)iter, (void *)p, sizeof(s7_cell)); /* picks up ITER_OK I hope */
@@ -31417,27 +32656,16 @@ static s7_pointer hash_entry_to_cons(s7_scheme *sc, hash_entry_t *entry, s7_poin
 
 static s7_pointer hash_table_iterate(s7_scheme *sc, s7_pointer iterator)
 {
-  s7_pointer table;
-  s7_int len;
-  hash_entry_t **elements;
-  hash_entry_t *lst = iterator_hash_current(iterator);
-
-  if (lst)
-    {
-      iterator_hash_current(iterator) = hash_entry_next(lst);
-      return(hash_entry_to_cons(sc, lst, iterator_current(iterator)));
-    }
-  table = iterator_sequence(iterator); /* using iterator_length and hash_table_entries here was slightly slower */
-  len = hash_table_mask(table) + 1;
-  elements = hash_table_elements(table);
+  s7_pointer table = iterator_sequence(iterator); /* using iterator_length and hash_table_entries here was slightly slower */
+  s7_int len = hash_table_mask(table) + 1;
+  hash_entry_t *elements = hash_table_elements(table);
 
   for (s7_int loc = iterator_position(iterator) + 1; loc < len;  loc++)
     {
-      hash_entry_t *x = elements[loc];
-      if (x)
+      hash_entry_t *x = &elements[loc];
+      if (hash_entry_is_live(x))
 	{
 	  iterator_position(iterator) = loc;
-	  iterator_hash_current(iterator) = hash_entry_next(x);
 	  return(hash_entry_to_cons(sc, x, iterator_current(iterator)));
 	}}
   if (is_weak_hash_table(table))
@@ -31633,7 +32861,6 @@ s7_pointer s7_make_iterator(s7_scheme *sc, s7_pointer e)
       break;
 
     case T_HASH_TABLE:
-      iterator_hash_current(iter) = NULL;
       iterator_current(iter) = NULL;
       iterator_position(iter) = -1;
       iterator_next(iter) = hash_table_iterate;
@@ -32005,11 +33232,12 @@ static bool collect_shared_info(s7_scheme *sc, shared_info_t *ci, s7_pointer top
       if (hash_table_entries(top) > 0)
 	{
 	  s7_int len = hash_table_mask(top) + 1;
-	  hash_entry_t **entries = hash_table_elements(top);
+	  hash_entry_t *entries = hash_table_elements(top);
 	  bool keys_safe = hash_keys_not_cyclic(sc, top);
 	  for (s7_int i = 0; i < len; i++)
-	    for (hash_entry_t *p = entries[i]; p; p = hash_entry_next(p))
+	    if (hash_entry_is_live(&entries[i]))
 	      {
+		hash_entry_t *p = &entries[i];
 		if ((!keys_safe) &&
 		    (has_structure(hash_entry_key(p))) &&
 		    (collect_shared_info(sc, ci, hash_entry_key(p), stop_at_print_length)))
@@ -32186,14 +33414,14 @@ static shared_info_t *make_shared_info(s7_scheme *sc, s7_pointer top, bool stop_
       if (is_hash_table(top))
 	{
 	  s7_int len = hash_table_mask(top) + 1;
-	  hash_entry_t **entries = hash_table_elements(top);
+	  hash_entry_t *entries = hash_table_elements(top);
 	  bool keys_safe = hash_keys_not_cyclic(sc, top);
 	  if (hash_table_entries(top) == 0) return(NULL);
 	  for (s7_int i = 0; i < len; i++)
-	    for (hash_entry_t *p = entries[i]; p; p = hash_entry_next(p))
-	      if (((!keys_safe) &&	(has_structure(hash_entry_key(p)))) ||
-		  (has_structure(hash_entry_value(p))))
-		{no_problem = false; break;}
+	    if ((hash_entry_is_live(&entries[i])) &&
+		(((!keys_safe) && (has_structure(hash_entry_key(&entries[i])))) ||
+		 (has_structure(hash_entry_value(&entries[i])))))
+	      {no_problem = false; break;}
 	  if (no_problem) return(NULL);
 	}
 #endif
@@ -32994,9 +34222,22 @@ static void int_vector_to_port(s7_scheme *sc, s7_pointer vect, s7_pointer port,
     port_write_character(port)(sc, ')', port);
 }
 
+#define FV_BUFSIZE 512 /* some floats can take around 312 bytes */
+
+static s7_int float_to_fv_buf(s7_scheme *sc, char *buf, s7_double x) /* [c4augustus] */
+{
+  s7_int plen;
+#if WITH_DTOA
+  if (sc->float_format_precision == WRITE_REAL_PRECISION)
+    return(fpconv_dtoa(x, buf)); /* shortest string that reads back as x, as in number->string */
+#endif
+  plen = snprintf(buf, FV_BUFSIZE - 4, "%.*g", sc->float_format_precision, x); /* -4 so floatify has room */
+  floatify(buf, &plen);
+  return(clamp_length(plen, FV_BUFSIZE - 4));
+}
+
 static void float_vector_to_port(s7_scheme *sc, s7_pointer vect, s7_pointer port, use_write_t use_write, shared_info_t *unused_ci)
 {
-  #define FV_BUFSIZE 512 /* some floats can take around 312 bytes */
   char buf[FV_BUFSIZE];
   s7_int i, plen;
   bool too_long;
@@ -33019,8 +34260,9 @@ static void float_vector_to_port(s7_scheme *sc, s7_pointer vect, s7_pointer port
       if (i == vlen)
 	{
 	  make_vector_to_port(sc, vect, port);
-	  plen = snprintf(buf, FV_BUFSIZE, "%.*g)", sc->float_format_precision, first);
-	  port_write_string(port)(sc, buf, clamp_length(plen, FV_BUFSIZE), port);
+	  plen = float_to_fv_buf(sc, buf, first);
+	  buf[plen++] = ')';
+	  port_write_string(port)(sc, buf, plen, port);
 	  if ((use_write == P_READABLE) &&
 	      (is_immutable_vector(vect)))
 	    port_write_character(port)(sc, ')', port);
@@ -33030,15 +34272,13 @@ static void float_vector_to_port(s7_scheme *sc, s7_pointer vect, s7_pointer port
   if (vector_rank(vect) == 1)
     {
       port_write_string(port)(sc, "$r(", 3, port);
-      plen = snprintf(buf, FV_BUFSIZE - 4, "%.*g", sc->float_format_precision, els[0]); /* -4 so floatify has room */
-      floatify(buf, &plen);
-      port_write_string(port)(sc, buf, clamp_length(plen, FV_BUFSIZE), port);
+      plen = float_to_fv_buf(sc, buf, els[0]);
+      port_write_string(port)(sc, buf, plen, port);
+      buf[0] = ' ';
       for (i = 1; i < len; i++)
 	{
-	  plen = snprintf(buf, FV_BUFSIZE - 4, " %.*g", sc->float_format_precision, els[i]);
-	  plen--; /* fixup for the initial $\space */
-	  floatify((char *)(buf + 1), &plen);
-	  port_write_string(port)(sc, buf, clamp_length(plen + 1, FV_BUFSIZE), port);
+	  plen = float_to_fv_buf(sc, (char *)(buf + 1), els[i]);
+	  port_write_string(port)(sc, buf, plen + 1, port);
 	}
       if (too_long)
 	port_write_string(port)(sc, " ...)", 5, port);
@@ -34649,7 +35889,7 @@ static void integer_to_port(s7_scheme *sc, s7_pointer obj, s7_pointer port, use_
     {
       s7_int nlen = 0;
       const char *str = integer_to_string(sc, integer(obj), &nlen);
-      set_number_name(obj, str, nlen);
+      if (in_heap(obj)) set_number_name(obj, str, nlen); /* [c4augustus] unheaped numbers can be shared across threads */
       port_write_string(port)(sc, str, nlen, port);
     }
 }
@@ -34665,7 +35905,8 @@ static void number_to_port(s7_scheme *sc, s7_pointer obj, s7_pointer port, use_w
       if ((nlen < NUMBER_NAME_SIZE) &&
 	  (str[0] != 'n') && (str[0] != 'i') &&
 	  ((!(is_t_complex(obj))) ||
-	   ((!is_NaN(imag_part(obj))) && (!is_inf(imag_part(obj))))))
+	   ((!is_NaN(imag_part(obj))) && (!is_inf(imag_part(obj))))) &&
+	  (in_heap(obj))) /* [c4augustus] see integer_to_port */
 	set_number_name(obj, str, nlen);
       port_write_string(port)(sc, str, nlen, port);
     }
@@ -36343,6 +37584,132 @@ static bool is_columnizing(const char *str)  /* look for ~t ~,<int>T ~<int>,<int
   return(false);
 }
 
+/* [c4augustus] compiled control strings: a control string made of text, ~A, ~S, ~D, ~% and ~~ is parsed once
+ *   into a list of ops, kept in a small table indexed by the string cell, so a constant control string is compiled
+ *   once per call site (format_chooser does it up front).  With a $f port the ops write straight into a format port,
+ *   skipping format_data, column tracking and the per-character directive switch.  An entry also holds a copy of
+ *   the text it was compiled from, so a reused cell or a string-set! control string just misses and recompiles.
+ *   Anything the ops don't cover at run time (argument count, ~D of a non-integer, arguments with methods) returns
+ *   NULL and the caller goes through format_to_port_1 for the full behavior and error messages.  A running program
+ *   is never evicted (an error while printing an argument leaves its slot pinned, which costs only cache misses).
+ */
+#define FORMAT_PROGRAMS_SIZE 64
+#define FORMAT_PROGRAM_MAX_LENGTH 1024
+
+static format_program_t *format_program(s7_scheme *sc, s7_pointer str)
+{
+  format_program_t *fp;
+  const char *s = string_value(str);
+  s7_int len = string_length(str), num_ops = 0, num_args = 0;
+
+  if ((len == 0) || (len > FORMAT_PROGRAM_MAX_LENGTH)) return(NULL);
+  if (!sc->format_programs)
+    sc->format_programs = (format_program_t *)Calloc(FORMAT_PROGRAMS_SIZE, sizeof(format_program_t));
+  fp = &sc->format_programs[((uintptr_t)str >> 5) & (FORMAT_PROGRAMS_SIZE - 1)];
+  if ((fp->str == str) && (fp->len == len) && (memcmp((const void *)fp->text, (const void *)s, len) == 0))
+    return((fp->num_ops > 0) ? fp : NULL);
+  if (fp->running > 0) return(NULL); /* printing an argument got back here with a string that shares the slot */
+
+  if (fp->block) liberate(sc, fp->block);
+  fp->block = mallocate(sc, len * sizeof(format_op_t) + len);      /* at most one op per character */
+  fp->ops = (format_op_t *)block_data(fp->block);
+  fp->text = (char *)(fp->ops + len);
+  memcpy((void *)fp->text, (const void *)s, len);
+  fp->str = str;
+  fp->len = len;
+  for (s7_int i = 0; i < len;)
+    {
+      format_op_t *op = &fp->ops[num_ops++];
+      if (s[i] != '~')
+	{
+	  s7_int j = i + 1;
+	  while ((j < len) && (s[j] != '~')) j++;
+	  op->kind = FORMAT_OP_TEXT;
+	  op->start = i;
+	  op->len = j - i;
+	  i = j;
+	  continue;
+	}
+      if (i + 1 == len) {num_ops = 0; break;}
+      switch (s[i + 1])
+	{
+	case 'A': case 'a': op->kind = FORMAT_OP_DISPLAY; num_args++; break;
+	case 'S': case 's': op->kind = FORMAT_OP_WRITE;   num_args++; break;
+	case 'D': case 'd': op->kind = FORMAT_OP_INTEGER; num_args++; break;
+	case '%':           op->kind = FORMAT_OP_NEWLINE;             break;
+	case '~':           op->kind = FORMAT_OP_TEXT; op->start = i + 1; op->len = 1; break;
+	default:            num_ops = 0;                              break;
+	}
+      if (num_ops == 0) break;
+      i += 2;
+    }
+  fp->num_ops = num_ops;
+  fp->num_args = num_args;
+  return((num_ops > 0) ? fp : NULL);
+}
+
+static inline void format_program_append(s7_scheme *sc, const char *str, s7_int len, s7_pointer port)
+{
+  if (port_position(port) + len < port_data_size(port))
+    {
+      memcpy((void *)(port_data(port) + port_position(port)), (const void *)str, len);
+      port_position(port) += len;
+    }
+  else port_write_string(port)(sc, str, len, port);
+}
+
+static s7_pointer format_f_compiled(s7_scheme *sc, s7_pointer str, s7_pointer args)
+{
+  /* (format $f str . args) via str's ops, or NULL if they don't apply */
+  format_program_t *fp = format_program(sc, str);
+  s7_pointer p = args, port, result;
+  if (!fp) return(NULL);
+  for (s7_int i = 0; i < fp->num_ops; i++)
+    if (fp->ops[i].kind >= FORMAT_OP_DISPLAY)
+      {
+	if ((!is_pair(p)) ||
+	    (has_active_methods(sc, car(p))) ||
+	    ((fp->ops[i].kind == FORMAT_OP_INTEGER) && (!is_t_integer(car(p)))))
+	  return(NULL);
+	p = cdr(p);
+      }
+  if (!is_null(p)) return(NULL);
+
+  port = open_format_port(sc);
+  fp->running++;
+  for (s7_int i = 0; i < fp->num_ops; i++)
+    {
+      format_op_t *op = &fp->ops[i];
+      switch (op->kind)
+	{
+	case FORMAT_OP_TEXT:    format_program_append(sc, (const char *)(fp->text + op->start), op->len, port); break;
+	case FORMAT_OP_NEWLINE: format_program_append(sc, "\n", 1, port);                                       break;
+	case FORMAT_OP_WRITE:   object_out(sc, car(args), port, P_WRITE); args = cdr(args);                     break;
+	case FORMAT_OP_DISPLAY:
+	case FORMAT_OP_INTEGER:
+	  {
+	    s7_pointer obj = car(args);
+	    if (is_string(obj))
+	      format_program_append(sc, string_value(obj), string_length(obj), port);
+	    else
+	      if (is_t_integer(obj))
+		{
+		  s7_int nlen = 0;
+		  const char *num = integer_to_string(sc, integer(obj), &nlen);
+		  format_program_append(sc, num, nlen, port);
+		}
+	      else object_out(sc, obj, port, P_DISPLAY);
+	    args = cdr(args);
+	  }
+	  break;
+	}
+    }
+  fp->running--;
+  result = make_string_with_length(sc, (const char *)port_data(port), port_position(port));
+  close_format_port(sc, port);
+  return(result);
+}
+
 static s7_pointer g_format(s7_scheme *sc, s7_pointer args)
 {
   #define H_format "(format out str . args) substitutes args into str sending the result to out. Most of \
@@ -36384,6 +37751,11 @@ is $t, the string is also sent to the current-output-port."
   str = cadr(args);
   if (!is_string(str))
     return(method_or_bust(sc, str, sc->format_symbol, args, sc->type_names[T_STRING], 2));
+  if (pt == sc->F) /* [c4augustus] (apply format $f form vals) for example */
+    {
+      s7_pointer result = format_f_compiled(sc, str, cddr(args));
+      if (result) return(result);
+    }
   return(format_to_port_1(sc, (pt == sc->T) ? current_output_port(sc) : pt,
 			  string_value(str), cddr(args), NULL, !is_output_port(pt), true, string_length(str), str));
 }
@@ -36458,6 +37830,11 @@ static s7_pointer g_format_no_column(s7_scheme *sc, s7_pointer args)
 
   str = cadr(args);
   sc->format_column = 0;
+  if (pt == sc->F) /* [c4augustus] */
+    {
+      s7_pointer result = format_f_compiled(sc, str, cddr(args));
+      if (result) return(result);
+    }
   return(format_to_port_1(sc, (pt == sc->T) ? current_output_port(sc) : pt,
 			  string_value(str), cddr(args), NULL,
 			  !is_output_port(pt),   /* i.e. is boolean port so we're returning a string */
@@ -36465,6 +37842,12 @@ static s7_pointer g_format_no_column(s7_scheme *sc, s7_pointer args)
 			  string_length(str), str));
 }
 
+static s7_pointer g_format_compiled(s7_scheme *sc, s7_pointer args) /* port == $f, constant control string with a program */
+{
+  s7_pointer result = format_f_compiled(sc, cadr(args), cddr(args));
+  return((result) ? result : g_format_f(sc, args));
+}
+
 static s7_pointer format_chooser(s7_scheme *sc, s7_pointer f, int32_t args, s7_pointer expr, bool ops)
 {
   if (args > 1)
@@ -36499,6 +37882,8 @@ static s7_pointer format_chooser(s7_scheme *sc, s7_pointer f, int32_t args, s7_p
 		  ((orig[1] == 'A') || (orig[1] == 'a')))
 		return(sc->format_as_objstr);
 	    }
+	  if ((port == sc->F) && (format_program(sc, str_arg))) /* [c4augustus] */
+	    return(sc->format_compiled);
 	  /* this used to worry about optimized expr and particular cases -- why? I can't find a broken case */
 	  if (!is_columnizing(string_value(str_arg)))
 	    return(sc->format_no_column);
@@ -40300,10 +41685,6 @@ static s7_pointer subvector(s7_scheme *sc, s7_pointer vect, s7_int skip_dims, s7
       vector_set_dimension_info(x, NULL);
       subvector_set_vector(x, vect);
     }
-  if (is_normal_vector(vect))
-    mark_function[T_VECTOR] = mark_vector_possibly_shared;
-  else mark_function[type(vect)] = mark_int_or_float_vector_possibly_shared;
-
   vector_length(x) = (skip_dims > 0) ? vector_offset(vect, skip_dims - 1) : vector_length(vect);
   if (is_int_vector(vect))
     int_vector_ints(x) = (s7_int *)(int_vector_ints(vect) + index);
@@ -40408,10 +41789,6 @@ a vector that points to the same elements as the original-vector but with differ
 	      vdims_original(v) = orig;
 	    }}}
 
-  if (is_normal_vector(orig))
-    mark_function[T_VECTOR] = mark_vector_possibly_shared;
-  else mark_function[type(orig)] = mark_int_or_float_vector_possibly_shared; /* I think this works for byte-vectors also */
-
   new_cell(sc, x, (full_type(orig) & (~T_COLLECTED)) | T_SUBVECTOR | T_SAFE_PROCEDURE);
   vector_block(x) = mallocate_empty_block(sc);
   vector_set_dimension_info(x, v);
@@ -41854,6 +43231,342 @@ static s7_pointer float_vector_set_p_pip_direct(s7_scheme *sc, s7_pointer v, s7_
 }
 
 
+/* -------------------------------- float-vector kernels -------------------------------- */
+/* [c4augustus] whole-vector arithmetic, one call per vector instead of one dispatch per element.  Multidimensional
+ *   vectors and subvectors are processed as their flat run of elements.  The optional start and stride arguments
+ *   (0 and 1 by default) pick the elements start, start+stride, ... of every float-vector operand, so in an (n 3)
+ *   particle vector start 1 stride 3 is the y column.  Contiguous runs are plain enough for the compiler to vectorize
+ *   at the target's baseline (SSE2 on x64, NEON on arm64), and the reductions keep four partial results so that they
+ *   vectorize without -ffast-math.
+ */
+static noreturn void float_vector_length_error_nr(s7_scheme *sc, s7_pointer caller, s7_pointer arg_n, s7_pointer v)
+{
+  out_of_range_error_nr(sc, caller, arg_n, v, wrap_string(sc, "its length should match the first float-vector", 46));
+}
+
+#define float_vector_kernel_target(Sc, V, Caller, Args)	\
+  do {									\
+    if (!is_float_vector(V))						\
+      return(method_or_bust(Sc, V, Caller, Args, (Sc)->type_names[T_FLOAT_VECTOR], 1)); \
+    if (is_immutable_vector(V))						\
+      immutable_object_error_nr(Sc, set_elist_3(Sc, immutable_error_string, Caller, V)); \
+  } while (0)
+
+static s7_pointer float_vector_start_and_stride(s7_scheme *sc, s7_pointer caller, s7_pointer args, int32_t position, s7_pointer index_args,
+						s7_int len, s7_int *start, s7_int *stride)
+{
+  /* like start_and_end: *start=0 and *stride=1 unless index_args has them, returns sc->unused unless a method took over */
+  *start = 0;
+  *stride = 1;
+  if (is_pair(index_args))
+    {
+      s7_pointer pstart = car(index_args);
+      if (!s7_is_integer(pstart))
+	return(method_or_bust(sc, pstart, caller, args, sc->type_names[T_INTEGER], position));
+      *start = s7_integer_clamped_if_gmp(sc, pstart);
+      if ((*start < 0) || (*start > len))
+	out_of_range_error_nr(sc, caller, small_int(position), pstart, (*start < 0) ? it_is_negative_string : it_is_too_large_string);
+      if (is_pair(cdr(index_args)))
+	{
+	  s7_pointer pstride = cadr(index_args);
+	  if (!s7_is_integer(pstride))
+	    return(method_or_bust(sc, pstride, caller, args, sc->type_names[T_INTEGER], position + 1));
+	  *stride = s7_integer_clamped_if_gmp(sc, pstride);
+	  if (*stride <= 0)
+	    out_of_range_error_nr(sc, caller, small_int(position + 1), pstride, wrap_string(sc, "it should be positive", 21));
+	  if (*stride > len)
+	    *stride = (len > 0) ? len : 1; /* [c4augustus] a step past the end takes one element, and i += stride cannot overflow */
+	}}
+  return(sc->unused);
+}
+
+/* Body uses i, the loop is separate for stride 1 so that it can vectorize */
+#define float_vector_kernel_loop(Start, Len, Stride, Body)		\
+  do {									\
+    if ((Stride) == 1)							\
+      for (s7_int i = (Start); i < (Len); i++) {Body;}		\
+    else for (s7_int i = (Start); i < (Len); i += (Stride)) {Body;}	\
+  } while (0)
+
+static s7_pointer g_float_vector_add(s7_scheme *sc, s7_pointer args)
+{
+  #define H_float_vector_add "(float-vector-add! v x (start 0) (stride 1)) adds x to the elements start, start+stride, ... of the float-vector v \
+and returns v. x is a real or a float-vector the same length as v"
+  #define Q_float_vector_add s7_make_signature(sc, 5, sc->is_float_vector_symbol, sc->is_float_vector_symbol, \
+                               s7_make_signature(sc, 2, sc->is_real_symbol, sc->is_float_vector_symbol), sc->is_integer_symbol, sc->is_integer_symbol)
+  s7_pointer v = car(args), x = cadr(args), p;
+  s7_double *dst;
+  s7_int len, start, stride;
+
+  float_vector_kernel_target(sc, v, sc->float_vector_add_symbol, args);
+  dst = float_vector_floats(v);
+  len = vector_length(v);
+  p = float_vector_start_and_stride(sc, sc->float_vector_add_symbol, args, 3, cddr(args), len, &start, &stride);
+  if (p != sc->unused) return(p);
+  if (is_float_vector(x))
+    {
+      const s7_double *src = float_vector_floats(x);
+      if (vector_length(x) != len) float_vector_length_error_nr(sc, sc->float_vector_add_symbol, int_two, x);
+      float_vector_kernel_loop(start, len, stride, dst[i] += src[i]);
+    }
+  else
+    {
+      s7_double d;
+      if (!is_real(x)) return(method_or_bust(sc, x, sc->float_vector_add_symbol, args, sc->type_names[T_REAL], 2));
+      d = s7_real(x);
+      float_vector_kernel_loop(start, len, stride, dst[i] += d);
+    }
+  return(v);
+}
+
+static s7_pointer g_float_vector_scale(s7_scheme *sc, s7_pointer args)
+{
+  #define H_float_vector_scale "(float-vector-scale! v x (start 0) (stride 1)) multiplies the elements start, start+stride, ... of the float-vector v \
+by the real x and returns v"
+  #define Q_float_vector_scale s7_make_signature(sc, 5, sc->is_float_vector_symbol, sc->is_float_vector_symbol, sc->is_real_symbol, \
+                                 sc->is_integer_symbol, sc->is_integer_symbol)
+  s7_pointer v = car(args), x = cadr(args), p;
+  s7_double *dst;
+  s7_int len, start, stride;
+  s7_double d;
+
+  float_vector_kernel_target(sc, v, sc->float_vector_scale_symbol, args);
+  if (!is_real(x)) return(method_or_bust(sc, x, sc->float_vector_scale_symbol, args, sc->type_names[T_REAL], 2));
+  dst = float_vector_floats(v);
+  len = vector_length(v);
+  p = float_vector_start_and_stride(sc, sc->float_vector_scale_symbol, args, 3, cddr(args), len, &start, &stride);
+  if (p != sc->unused) return(p);
+  d = s7_real(x);
+  float_vector_kernel_loop(start, len, stride, dst[i] *= d);
+  return(v);
+}
+
+static s7_pointer g_float_vector_fma(s7_scheme *sc, s7_pointer args)
+{
+  #define H_float_vector_fma "(float-vector-fma! v a x (start 0) (stride 1)) adds a times x to the elements start, start+stride, ... of the float-vector v \
+and returns v. a is a float-vector the same length as v, x is a real or another such float-vector: (float-vector-fma! position velocity dt)"
+  #define Q_float_vector_fma s7_make_signature(sc, 6, sc->is_float_vector_symbol, sc->is_float_vector_symbol, sc->is_float_vector_symbol, \
+                               s7_make_signature(sc, 2, sc->is_real_symbol, sc->is_float_vector_symbol), sc->is_integer_symbol, sc->is_integer_symbol)
+  s7_pointer v = car(args), a = cadr(args), x = caddr(args), p;
+  s7_double *dst;
+  const s7_double *src;
+  s7_int len, start, stride;
+
+  float_vector_kernel_target(sc, v, sc->float_vector_fma_symbol, args);
+  if (!is_float_vector(a)) return(method_or_bust(sc, a, sc->float_vector_fma_symbol, args, sc->type_names[T_FLOAT_VECTOR], 2));
+  dst = float_vector_floats(v);
+  len = vector_length(v);
+  if (vector_length(a) != len) float_vector_length_error_nr(sc, sc->float_vector_fma_symbol, int_two, a);
+  p = float_vector_start_and_stride(sc, sc->float_vector_fma_symbol, args, 4, cdddr(args), len, &start, &stride);
+  if (p != sc->unused) return(p);
+  src = float_vector_floats(a);
+  if (is_float_vector(x))
+    {
+      const s7_double *scl = float_vector_floats(x);
+      if (vector_length(x) != len) float_vector_length_error_nr(sc, sc->float_vector_fma_symbol, int_three, x);
+      float_vector_kernel_loop(start, len, stride, dst[i] += src[i] * scl[i]);
+    }
+  else
+    {
+      s7_double d;
+      if (!is_real(x)) return(method_or_bust(sc, x, sc->float_vector_fma_symbol, args, sc->type_names[T_REAL], 3));
+      d = s7_real(x);
+      float_vector_kernel_loop(start, len, stride, dst[i] += src[i] * d);
+    }
+  return(v);
+}
+
+static s7_pointer g_float_vector_lerp(s7_scheme *sc, s7_pointer args)
+{
+  #define H_float_vector_lerp "(float-vector-lerp! v target x (start 0) (stride 1)) moves the elements start, start+stride, ... of the float-vector v \
+the fraction x (a real) of the way to target and returns v. target is a real or a float-vector the same length as v"
+  #define Q_float_vector_lerp s7_make_signature(sc, 6, sc->is_float_vector_symbol, sc->is_float_vector_symbol, \
+                               s7_make_signature(sc, 2, sc->is_real_symbol, sc->is_float_vector_symbol), sc->is_real_symbol, \
+                               sc->is_integer_symbol, sc->is_integer_symbol)
+  s7_pointer v = car(args), target = cadr(args), x = caddr(args), p;
+  s7_double *dst;
+  s7_int len, start, stride;
+  s7_double frac;
+
+  float_vector_kernel_target(sc, v, sc->float_vector_lerp_symbol, args);
+  if (!is_real(x)) return(method_or_bust(sc, x, sc->float_vector_lerp_symbol, args, sc->type_names[T_REAL], 3));
+  dst = float_vector_floats(v);
+  len = vector_length(v);
+  p = float_vector_start_and_stride(sc, sc->float_vector_lerp_symbol, args, 4, cdddr(args), len, &start, &stride);
+  if (p != sc->unused) return(p);
+  frac = s7_real(x);
+  if (is_float_vector(target))
+    {
+      const s7_double *src = float_vector_floats(target);
+      if (vector_length(target) != len) float_vector_length_error_nr(sc, sc->float_vector_lerp_symbol, int_two, target);
+      float_vector_kernel_loop(start, len, stride, dst[i] += (src[i] - dst[i]) * frac);
+    }
+  else
+    {
+      s7_double d;
+      if (!is_real(target)) return(method_or_bust(sc, target, sc->float_vector_lerp_symbol, args, sc->type_names[T_REAL], 2));
+      d = s7_real(target);
+      float_vector_kernel_loop(start, len, stride, dst[i] += (d - dst[i]) * frac);
+    }
+  return(v);
+}
+
+static s7_pointer g_float_vector_clamp(s7_scheme *sc, s7_pointer args)
+{
+  #define H_float_vector_clamp "(float-vector-clamp! v lo hi (start 0) (stride 1)) limits the elements start, start+stride, ... of the float-vector v \
+to the reals lo through hi and returns v"
+  #define Q_float_vector_clamp s7_make_signature(sc, 6, sc->is_float_vector_symbol, sc->is_float_vector_symbol, sc->is_real_symbol, sc->is_real_symbol, \
+                                 sc->is_integer_symbol, sc->is_integer_symbol)
+  s7_pointer v = car(args), lo = cadr(args), hi = caddr(args), p;
+  s7_double *dst;
+  s7_int len, start, stride;
+  s7_double dlo, dhi;
+
+  float_vector_kernel_target(sc, v, sc->float_vector_clamp_symbol, args);
+  if (!is_real(lo)) return(method_or_bust(sc, lo, sc->float_vector_clamp_symbol, args, sc->type_names[T_REAL], 2));
+  if (!is_real(hi)) return(method_or_bust(sc, hi, sc->float_vector_clamp_symbol, args, sc->type_names[T_REAL], 3));
+  dst = float_vector_floats(v);
+  len = vector_length(v);
+  p = float_vector_start_and_stride(sc, sc->float_vector_clamp_symbol, args, 4, cdddr(args), len, &start, &stride);
+  if (p != sc->unused) return(p);
+  dlo = s7_real(lo);
+  dhi = s7_real(hi);
+  float_vector_kernel_loop(start, len, stride,
+			   s7_double d = (dst[i] < dlo) ? dlo : dst[i]; /* compare-and-select so it becomes maxpd/minpd */
+			   dst[i] = (d > dhi) ? dhi : d);
+  return(v);
+}
+
+static s7_pointer g_float_vector_dot(s7_scheme *sc, s7_pointer args)
+{
+  #define H_float_vector_dot "(float-vector-dot v1 v2 (start 0) (stride 1)) returns the sum of the products of the elements start, start+stride, ... \
+of the equal length float-vectors v1 and v2"
+  #define Q_float_vector_dot s7_make_signature(sc, 5, sc->is_float_symbol, sc->is_float_vector_symbol, sc->is_float_vector_symbol, \
+                               sc->is_integer_symbol, sc->is_integer_symbol)
+  s7_pointer v1 = car(args), v2 = cadr(args), p;
+  const s7_double *a, *b;
+  s7_double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  s7_int len, start, stride, i;
+
+  if (!is_float_vector(v1)) return(method_or_bust(sc, v1, sc->float_vector_dot_symbol, args, sc->type_names[T_FLOAT_VECTOR], 1));
+  if (!is_float_vector(v2)) return(method_or_bust(sc, v2, sc->float_vector_dot_symbol, args, sc->type_names[T_FLOAT_VECTOR], 2));
+  len = vector_length(v1);
+  if (vector_length(v2) != len) float_vector_length_error_nr(sc, sc->float_vector_dot_symbol, int_two, v2);
+  p = float_vector_start_and_stride(sc, sc->float_vector_dot_symbol, args, 3, cddr(args), len, &start, &stride);
+  if (p != sc->unused) return(p);
+  a = float_vector_floats(v1);
+  b = float_vector_floats(v2);
+  if (stride != 1)
+    {
+      for (i = start; i < len; i += stride) s0 += a[i] * b[i];
+      return(make_real(sc, s0));
+    }
+  for (i = start; i + 4 <= len; i += 4)
+    {
+      s0 += a[i] * b[i];
+      s1 += a[i + 1] * b[i + 1];
+      s2 += a[i + 2] * b[i + 2];
+      s3 += a[i + 3] * b[i + 3];
+    }
+  for (; i < len; i++) s0 += a[i] * b[i];
+  return(make_real(sc, (s0 + s1) + (s2 + s3)));
+}
+
+static s7_pointer g_float_vector_sum(s7_scheme *sc, s7_pointer args)
+{
+  #define H_float_vector_sum "(float-vector-sum v (start 0) (stride 1)) returns the sum of the elements start, start+stride, ... of the float-vector v"
+  #define Q_float_vector_sum s7_make_signature(sc, 4, sc->is_float_symbol, sc->is_float_vector_symbol, sc->is_integer_symbol, sc->is_integer_symbol)
+  s7_pointer v = car(args), p;
+  const s7_double *a;
+  s7_double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  s7_int len, start, stride, i;
+
+  if (!is_float_vector(v)) return(method_or_bust(sc, v, sc->float_vector_sum_symbol, args, sc->type_names[T_FLOAT_VECTOR], 1));
+  len = vector_length(v);
+  p = float_vector_start_and_stride(sc, sc->float_vector_sum_symbol, args, 2, cdr(args), len, &start, &stride);
+  if (p != sc->unused) return(p);
+  a = float_vector_floats(v);
+  if (stride != 1)
+    {
+      for (i = start; i < len; i += stride) s0 += a[i];
+      return(make_real(sc, s0));
+    }
+  for (i = start; i + 4 <= len; i += 4)
+    {
+      s0 += a[i];
+      s1 += a[i + 1];
+      s2 += a[i + 2];
+      s3 += a[i + 3];
+    }
+  for (; i < len; i++) s0 += a[i];
+  return(make_real(sc, (s0 + s1) + (s2 + s3)));
+}
+
+static s7_pointer float_vector_extremum(s7_scheme *sc, s7_pointer args, s7_pointer caller, bool want_max)
+{
+  s7_pointer v = car(args), p;
+  const s7_double *a;
+  s7_double m0, m1, m2, m3;
+  s7_int len, start, stride, i;
+
+  if (!is_float_vector(v)) return(method_or_bust(sc, v, caller, args, sc->type_names[T_FLOAT_VECTOR], 1));
+  len = vector_length(v);
+  p = float_vector_start_and_stride(sc, caller, args, 2, cdr(args), len, &start, &stride);
+  if (p != sc->unused) return(p);
+  m0 = m1 = m2 = m3 = (want_max) ? -INFINITY : INFINITY;  /* so an empty vector gives the identity */
+  a = float_vector_floats(v);
+  if (stride != 1)
+    {
+      if (want_max)
+	for (i = start; i < len; i += stride) m0 = (a[i] > m0) ? a[i] : m0;
+      else for (i = start; i < len; i += stride) m0 = (a[i] < m0) ? a[i] : m0;
+      return(make_real(sc, m0));
+    }
+  i = start;
+  if (want_max)
+    {
+      for (; i + 4 <= len; i += 4)
+	{
+	  m0 = (a[i] > m0) ? a[i] : m0;
+	  m1 = (a[i + 1] > m1) ? a[i + 1] : m1;
+	  m2 = (a[i + 2] > m2) ? a[i + 2] : m2;
+	  m3 = (a[i + 3] > m3) ? a[i + 3] : m3;
+	}
+      for (; i < len; i++) m0 = (a[i] > m0) ? a[i] : m0;
+      m0 = (m1 > m0) ? m1 : m0;
+      m2 = (m3 > m2) ? m3 : m2;
+      return(make_real(sc, (m2 > m0) ? m2 : m0));
+    }
+  for (; i + 4 <= len; i += 4)
+    {
+      m0 = (a[i] < m0) ? a[i] : m0;
+      m1 = (a[i + 1] < m1) ? a[i + 1] : m1;
+      m2 = (a[i + 2] < m2) ? a[i + 2] : m2;
+      m3 = (a[i + 3] < m3) ? a[i + 3] : m3;
+    }
+  for (; i < len; i++) m0 = (a[i] < m0) ? a[i] : m0;
+  m0 = (m1 < m0) ? m1 : m0;
+  m2 = (m3 < m2) ? m3 : m2;
+  return(make_real(sc, (m2 < m0) ? m2 : m0));
+}
+
+static s7_pointer g_float_vector_min(s7_scheme *sc, s7_pointer args)
+{
+  #define H_float_vector_min "(float-vector-min v (start 0) (stride 1)) returns the smallest of the elements start, start+stride, ... of the float-vector v \
+(+inf.0 if there are none); NaN elements are skipped"
+  #define Q_float_vector_min s7_make_signature(sc, 4, sc->is_float_symbol, sc->is_float_vector_symbol, sc->is_integer_symbol, sc->is_integer_symbol)
+  return(float_vector_extremum(sc, args, sc->float_vector_min_symbol, false));
+}
+
+static s7_pointer g_float_vector_max(s7_scheme *sc, s7_pointer args)
+{
+  #define H_float_vector_max "(float-vector-max v (start 0) (stride 1)) returns the largest of the elements start, start+stride, ... of the float-vector v \
+(-inf.0 if there are none); NaN elements are skipped"
+  #define Q_float_vector_max s7_make_signature(sc, 4, sc->is_float_symbol, sc->is_float_vector_symbol, sc->is_integer_symbol, sc->is_integer_symbol)
+  return(float_vector_extremum(sc, args, sc->float_vector_max_symbol, true));
+}
+
+
 /* -------------------------------- int-vector-ref -------------------------------- */
 static s7_pointer g_int_vector_ref(s7_scheme *sc, s7_pointer args)
 {
@@ -42194,7 +43907,7 @@ static s7_pointer byte_vector_set_chooser(s7_scheme *sc, s7_pointer f, int32_t a
 /* -------------------------------------------------------------------------------- */
 static bool c_function_is_ok(s7_scheme *sc, s7_pointer x)
 {
-  s7_pointer p = lookup_unexamined(sc, car(x)); /* lookup_global is usually slower (faster in Snd) */
+  s7_pointer p = lookup_call_head(sc, car(x)); /* [c4augustus] was lookup_unexamined */
   if ((p == opt1_cfunc(x)) ||
       ((p) && (is_any_c_function(p)) && (c_function_class(p) == c_function_class(opt1_cfunc(x))) && (set_opt1_cfunc(x, p))))
     return(true);
@@ -42204,7 +43917,7 @@ static bool c_function_is_ok(s7_scheme *sc, s7_pointer x)
 
 static bool cl_function_is_ok(s7_scheme *sc, s7_pointer x)
 {
-  sc->last_function = lookup_unexamined(sc, car(x));
+  sc->last_function = lookup_call_head(sc, car(x));
   return(sc->last_function == opt1_cfunc(x));
 }
 
@@ -42219,21 +43932,6 @@ static bool arglist_has_rest(s7_scheme *sc, s7_pointer args)
 
 
 /* -------------------------------- sort! -------------------------------- */
-static int32_t dbl_less(const void *f1, const void *f2)
-{
-  if ((*((const s7_double *)f1)) < (*((const s7_double *)f2))) return(-1);
-  return(((*((const s7_double *)f1)) > (*((const s7_double *)f2))) ? 1 : 0);
-}
-
-static int32_t int_less(const void *f1, const void *f2)
-{
-  if ((*((const s7_int *)f1)) < (*((const s7_int *)f2))) return(-1);
-  return(((*((const s7_int *)f1)) > (*((const s7_int *)f2))) ? 1 : 0);
-}
-
-static int32_t dbl_greater(const void *f1, const void *f2) {return(-dbl_less(f1, f2));}
-static int32_t int_greater(const void *f1, const void *f2) {return(-int_less(f1, f2));}
-
 static int32_t byte_less(const void *f1, const void *f2)
 {
   if ((*((const uint8_t *)f1)) < (*((const uint8_t *)f2))) return(-1);
@@ -42242,25 +43940,6 @@ static int32_t byte_less(const void *f1, const void *f2)
 
 static int32_t byte_greater(const void *f1, const void *f2) {return(-byte_less(f1, f2));}
 
-static int32_t dbl_less_2(const void *f1, const void *f2)
-{
-  s7_double p1 = real(*((const s7_pointer *)f1));
-  s7_double p2 = real(*((const s7_pointer *)f2));
-  if (p1 < p2) return(-1);
-  return((p1 > p2) ? 1 : 0);
-}
-
-static int32_t int_less_2(const void *f1, const void *f2)
-{
-  s7_int p1 = integer(*((const s7_pointer *)f1));
-  s7_int p2 = integer(*((const s7_pointer *)f2));
-  if (p1 < p2) return(-1);
-  return((p1 > p2) ? 1 : 0);
-}
-
-static int32_t dbl_greater_2(const void *f1, const void *f2) {return(-dbl_less_2(f1, f2));}
-static int32_t int_greater_2(const void *f1, const void *f2) {return(-int_less_2(f1, f2));}
-
 static int32_t str_less_2(const void *f1, const void *f2)
 {
   s7_pointer p1 = (*((const s7_pointer *)f1));
@@ -42280,6 +43959,138 @@ static int32_t chr_less_2(const void *f1, const void *f2)
 
 static int32_t chr_greater_2(const void *f1, const void *f2) {return(-chr_less_2(f1, f2));}
 
+/* [c4augustus] radix sort for numbers compared by <<, >>, <= or >=:
+ *   each number becomes an unsigned 64-bit key whose unsigned order is the numeric order, then an LSD radix
+ *   sort makes one pass per key byte, skipping the bytes on which every key agrees (small ints need one or two).
+ *   Descending sorts complement the keys, so the sort stays stable.  Short runs use an insertion sort instead.
+ *   -0.0 sorts before 0.0, and NaNs land past the infinities of their sign (qsort left them wherever).
+ */
+#define RADIX_SORT_MIN 48
+#define SORT_KEY_SIGN ((uint64_t)1 << 63)
+
+typedef struct {uint64_t key; s7_int loc;} sort_key_t;
+
+static inline uint64_t int_sort_key(s7_int i) {return((uint64_t)i ^ SORT_KEY_SIGN);}
+static inline s7_int sort_key_to_int(uint64_t u) {return((s7_int)(u ^ SORT_KEY_SIGN));}
+
+static inline uint64_t dbl_sort_key(s7_double x)
+{
+  uint64_t u;
+  memcpy((void *)&u, (void *)&x, sizeof(uint64_t));
+  return((u & SORT_KEY_SIGN) ? ~u : (u | SORT_KEY_SIGN));
+}
+
+static inline s7_double sort_key_to_dbl(uint64_t u)
+{
+  s7_double x;
+  u = (u & SORT_KEY_SIGN) ? (u ^ SORT_KEY_SIGN) : ~u;
+  memcpy((void *)&x, (void *)&u, sizeof(s7_double));
+  return(x);
+}
+
+#define u64_sort_key(X) (X)
+#define pair_sort_key(X) ((X).key)
+
+#define define_radix_sort(Name, Type, Key)				\
+  static void Name(Type *data, Type *scratch, s7_int len)		\
+  {									\
+    s7_int counts[8][256];						\
+    Type *src = data, *dst = scratch;					\
+    if (len < RADIX_SORT_MIN)						\
+      {									\
+	for (s7_int i = 1; i < len; i++)				\
+	  {								\
+	    Type x = data[i];						\
+	    s7_int j = i - 1;						\
+	    for (; (j >= 0) && (Key(data[j]) > Key(x)); j--)		\
+	      data[j + 1] = data[j];					\
+	    data[j + 1] = x;						\
+	  }								\
+	return;								\
+      }									\
+    memclr((void *)counts, sizeof(counts));				\
+    for (s7_int i = 0; i < len; i++)					\
+      {									\
+	uint64_t k = Key(data[i]);					\
+	for (int32_t b = 0; b < 8; b++)					\
+	  counts[b][(k >> (b * 8)) & 0xff]++;				\
+      }									\
+    for (int32_t b = 0; b < 8; b++)					\
+      {									\
+	s7_int *c = counts[b], total = 0;				\
+	int32_t shift = b * 8;						\
+	Type *tmp;							\
+	if (c[(Key(src[0]) >> shift) & 0xff] == len) continue;		\
+	for (int32_t j = 0; j < 256; j++)				\
+	  {								\
+	    s7_int n = c[j];						\
+	    c[j] = total;						\
+	    total += n;							\
+	  }								\
+	for (s7_int i = 0; i < len; i++)				\
+	  dst[c[(Key(src[i]) >> shift) & 0xff]++] = src[i];		\
+	tmp = src; src = dst; dst = tmp;				\
+      }									\
+    if (src != data) memcpy((void *)data, (void *)src, len * sizeof(Type)); \
+  }
+
+define_radix_sort(radix_sort_u64, uint64_t, u64_sort_key)
+define_radix_sort(radix_sort_keys, sort_key_t, pair_sort_key)
+
+static bool is_numeric_sort_f(s7_scheme *sc) {return((sc->sort_f == lt_b_7pp) || (sc->sort_f == gt_b_7pp) || (sc->sort_f == leq_b_7pp) || (sc->sort_f == geq_b_7pp));}
+static bool is_descending_sort_f(s7_scheme *sc) {return((sc->sort_f == gt_b_7pp) || (sc->sort_f == geq_b_7pp));}
+
+static void radix_sort_fi_vector(s7_scheme *sc, s7_pointer vect, bool descending)
+{
+  s7_int len = vector_length(vect);
+  block_t *b = mallocate(sc, 2 * len * sizeof(uint64_t));
+  uint64_t *keys = (uint64_t *)block_data(b);
+  uint64_t flip = (descending) ? ~((uint64_t)0) : 0;
+  if (is_float_vector(vect))
+    {
+      s7_double *flts = float_vector_floats(vect);
+      for (s7_int i = 0; i < len; i++) keys[i] = dbl_sort_key(flts[i]) ^ flip;
+      radix_sort_u64(keys, keys + len, len);
+      for (s7_int i = 0; i < len; i++) flts[i] = sort_key_to_dbl(keys[i] ^ flip);
+    }
+  else
+    {
+      s7_int *ints = int_vector_ints(vect);
+      for (s7_int i = 0; i < len; i++) keys[i] = int_sort_key(ints[i]) ^ flip;
+      radix_sort_u64(keys, keys + len, len);
+      for (s7_int i = 0; i < len; i++) ints[i] = sort_key_to_int(keys[i] ^ flip);
+    }
+  liberate(sc, b);
+}
+
+static int32_t numeric_sort_type(s7_pointer *els, s7_int len) /* T_INTEGER or T_REAL if every element has that type, else T_FREE */
+{
+  int32_t typ = type(els[0]);
+  if ((typ != T_INTEGER) && (typ != T_REAL)) return(T_FREE);
+  for (s7_int i = 1; i < len; i++)
+    if (type(els[i]) != typ)
+      return(T_FREE);
+  return(typ);
+}
+
+static void radix_sort_numbers(s7_scheme *sc, s7_pointer *els, s7_int len, int32_t typ, bool descending)
+{
+  /* els are all typ (T_INTEGER or T_REAL), the cells themselves are moved so eq?-ness is kept */
+  block_t *b = mallocate(sc, 2 * len * sizeof(sort_key_t));
+  sort_key_t *keys = (sort_key_t *)block_data(b);
+  s7_pointer *sorted = (s7_pointer *)(keys + len);
+  uint64_t flip = (descending) ? ~((uint64_t)0) : 0;
+  for (s7_int i = 0; i < len; i++)
+    {
+      keys[i].key = ((typ == T_INTEGER) ? int_sort_key(integer(els[i])) : dbl_sort_key(real(els[i]))) ^ flip;
+      keys[i].loc = i;
+    }
+  radix_sort_keys(keys, keys + len, len);
+  for (s7_int i = 0; i < len; i++) sorted[i] = els[keys[i].loc];
+  memcpy((void *)els, (void *)sorted, len * sizeof(s7_pointer));
+  liberate(sc, b);
+}
+
 #if MS_WINDOWS || defined(__APPLE__) || defined(__FreeBSD__)
 struct sort_r_data {void *arg; int32_t (*compar)(const void *a1, const void *a2, void *aarg);};
 
@@ -42470,6 +44281,7 @@ static opt_info *alloc_opt_info(s7_scheme *sc);
 static bool bool_optimize(s7_scheme *sc, s7_pointer expr);
 static bool bool_optimize_nw(s7_scheme *sc, s7_pointer expr);
 static bool cell_optimize(s7_scheme *sc, s7_pointer expr);
+static s7_pfunc s7_cell_optimize(s7_scheme *sc, s7_pointer expr, bool nv);
 
 static s7_pointer g_sort(s7_scheme *sc, s7_pointer args)
 {
@@ -42658,7 +44470,9 @@ static s7_pointer g_sort(s7_scheme *sc, s7_pointer args)
 	  s7_pointer vec = g_vector(sc, data);
 	  gc_protect_2_via_stack(sc, vec, data);
 	  elements = s7_vector_elements(vec);
-	  local_qsort_r((void *)elements, len, sizeof(s7_pointer), sort_func, (void *)sc);
+	  if ((is_numeric_sort_f(sc)) && (numeric_sort_type(elements, len) != T_FREE)) /* [c4augustus] */
+	    radix_sort_numbers(sc, elements, len, numeric_sort_type(elements, len), is_descending_sort_f(sc));
+	  else local_qsort_r((void *)elements, len, sizeof(s7_pointer), sort_func, (void *)sc);
 	  for (s7_pointer p = data; i < len; i++, p = cdr(p))
 	    {
 	      if (is_immutable_pair(p))
@@ -42732,22 +44546,11 @@ static s7_pointer g_sort(s7_scheme *sc, s7_pointer args)
 	len = vector_length(data);
 	if (len < 2)
 	  return(data);
-	if (is_c_function(lessp))
+	if ((is_c_function(lessp)) && (is_numeric_sort_f(sc)))
 	  {
-	    if (sc->sort_f == lt_b_7pp)
-	      {
-		if (is_float_vector(data))
-		  qsort((void *)float_vector_floats(data), len, sizeof(s7_double), dbl_less);
-		else qsort((void *)int_vector_ints(data), len, sizeof(s7_int), int_less);
-		return(data);
-	      }
-	    if (sc->sort_f == gt_b_7pp)
-	      {
-		if (is_float_vector(data))
-		  qsort((void *)float_vector_floats(data), len, sizeof(s7_double), dbl_greater);
-		else qsort((void *)int_vector_ints(data), len, sizeof(s7_int), int_greater);
-		return(data);
-	      }}
+	    radix_sort_fi_vector(sc, data, is_descending_sort_f(sc)); /* [c4augustus] was qsort */
+	    return(data);
+	  }
 	/* currently we have to make the ordinary vector here even if not sf1
 	 *   because the sorter uses vector_element to access sort args (see SORT_DATA in eval).
 	 *   This is probably better than passing down getter/setter (fewer allocations).
@@ -42796,18 +44599,11 @@ static s7_pointer g_sort(s7_scheme *sc, s7_pointer args)
 		  typ = T_FREE;
 		  break;
 		}
-	  if ((sc->sort_f == lt_b_7pp) || (sc->sort_f == gt_b_7pp))
+	  if ((is_numeric_sort_f(sc)) && ((typ == T_INTEGER) || (typ == T_REAL)))
 	    {
-	      if (typ == T_INTEGER)
-		{
-		  qsort((void *)els, len, sizeof(s7_pointer), ((sc->sort_f == lt_b_7pp) ? int_less_2 : int_greater_2));
-		  return(data);
-		}
-	      if (typ == T_REAL)
-		{
-		  qsort((void *)els, len, sizeof(s7_pointer), ((sc->sort_f == lt_b_7pp) ? dbl_less_2 : dbl_greater_2));
-		  return(data);
-		}}
+	      radix_sort_numbers(sc, els, len, typ, is_descending_sort_f(sc)); /* [c4augustus] was qsort */
+	      return(data);
+	    }
 	  if ((typ == T_STRING) &&
 	      ((sc->sort_f == string_lt_b_7pp) || (sc->sort_f == string_gt_b_7pp)))
 	    {
@@ -42851,6 +44647,157 @@ static s7_pointer g_sort(s7_scheme *sc, s7_pointer args)
    */
 }
 
+/* [c4augustus] sort-by! calls key once per element instead of twice per comparison, so (sort-by! candidates score >>)
+ *   costs n calls of score.  Real keys under the numeric comparators use the radix sort above, anything else is
+ *   sorted as indices with qsort_r.  key and less? can be any procedure since they are called through s7_call.
+ */
+typedef struct {s7_scheme *sc; s7_pointer *keys; s7_pointer lessp; s7_b_7pp_t f;} sort_by_info_t;
+
+static int32_t sort_by_compare(const void *v1, const void *v2, void *arg)
+{
+  sort_by_info_t *info = (sort_by_info_t *)arg;
+  s7_scheme *sc = info->sc;
+  s7_pointer k1 = info->keys[*(const s7_int *)v1], k2 = info->keys[*(const s7_int *)v2];
+  if (info->f) return((info->f(sc, k1, k2)) ? -1 : 1);
+  return((s7_call(sc, info->lessp, list_2(sc, k1, k2)) != sc->F) ? -1 : 1);
+}
+
+static void sort_by_keys(s7_scheme *sc, s7_pointer key, s7_pointer *elements, s7_pointer *keys, s7_int len)
+{
+  /* as in g_map_closure, a one-parameter closure whose body optimizes runs on a let slot rather than through s7_call */
+  if ((is_closure(key)) && (sc->map_call_ctr == 0) &&
+      (is_pair(closure_args(key))) && (is_null(cdr(closure_args(key)))) &&
+      (is_null(cdr(closure_body(key)))) && (!no_cell_opt(closure_body(key))))
+    {
+      s7_pointer old_e = sc->curlet, pars = closure_args(key), slot;
+      s7_pfunc func;
+      sc->curlet = inline_make_let_with_slot(sc, closure_let(key), (is_pair(car(pars))) ? caar(pars) : car(pars), sc->F);
+      slot = let_slots(sc->curlet);
+      func = s7_cell_optimize(sc, closure_body(key), false);
+      if (func)
+	{
+	  push_stack_no_let(sc, OP_MAP_UNWIND, key, sc->nil);
+	  sc->map_call_ctr++;
+	  for (s7_int i = 0; i < len; i++)
+	    {
+	      slot_set_value(slot, elements[i]);
+	      keys[i] = func(sc);
+	    }
+	  sc->map_call_ctr--;
+	  unstack_with(sc, OP_MAP_UNWIND);
+	  set_curlet(sc, old_e);
+	  return;
+	}
+      set_no_cell_opt(closure_body(key));
+      set_curlet(sc, old_e);
+    }
+  for (s7_int i = 0; i < len; i++)
+    keys[i] = s7_call(sc, key, set_plist_1(sc, elements[i]));
+}
+
+static s7_pointer g_sort_by(s7_scheme *sc, s7_pointer args)
+{
+  #define H_sort_by "(sort-by! sequence key (less? <<)) sorts a list or vector by (key element), calling key once per element and comparing the results with 'less?'."
+  #define Q_sort_by s7_make_signature(sc, 4, sc->is_sequence_symbol, sc->is_sequence_symbol, sc->is_procedure_symbol, sc->is_procedure_symbol)
+
+  s7_pointer data = car(args), key = cadr(args), lessp, vec, order;
+  s7_pointer *elements, *keys;
+  s7_int len, *locs;
+  s7_b_7pp_t f = NULL;
+  bool radix_sorted = false;
+
+  if ((!is_pair(data)) && (!is_null(data)) && (!is_normal_vector(data)))
+    return(method_or_bust(sc, data, sc->sort_by_symbol, args, wrap_string(sc, "a list or vector", 16), 1));
+  if ((is_immutable(data)) && (!is_null(data)))
+    immutable_object_error_nr(sc, set_elist_3(sc, immutable_error_string, sc->sort_by_symbol, data));
+  if ((type(key) <= T_GOTO) || (!s7_is_aritable(sc, key, 1)))
+    wrong_type_error_nr(sc, sc->sort_by_symbol, 2, key, a_normal_procedure_string);
+  lessp = (is_pair(cddr(args))) ? caddr(args) : global_value(sc->lt_symbol);
+  if (type(lessp) <= T_GOTO)
+    wrong_type_error_nr(sc, sc->sort_by_symbol, 3, lessp, a_normal_procedure_string);
+  if (!s7_is_aritable(sc, lessp, 2))
+    wrong_type_error_nr(sc, sc->sort_by_symbol, 3, lessp, an_eq_func_string);
+
+  if (is_pair(data))
+    {
+      len = s7_list_length(sc, data);
+      if (len <= 0)
+	error_nr(sc, sc->wrong_type_arg_symbol,
+		 set_elist_2(sc, wrap_string(sc, "sort-by! first argument should be a proper list: ~S", 51), data));
+    }
+  else len = (is_null(data)) ? 0 : vector_length(data);
+  if (len < 2) return(data);
+
+  /* elements in the first half of vec, their keys in the second; the elements are copied so key can't disturb them */
+  vec = make_simple_vector(sc, 2 * len);
+  elements = vector_elements(vec);
+  keys = elements + len;
+  if (is_pair(data))
+    {
+      s7_int i = 0;
+      for (s7_pointer p = data; i < len; i++, p = cdr(p)) elements[i] = car(p);
+    }
+  else memcpy((void *)elements, (void *)vector_elements(data), len * sizeof(s7_pointer));
+  for (s7_int i = 0; i < len; i++) keys[i] = sc->F;
+  order = make_simple_int_vector(sc, len);
+  locs = int_vector_ints(order);
+  gc_protect_2_via_stack(sc, vec, order);
+  gc_protect_via_stack(sc, args); /* key might drop the last reference to data or to itself */
+
+  sort_by_keys(sc, key, elements, keys, len);
+
+  if (is_safe_c_function(lessp))
+    f = s7_b_7pp_function(lessp);
+  if ((f == lt_b_7pp) || (f == gt_b_7pp) || (f == leq_b_7pp) || (f == geq_b_7pp))
+    {
+      int32_t typ = numeric_sort_type(keys, len);
+      if (typ == T_FREE)
+	for (s7_int i = 0; i < len; i++)
+	  if (!is_real(keys[i]))
+	    {
+	      typ = T_UNUSED;
+	      break;
+	    }
+      if (typ != T_UNUSED)
+	{
+	  block_t *b = mallocate(sc, 2 * len * sizeof(sort_key_t));
+	  sort_key_t *sorted = (sort_key_t *)block_data(b);
+	  uint64_t flip = ((f == gt_b_7pp) || (f == geq_b_7pp)) ? ~((uint64_t)0) : 0;
+	  for (s7_int i = 0; i < len; i++)
+	    {
+	      sorted[i].key = ((typ == T_INTEGER) ? int_sort_key(integer(keys[i])) : dbl_sort_key(s7_real(keys[i]))) ^ flip;
+	      sorted[i].loc = i;
+	    }
+	  radix_sort_keys(sorted, sorted + len, len);
+	  for (s7_int i = 0; i < len; i++) locs[i] = sorted[i].loc;
+	  liberate(sc, b);
+	  radix_sorted = true;
+	}}
+  if (!radix_sorted)
+    {
+      sort_by_info_t info = {sc, keys, lessp, f};
+      for (s7_int i = 0; i < len; i++) locs[i] = i;
+      local_qsort_r((void *)locs, len, sizeof(s7_int), sort_by_compare, (void *)&info);
+    }
+
+  /* keys are no longer needed, so their half of vec holds the sorted elements */
+  for (s7_int i = 0; i < len; i++) keys[i] = elements[locs[i]];
+  if (is_pair(data))
+    {
+      s7_int i = 0;
+      for (s7_pointer p = data; (i < len) && (is_pair(p)); i++, p = cdr(p))
+	{
+	  if (is_immutable_pair(p))
+	    immutable_object_error_nr(sc, set_elist_3(sc, immutable_error_string, sc->sort_by_symbol, data));
+	  set_car(p, keys[i]);
+	}
+    }
+  else memcpy((void *)vector_elements(data), (void *)keys, len * sizeof(s7_pointer));
+  unstack(sc); /* not pop_stack! */
+  unstack(sc);
+  return(data);
+}
+
 /* these are for the eval sort -- sort a vector, then if necessary put that data into the original sequence */
 static s7_pointer vector_into_list(s7_scheme *sc, s7_pointer vect, s7_pointer lst)
 {
@@ -43006,35 +44953,88 @@ static bool op_sort3(s7_scheme *sc)
 
 static void free_hash_table(s7_scheme *sc, s7_pointer table)
 {
-  if (hash_table_entries(table) > 0)
-    {
-      hash_entry_t **entries = hash_table_elements(table);
-      s7_int len = hash_table_mask(table) + 1;
-      for (s7_int i = 0; i < len; i++)
-	{
-	  hash_entry_t *n;
-	  for (hash_entry_t *p = entries[i++]; p; p = n)
-	    {
-	      n = hash_entry_next(p);
-	      liberate_block(sc, p);
-	    }
-	  for (hash_entry_t *p = entries[i]; p; p = n)
-	    {
-	      n = hash_entry_next(p);
-	      liberate_block(sc, p);
-	    }}}
-  liberate(sc, hash_table_block(table));
+  liberate(sc, hash_table_block(table)); /* [c4augustus] the entries live in the block */
+}
+
+/* [c4augustus] the elements are one flat array of entries with linear probing, plus one slot past the end
+ *   that holds the count of removed entries.  An entry's home slot is a Fibonacci hash of its raw hash, so
+ *   neighbouring raw hashes (pointers, small integers) do not pile up in a run.  A lookup scans from the home
+ *   slot to the first unused slot, passing over removed entries, and the checkers compare raw hashes
+ *   where they did before.  Inserts keep at least half the slots unused, so every scan is short and ends.
+ */
+static inline s7_int hash_table_home(s7_pointer table, s7_int raw_hash)
+{
+  return((s7_int)(((uint64_t)raw_hash * 0x9e3779b97f4a7c15ULL) >> 32) & hash_table_mask(table));
+}
+
+static inline hash_entry_t *hash_table_scan(s7_pointer table, s7_int loc)
+{
+  hash_entry_t *elements = hash_table_elements(table);
+  s7_int hash_mask = hash_table_mask(table);
+  for (hash_entry_t *x = &elements[loc]; !hash_entry_is_unused(x); x = &elements[loc = ((loc + 1) & hash_mask)])
+    if (hash_entry_is_live(x))
+      return(x);
+  return(NULL);
 }
 
-static hash_entry_t *make_hash_entry(s7_scheme *sc, s7_pointer key, s7_pointer value, s7_int raw_hash)
+static inline hash_entry_t *hash_table_first(s7_pointer table, s7_int raw_hash)
 {
-  hash_entry_t *p = (hash_entry_t *)mallocate_block(sc);
+  return(hash_table_scan(table, hash_table_home(table, raw_hash)));
+}
+
+static inline hash_entry_t *hash_table_next(s7_pointer table, hash_entry_t *x)
+{
+  return(hash_table_scan(table, ((x - hash_table_elements(table)) + 1) & hash_table_mask(table)));
+}
+
+static hash_entry_t *hash_table_place(s7_pointer table, s7_pointer key, s7_pointer value, s7_int raw_hash)
+{
+  /* the caller has already looked for key */
+  hash_entry_t *elements = hash_table_elements(table);
+  s7_int hash_mask = hash_table_mask(table);
+  s7_int loc = hash_table_home(table, raw_hash);
+  hash_entry_t *p;
+  while (hash_entry_is_live(&elements[loc])) loc = (loc + 1) & hash_mask;
+  p = &elements[loc];
+  if (hash_entry_value(p)) hash_table_removed(table)--; /* reusing a removed entry's slot */
   hash_entry_key(p) = key;
   hash_entry_set_value(p, value);
   hash_entry_set_raw_hash(p, raw_hash);
+  hash_table_entries(table)++;
   return(p);
 }
 
+static void resize_hash_table(s7_scheme *sc, s7_pointer table)
+{
+  s7_int entries = hash_table_entries(table);
+  hash_entry_t *old_els = hash_table_elements(table);
+  block_t *old_block = hash_table_block(table);
+  s7_pointer dproc = hash_table_procedures(table); /* new block_t so we need to pass this across */
+  uint32_t iters = weak_hash_iters(table);         /*   and this */
+  s7_int old_size = hash_table_mask(table) + 1;
+  s7_int new_size = (entries * 8 > old_size * 3) ? (old_size * 2) : old_size; /* mostly removed entries: rehash in place */
+  block_t *np = (block_t *)callocate(sc, (new_size + 1) * sizeof(hash_entry_t));
+
+  hash_table_set_block(table, np);
+  hash_table_elements(table) = (hash_entry_t *)(block_data(np));
+  hash_table_mask(table) = new_size - 1;
+  hash_table_set_procedures(table, dproc);
+  weak_hash_iters(table) = iters;
+  hash_table_entries(table) = 0;
+  hash_table_removed(table) = 0;
+  for (s7_int i = 0; i < old_size; i++)
+    if (hash_entry_is_live(&old_els[i]))
+      hash_table_place(table, hash_entry_key(&old_els[i]), hash_entry_value(&old_els[i]), hash_entry_raw_hash(&old_els[i]));
+  liberate(sc, old_block);
+}
+
+static inline void hash_table_insert(s7_scheme *sc, s7_pointer table, s7_pointer key, s7_pointer value, s7_int raw_hash)
+{
+  hash_table_place(table, key, value, raw_hash);
+  if ((hash_table_entries(table) + hash_table_removed(table)) * 2 > hash_table_mask(table) + 1)
+    resize_hash_table(sc, table);
+}
+
 
 /* -------------------------------- hash-table? -------------------------------- */
 bool s7_is_hash_table(s7_pointer p) {return(is_hash_table(p));}
@@ -43256,8 +45256,8 @@ static s7_int hash_map_syntax(s7_scheme *sc, s7_pointer table, s7_pointer key)
 
 static hash_entry_t *hash_equal_syntax(s7_scheme *sc, s7_pointer table, s7_pointer key)
 {
-  s7_int loc = hash_loc(sc, table, key) & hash_table_mask(table);
-  for (hash_entry_t *x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+  s7_int loc = hash_loc(sc, table, key);
+  for (hash_entry_t *x = hash_table_first(table, loc); x; x = hash_table_next(table, x))
     if ((is_syntax(hash_entry_key(x))) &&
 	(syntax_symbol(hash_entry_key(x)) == syntax_symbol(key))) /* the opcodes might differ, but the symbols should not */
       return(x);
@@ -43269,7 +45269,7 @@ static s7_int hash_map_symbol(s7_scheme *sc, s7_pointer table, s7_pointer key)
 
 static hash_entry_t *hash_symbol(s7_scheme *sc, s7_pointer table, s7_pointer key)
 {
-  for (hash_entry_t *x = hash_table_element(table, pointer_map(key) & hash_table_mask(table)); x; x = hash_entry_next(x))
+  for (hash_entry_t *x = hash_table_first(table, pointer_map(key)); x; x = hash_table_next(table, x))
     if (key == hash_entry_key(x))
       return(x);
   return(sc->unentry);
@@ -43328,16 +45328,16 @@ static s7_int hash_map_big_complex(s7_scheme *sc, s7_pointer table, s7_pointer k
 }
 #endif
 
-static hash_entry_t *find_number_in_bin(s7_scheme *sc, hash_entry_t *bin, s7_pointer key)
+static hash_entry_t *find_number_in_bin(s7_scheme *sc, s7_pointer table, s7_int raw_hash, s7_pointer key)
 {
   s7_double old_eps = sc->equivalent_float_epsilon;
   bool (*equiv)(s7_scheme *sc, s7_pointer x, s7_pointer y, shared_info_t *ci) = equivalents[type(key)];
   sc->equivalent_float_epsilon = sc->hash_table_float_epsilon;
-  for (; bin; bin = hash_entry_next(bin))
-    if (equiv(sc, key, hash_entry_key(bin), NULL))
+  for (hash_entry_t *x = hash_table_first(table, raw_hash); x; x = hash_table_next(table, x))
+    if (equiv(sc, key, hash_entry_key(x), NULL))
       {
 	sc->equivalent_float_epsilon = old_eps;
-	return(bin);
+	return(x);
       }
   sc->equivalent_float_epsilon = old_eps;
   return(NULL);
@@ -43345,15 +45345,16 @@ static hash_entry_t *find_number_in_bin(s7_scheme *sc, hash_entry_t *bin, s7_poi
 
 static hash_entry_t *hash_number_equivalent(s7_scheme *sc, s7_pointer table, s7_pointer key)
 {
-  /* for equivalent? and =, kind of complicated because two bins can be involved if the key is close to an integer */
+  /* for equivalent? and =, kind of complicated because two bins can be involved if the key is close to an integer,
+   *   [c4augustus] a bin is the raw hash (not masked), so the neighbouring bins are raw hash +/- 1
+   */
 #if WITH_GMP
   /* first try loc from hash_loc, then get key-floor(key) [with abs], and check against
    *   epsilon: diff < eps call find big in bin-1, diff > 1.0-eps call same in bin+1
    */
-  s7_int loc1, hash_mask = hash_table_mask(table);
+  s7_int loc1;
   s7_int loc = hash_loc(sc, table, key);
-  s7_int hash_loc = loc & hash_mask;
-  hash_entry_t *i1 = find_number_in_bin(sc, hash_table_element(table, hash_loc), key);
+  hash_entry_t *i1 = find_number_in_bin(sc, table, loc, key);
   if (i1) return(i1);
 
   if (is_real(key))
@@ -43373,9 +45374,7 @@ static hash_entry_t *hash_number_equivalent(s7_scheme *sc, s7_pointer table, s7_
   loc1 = mpz_get_si(sc->mpz_1);
   if (loc1 != loc)
     {
-      if (loc1 == hash_table_mask(table)) loc1 = 0;
-      hash_loc = loc1 & hash_mask;
-      i1 = find_number_in_bin(sc, hash_table_element(table, hash_loc), key);
+      i1 = find_number_in_bin(sc, table, loc1, key);
       return((i1) ? i1 : sc->unentry);
     }
   mpfr_sub_d(sc->mpfr_2, sc->mpfr_1, sc->hash_table_float_epsilon, MPFR_RNDN);
@@ -43383,9 +45382,7 @@ static hash_entry_t *hash_number_equivalent(s7_scheme *sc, s7_pointer table, s7_
   loc1 = mpz_get_si(sc->mpz_1);
   if (loc1 != loc)
     {
-      if (loc1 < 0) loc1 = hash_table_mask(table);
-      hash_loc = loc1 & hash_mask;
-      i1 = find_number_in_bin(sc, hash_table_element(table, hash_loc), key);
+      i1 = find_number_in_bin(sc, table, loc1, key);
       if (i1) return(i1);
     }
   return(sc->unentry);
@@ -43394,15 +45391,14 @@ static hash_entry_t *hash_number_equivalent(s7_scheme *sc, s7_pointer table, s7_
   s7_double fprobe = fabs(keyval);
   s7_int iprobe = (s7_int)floor(fprobe);
   s7_double bin_dist = fprobe - iprobe;
-  s7_int loc = iprobe & hash_table_mask(table);
-  hash_entry_t *i1 = find_number_in_bin(sc, hash_table_element(table, loc), key);
+  hash_entry_t *i1 = find_number_in_bin(sc, table, iprobe, key);
   if (i1) return(i1);
 
   if (bin_dist <= sc->hash_table_float_epsilon)        /* maybe closest is below iprobe, key+eps>iprobe but key maps to iprobe-1 */
-    i1 = find_number_in_bin(sc, hash_table_element(table, (loc > 0) ? loc - 1 : hash_table_mask(table)), key);
+    i1 = find_number_in_bin(sc, table, iprobe - 1, key);
   else
     if (bin_dist >= (1.0 - sc->hash_table_float_epsilon))
-      i1 = find_number_in_bin(sc, hash_table_element(table, (loc < hash_table_mask(table)) ? loc + 1 : 0), key);
+      i1 = find_number_in_bin(sc, table, iprobe + 1, key);
   return((i1) ? i1 : sc->unentry);
 #endif
 }
@@ -43415,15 +45411,14 @@ static hash_entry_t *hash_int(s7_scheme *sc, s7_pointer table, s7_pointer key)
   if (is_t_integer(key))
 #endif
     {
-      s7_int hash_mask = hash_table_mask(table);
       hash_entry_t *x;
 #if WITH_GMP
       s7_int kv = (is_t_integer(key)) ? integer(key) : mpz_get_si(big_integer(key));
 #else
       s7_int kv = integer(key);
 #endif
-      s7_int loc = s7_int_abs(kv) & hash_mask;
-      for (x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+      s7_int loc = s7_int_abs(kv);
+      for (x = hash_table_first(table, loc); x; x = hash_table_next(table, x))
 #if WITH_GMP
 	if (is_t_integer(hash_entry_key(x)))
 	  {
@@ -43452,7 +45447,7 @@ static hash_entry_t *hash_float(s7_scheme *sc, s7_pointer table, s7_pointer key)
 #endif
     {
       s7_double keyval;
-      s7_int loc, hash_mask;
+      s7_int loc;
 #if WITH_GMP
       if (is_t_real(key))
 	{
@@ -43468,10 +45463,9 @@ static hash_entry_t *hash_float(s7_scheme *sc, s7_pointer table, s7_pointer key)
       keyval = real(key);
       if (is_NaN(keyval)) return(sc->unentry);
 #endif
-      hash_mask = hash_table_mask(table);
-      loc = hash_float_location(keyval) & hash_mask;
+      loc = hash_float_location(keyval);
 
-      for (hash_entry_t *x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+      for (hash_entry_t *x = hash_table_first(table, loc); x; x = hash_table_next(table, x))
 	{
 	  if ((is_t_real(hash_entry_key(x))) &&
 	      (keyval == real(hash_entry_key(x))))
@@ -43488,9 +45482,8 @@ static hash_entry_t *hash_float(s7_scheme *sc, s7_pointer table, s7_pointer key)
 
 static hash_entry_t *hash_num_eq(s7_scheme *sc, s7_pointer table, s7_pointer key)
 {
-  s7_int hash_mask = hash_table_mask(table);
-  s7_int loc = hash_loc(sc, table, key) & hash_mask;
-  for (hash_entry_t *x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+  s7_int loc = hash_loc(sc, table, key);
+  for (hash_entry_t *x = hash_table_first(table, loc); x; x = hash_table_next(table, x))
     if (num_eq_b_7pp(sc, key, hash_entry_key(x)))
       return(x);
   return(sc->unentry);
@@ -43523,13 +45516,12 @@ static hash_entry_t *hash_number_num_eq(s7_scheme *sc, s7_pointer table, s7_poin
   if (is_number(key))
     {
 #if (!WITH_GMP)
-      s7_int hash_mask = hash_table_mask(table);
       hash_map_t map = hash_table_mapper(table)[type(key)];
       if (hash_table_checker(table) == hash_int)    /* surely by far the most common case? only ints */
 	{
 	  s7_int keyi = integer(key);
-	  s7_int loc = map(sc, table, key) & hash_mask;
-	  for (hash_entry_t *x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+	  s7_int loc = map(sc, table, key);
+	  for (hash_entry_t *x = hash_table_first(table, loc); x; x = hash_table_next(table, x))
 	    if (keyi == integer(hash_entry_key(x))) /* not in gmp, hash_int as eq_func, what else can key be but t_integer? */
 	      return(x);
 	}
@@ -43551,8 +45543,8 @@ static hash_entry_t *hash_char(s7_scheme *sc, s7_pointer table, s7_pointer key)
       /* return(hash_eq(sc, table, key));
        *   but I think if we get here at all, we have to be using default_hash_checks|maps -- see hash_symbol above.
        */
-      s7_int loc = character(key) & hash_table_mask(table);
-      for (hash_entry_t *x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+      s7_int loc = character(key);
+      for (hash_entry_t *x = hash_table_first(table, loc); x; x = hash_table_next(table, x))
 	if (key == hash_entry_key(x))
 	  return(x);
     }
@@ -43566,9 +45558,8 @@ static hash_entry_t *hash_ci_char(s7_scheme *sc, s7_pointer table, s7_pointer ke
 {
   if (is_character(key))
     {
-      s7_int hash_mask = hash_table_mask(table);
-      s7_int loc = hash_loc(sc, table, key) & hash_mask;
-      for (hash_entry_t *x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+      s7_int loc = hash_loc(sc, table, key);
+      for (hash_entry_t *x = hash_table_first(table, loc); x; x = hash_table_next(table, x))
 	if (upper_character(key) == upper_character(hash_entry_key(x)))
 	  return(x);
     }
@@ -43590,7 +45581,7 @@ static hash_entry_t *hash_string(s7_scheme *sc, s7_pointer table, s7_pointer key
   if (is_string(key))
     {
       hash_entry_t *x;
-      s7_int key_len = string_length(key), hash_mask = hash_table_mask(table);
+      s7_int key_len = string_length(key);
       uint64_t hash;
       const char *key_str = string_value(key);
 
@@ -43599,13 +45590,13 @@ static hash_entry_t *hash_string(s7_scheme *sc, s7_pointer table, s7_pointer key
       hash = string_hash(key);
       if (key_len <= 8)
 	{
-	  for (x = hash_table_element(table, hash & hash_mask); x; x = hash_entry_next(x))
+	  for (x = hash_table_first(table, hash); x; x = hash_table_next(table, x))
 	    if ((hash == string_hash(hash_entry_key(x))) &&
 		(key_len == string_length(hash_entry_key(x))))
 	      return(x);
 	}
       else
-	for (x = hash_table_element(table, hash & hash_mask); x; x = hash_entry_next(x))
+	for (x = hash_table_first(table, hash); x; x = hash_table_next(table, x))
 	  if ((hash == string_hash(hash_entry_key(x))) &&
 	      (key_len == string_length(hash_entry_key(x))) &&        /* these are scheme strings, so we can't assume 0=end of string */
 	      (strings_are_equal_with_length(key_str, string_value(hash_entry_key(x)), key_len)))
@@ -43625,9 +45616,8 @@ static hash_entry_t *hash_ci_string(s7_scheme *sc, s7_pointer table, s7_pointer
 {
   if (is_string(key))
     {
-      s7_int hash_mask = hash_table_mask(table);
       s7_int hash = hash_map_ci_string(sc, table, key);
-      for (hash_entry_t *x = hash_table_element(table, hash & hash_mask); x; x = hash_entry_next(x))
+      for (hash_entry_t *x = hash_table_first(table, hash); x; x = hash_table_next(table, x))
 	if (scheme_strequal_ci(key, hash_entry_key(x)))
 	  return(x);
     }
@@ -43644,9 +45634,8 @@ static s7_int hash_map_eq(s7_scheme *sc, s7_pointer table, s7_pointer key) {retu
 static hash_entry_t *hash_eq(s7_scheme *sc, s7_pointer table, s7_pointer key)
 {
   /* explicit eq? as hash equality func or (for example) symbols as keys */
-  s7_int hash_mask = hash_table_mask(table);
-  s7_int loc = pointer_map(key) & hash_mask; /* hash_map_eq */
-  for (hash_entry_t *x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+  s7_int loc = pointer_map(key); /* hash_map_eq */
+  for (hash_entry_t *x = hash_table_first(table, loc); x; x = hash_table_next(table, x))
     if (key == hash_entry_key(x))
       return(x);
   return(sc->unentry);
@@ -43656,24 +45645,23 @@ static hash_entry_t *hash_eq(s7_scheme *sc, s7_pointer table, s7_pointer key)
 static hash_entry_t *hash_eqv(s7_scheme *sc, s7_pointer table, s7_pointer key)
 {
   hash_entry_t *x;
-  s7_int hash_mask = hash_table_mask(table);
-  s7_int loc = hash_loc(sc, table, key) & hash_mask;
+  s7_int loc = hash_loc(sc, table, key);
   if (is_number(key))
     {
 #if WITH_GMP
-      for (x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+      for (x = hash_table_first(table, loc); x; x = hash_table_next(table, x))
 	if (numbers_are_eqv(sc, key, hash_entry_key(x)))
 	  return(x);
 #else
       uint8_t key_type = type(key);
-      for (x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+      for (x = hash_table_first(table, loc); x; x = hash_table_next(table, x))
 	if ((key_type == type(hash_entry_key(x))) &&
 	    (numbers_are_eqv(sc, key, hash_entry_key(x))))
 	  return(x);
 #endif
     }
   else
-    for (x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+    for (x = hash_table_first(table, loc); x; x = hash_table_next(table, x))
       if (s7_is_eqv(sc, key, hash_entry_key(x)))
 	return(x);
   return(sc->unentry);
@@ -43788,8 +45776,8 @@ static s7_int hash_map_let(s7_scheme *sc, s7_pointer table, s7_pointer key)
 
 static hash_entry_t *hash_equal_eq(s7_scheme *sc, s7_pointer table, s7_pointer key)
 {
-  s7_int loc = hash_loc(sc, table, key) & hash_table_mask(table);
-  for (hash_entry_t *x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+  s7_int loc = hash_loc(sc, table, key);
+  for (hash_entry_t *x = hash_table_first(table, loc); x; x = hash_table_next(table, x))
     if (hash_entry_key(x) == key)
       return(x);
   return(sc->unentry);
@@ -43798,8 +45786,8 @@ static hash_entry_t *hash_equal_eq(s7_scheme *sc, s7_pointer table, s7_pointer k
 static hash_entry_t *hash_equal_integer(s7_scheme *sc, s7_pointer table, s7_pointer key)
 {
   s7_int keyint = integer(key);
-  s7_int loc = s7_int_abs(keyint) & hash_table_mask(table);  /* hash_loc -> hash_map_integer */
-  for (hash_entry_t *x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+  s7_int loc = s7_int_abs(keyint);  /* hash_loc -> hash_map_integer */
+  for (hash_entry_t *x = hash_table_first(table, loc); x; x = hash_table_next(table, x))
     {
       if ((is_t_integer(hash_entry_key(x))) &&
 	  (keyint == integer(hash_entry_key(x))))
@@ -43816,8 +45804,8 @@ static hash_entry_t *hash_equal_integer(s7_scheme *sc, s7_pointer table, s7_poin
 static hash_entry_t *hash_equal_ratio(s7_scheme *sc, s7_pointer table, s7_pointer key)
 {
   s7_int keynum = numerator(key), keyden = denominator(key);
-  s7_int loc = s7_int_abs(keynum / keyden) & hash_table_mask(table);  /* hash_loc -> hash_map_ratio */
-  for (hash_entry_t *x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+  s7_int loc = s7_int_abs(keynum / keyden);  /* hash_loc -> hash_map_ratio */
+  for (hash_entry_t *x = hash_table_first(table, loc); x; x = hash_table_next(table, x))
     {
       if ((is_t_ratio(hash_entry_key(x))) &&
 	  (keynum == numerator(hash_entry_key(x))) &&
@@ -43838,8 +45826,8 @@ static hash_entry_t *hash_equal_real(s7_scheme *sc, s7_pointer table, s7_pointer
   s7_int loc;
   s7_double keydbl = real(key);
   if (is_NaN(keydbl)) return(sc->unentry);
-  loc = hash_float_location(keydbl) & hash_table_mask(table);
-  for (hash_entry_t *x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+  loc = hash_float_location(keydbl);
+  for (hash_entry_t *x = hash_table_first(table, loc); x; x = hash_table_next(table, x))
     {
       if ((is_t_real(hash_entry_key(x))) &&
 	  (keydbl == real(hash_entry_key(x))))
@@ -43862,8 +45850,8 @@ static hash_entry_t *hash_equal_complex(s7_scheme *sc, s7_pointer table, s7_poin
 #if WITH_GMP
   if ((is_NaN(keyrl)) || (is_NaN(keyim))) return(sc->unentry);
 #endif
-  loc = hash_float_location(keyrl) & hash_table_mask(table);
-  for (hash_entry_t *x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+  loc = hash_float_location(keyrl);
+  for (hash_entry_t *x = hash_table_first(table, loc); x; x = hash_table_next(table, x))
     {
       if ((is_t_complex(hash_entry_key(x))) &&
 	  (keyrl == real_part(hash_entry_key(x))) &&
@@ -43885,8 +45873,7 @@ static hash_entry_t *hash_equal_any(s7_scheme *sc, s7_pointer table, s7_pointer
 {
   bool (*equal)(s7_scheme *sc, s7_pointer x, s7_pointer y, shared_info_t *ci) = equals[type(key)];
   s7_int hash = hash_loc(sc, table, key);
-  s7_int loc = hash & hash_table_mask(table);
-  for (hash_entry_t *x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+  for (hash_entry_t *x = hash_table_first(table, hash); x; x = hash_table_next(table, x))
     if ((hash_entry_raw_hash(x) == hash) &&
 	(equal(sc, key, hash_entry_key(x), NULL)))
       return(x);
@@ -43907,12 +45894,10 @@ static hash_entry_t *hash_c_function(s7_scheme *sc, s7_pointer table, s7_pointer
 {
   if (is_pair(hash_table_procedures(table)))
     {
-      s7_int hash_mask = hash_table_mask(table);
       s7_function f = c_function_call(hash_table_procedures_checker(table));
       s7_int hash = hash_loc(sc, table, key);
-      s7_int loc = hash & hash_mask;
       set_car(sc->t2_1, key);
-      for (hash_entry_t *x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+      for (hash_entry_t *x = hash_table_first(table, hash); x; x = hash_table_next(table, x))
 	if (hash_entry_raw_hash(x) == hash)
 	  {
 	    set_car(sc->t2_2, hash_entry_key(x));
@@ -43962,11 +45947,9 @@ static hash_entry_t *hash_closure(s7_scheme *sc, s7_pointer table, s7_pointer ke
 {
   if (is_pair(hash_table_procedures(table)))
     {
-      s7_int hash_mask = hash_table_mask(table);
       s7_pointer f = hash_table_procedures_checker(table);
       s7_int hash = hash_loc(sc, table, key);
-      s7_int loc = hash & hash_mask;
-      for (hash_entry_t *x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+      for (hash_entry_t *x = hash_table_first(table, hash); x; x = hash_table_next(table, x))
 	if ((hash_entry_raw_hash(x) == hash) &&
 	    (is_true(sc, s7_call(sc, f, set_plist_2(sc, key, hash_entry_key(x))))))
 	  return(x);
@@ -43984,7 +45967,7 @@ static hash_entry_t *hash_equal(s7_scheme *sc, s7_pointer table, s7_pointer key)
 static hash_entry_t *hash_equivalent(s7_scheme *sc, s7_pointer table, s7_pointer key)
 {
   hash_entry_t *x;
-  s7_int hash, loc;
+  s7_int hash;
 
   if (is_number(key))
     {
@@ -43996,18 +45979,17 @@ static hash_entry_t *hash_equivalent(s7_scheme *sc, s7_pointer table, s7_pointer
       if ((x != sc->unentry) || (!is_nan_b_7p(sc, key)))
 	return(x);
 #endif
-      for (x = hash_table_element(table, 0); x; x = hash_entry_next(x)) /* NaN is mapped to 0 */
+      for (x = hash_table_first(table, 0); x; x = hash_table_next(table, x)) /* NaN is mapped to 0 */
 	if (is_nan_b_7p(sc, hash_entry_key(x)))  /* all NaN's are the same to equivalent? */
 	  return(x);
       return(sc->unentry);
     }
   hash = hash_loc(sc, table, key);
-  loc = hash & hash_table_mask(table);
-  for (x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+  for (x = hash_table_first(table, hash); x; x = hash_table_next(table, x))
     if (hash_entry_key(x) == key)
       return(x);
 
-  for (x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+  for (x = hash_table_first(table, hash); x; x = hash_table_next(table, x))
     if ((hash_entry_raw_hash(x) == hash) &&
 	(s7_is_equivalent(sc, hash_entry_key(x), key)))
       return(x);
@@ -44049,11 +46031,11 @@ s7_pointer s7_make_hash_table(s7_scheme *sc, s7_int size)
 	  }
 	size++;
       }
-  els = (block_t *)callocate(sc, size * sizeof(hash_entry_t *));
+  els = (block_t *)callocate(sc, (size + 1) * sizeof(hash_entry_t)); /* [c4augustus] +1 for the removed count */
   new_cell(sc, table, T_HASH_TABLE | T_SAFE_PROCEDURE);
   hash_table_mask(table) = size - 1;
   hash_table_set_block(table, els);
-  hash_table_elements(table) = (hash_entry_t **)(block_data(els));
+  hash_table_elements(table) = (hash_entry_t *)(block_data(els));
   hash_table_checker(table) = hash_empty;
   hash_table_mapper(table) = default_hash_map;
   hash_table_entries(table) = 0;
@@ -44428,35 +46410,6 @@ static void init_hash_maps(void)
   default_hash_checks[T_CHARACTER] =  hash_char;
 }
 
-static void resize_hash_table(s7_scheme *sc, s7_pointer table)
-{
-  s7_int entries = hash_table_entries(table);
-  hash_entry_t **old_els = hash_table_elements(table);
-  s7_pointer dproc = hash_table_procedures(table); /* new block_t so we need to pass this across */
-  s7_int old_size = hash_table_mask(table) + 1;
-  s7_int new_size = old_size * 4;
-  s7_int hash_mask = new_size - 1;
-  block_t *np = (block_t *)callocate(sc, new_size * sizeof(hash_entry_t *));
-  hash_entry_t **new_els = (hash_entry_t **)(block_data(np));
-
-  for (s7_int i = 0; i < old_size; i++)
-    {
-      hash_entry_t *n;
-      for (hash_entry_t *x = old_els[i]; x; x = n)
-	{
-	  s7_int loc = hash_entry_raw_hash(x) & hash_mask;
-	  n = hash_entry_next(x);
-	  hash_entry_next(x) = new_els[loc];
-	  new_els[loc] = x;
-	}}
-  liberate(sc, hash_table_block(table));
-  hash_table_set_block(table, np);
-  hash_table_elements(table) = new_els;
-  hash_table_mask(table) = hash_mask; /* was new_size - 1 14-Jun-21 */
-  hash_table_set_procedures(table, dproc);
-  hash_table_entries(table) = entries;
-}
-
 
 /* -------------------------------- hash-table-ref -------------------------------- */
 s7_pointer s7_hash_table_ref(s7_scheme *sc, s7_pointer table, s7_pointer key)
@@ -44529,68 +46482,48 @@ static s7_pointer hash_table_ref_chooser(s7_scheme *sc, s7_pointer f, int32_t ar
 
 
 /* -------------------------------- hash-table-set! -------------------------------- */
-static s7_pointer remove_from_hash_table(s7_scheme *sc, s7_pointer table, hash_entry_t *p)
+static void remove_hash_entry(s7_scheme *sc, s7_pointer table, hash_entry_t *p)
 {
-  hash_entry_t *x;
-  s7_int hash_mask, loc;
+  /* [c4augustus] the slot stays in use (key NULL, value not) so that scans continue past it */
+  hash_entry_key(p) = NULL;
+  hash_entry_set_value(p, sc->unused);
+  hash_table_entries(table)--;
+  hash_table_removed(table)++;
+}
 
+static s7_pointer remove_from_hash_table(s7_scheme *sc, s7_pointer table, hash_entry_t *p)
+{
   if (p == sc->unentry) return(sc->F);
-  hash_mask = hash_table_mask(table);
-  loc = hash_entry_raw_hash(p) & hash_mask;
-  x = hash_table_element(table, loc);
-  if (x == p)
-    hash_table_element(table, loc) = hash_entry_next(x);
-  else
-    {
-      hash_entry_t *y;
-      for (y = x, x = hash_entry_next(x); x; y = x, x = hash_entry_next(x))
-	if (x == p)
-	  {
-	    hash_entry_next(y) = hash_entry_next(x);
-	    break;
-	  }}
-  hash_table_entries(table)--;
+  remove_hash_entry(sc, table, p);
   if ((hash_table_entries(table) == 0) &&
       (hash_table_mapper(table) == default_hash_map))
     {
       hash_table_checker(table) = hash_empty;
       hash_clear_chosen(table);
     }
-  liberate_block(sc, x);
   return(sc->F);
 }
 
 static void cull_weak_hash_table(s7_scheme *sc, s7_pointer table)
 {
   s7_int len = hash_table_mask(table) + 1;
-  hash_entry_t **entries = hash_table_elements(table);
+  hash_entry_t *entries = hash_table_elements(table);
   for (s7_int i = 0; i < len; i++)
     {
-      hash_entry_t *nxp, *lxp = entries[i];
-      for (hash_entry_t *xp = entries[i]; xp; xp = nxp)
+      hash_entry_t *xp = &entries[i];
+      if ((hash_entry_is_live(xp)) &&
+	  (is_unreachable(sc, hash_entry_key(xp)))) // [c4augustus]
 	{
-	  nxp = hash_entry_next(xp);
-	  if (is_free_and_clear(hash_entry_key(xp)))
+	  remove_hash_entry(sc, table, xp);
+	  if (hash_table_entries(table) == 0)
 	    {
-	      if (xp == entries[i])
+	      if (hash_table_mapper(table) == default_hash_map)
 		{
-		  entries[i] = nxp;
-		  lxp = nxp;
+		  hash_table_checker(table) = hash_empty;
+		  hash_clear_chosen(table);
 		}
-	      else hash_entry_next(lxp) = nxp;
-	      liberate_block(sc, xp);
-	      hash_table_entries(table)--;
-	      if (hash_table_entries(table) == 0)
-		{
-		  if (hash_table_mapper(table) == default_hash_map)
-		    {
-		      hash_table_checker(table) = hash_empty;
-		      hash_clear_chosen(table);
-		    }
-		  return;
-		}}
-	  else lxp = xp;
-	}}
+	      return;
+	    }}}
 }
 
 static void hash_table_set_default_checker(s7_pointer table, uint8_t typ)
@@ -44705,8 +46638,7 @@ static void check_hash_table_checker(s7_scheme *sc, s7_pointer table, s7_pointer
 
 s7_pointer s7_hash_table_set(s7_scheme *sc, s7_pointer table, s7_pointer key, s7_pointer value)
 {
-  s7_int hash_mask, loc;
-  hash_entry_t *p, *x;
+  hash_entry_t *x;
 
   if (value == sc->F)
     return(remove_from_hash_table(sc, table, (*hash_table_checker(table))(sc, table, key)));
@@ -44730,17 +46662,7 @@ s7_pointer s7_hash_table_set(s7_scheme *sc, s7_pointer table, s7_pointer key, s7
     if (sc->safety > NO_SAFETY)
       check_hash_table_checker(sc, table, key);
 
-  p = mallocate_block(sc);
-  hash_entry_key(p) = key;
-  hash_entry_set_value(p, T_Ext(value));
-  hash_entry_set_raw_hash(p, hash_loc(sc, table, key));
-  hash_mask = hash_table_mask(table);
-  loc = hash_entry_raw_hash(p) & hash_mask;
-  hash_entry_next(p) = hash_table_element(table, loc);
-  hash_table_element(table, loc) = p;
-  hash_table_entries(table)++;
-  if (hash_table_entries(table) > hash_mask)
-    resize_hash_table(sc, table);
+  hash_table_insert(sc, table, key, T_Ext(value), hash_loc(sc, table, key));
   return(value);
 }
 
@@ -44787,30 +46709,18 @@ static s7_pointer hash_table_set_chooser(s7_scheme *sc, s7_pointer f, int32_t ar
 /* -------------------------------- hash-table -------------------------------- */
 static inline s7_pointer hash_table_add(s7_scheme *sc, s7_pointer table, s7_pointer key, s7_pointer value)
 {
-  s7_int hash, hash_mask, loc;
-  hash_entry_t *p;
+  s7_int hash;
 
   if (!hash_chosen(table))
     hash_table_set_default_checker(table, type(key)); /* raw_hash value (hash_loc(sc, table, key)) does not change via hash_table_set_default_checker etc */
 
-  hash_mask = hash_table_mask(table);
   hash = hash_loc(sc, table, key);
-  loc = hash & hash_mask;
-
-  for (hash_entry_t *x = hash_table_element(table, loc); x; x = hash_entry_next(x))
+  for (hash_entry_t *x = hash_table_first(table, hash); x; x = hash_table_next(table, x))
     if ((hash_entry_raw_hash(x) == hash) &&
 	(s7_is_equal(sc, hash_entry_key(x), key)))
       return(value);
 
-  p = mallocate_block(sc);
-  hash_entry_key(p) = key;
-  hash_entry_set_value(p, T_Ext(value));
-  hash_entry_set_raw_hash(p, hash);
-  hash_entry_next(p) = hash_table_element(table, loc);
-  hash_table_element(table, loc) = p;
-  hash_table_entries(table)++;
-  if (hash_table_entries(table) > hash_mask)
-    resize_hash_table(sc, table);
+  hash_table_insert(sc, table, key, T_Ext(value), hash);
   return(value);
 }
 
@@ -44869,10 +46779,11 @@ static void check_old_hash(s7_scheme *sc, s7_pointer old_hash, s7_pointer new_ha
 {
   s7_int count = 0;
   s7_int old_len = hash_table_mask(old_hash) + 1;
-  hash_entry_t **old_lists = hash_table_elements(old_hash);
+  hash_entry_t *old_lists = hash_table_elements(old_hash);
   for (s7_int i = 0; i < old_len; i++)
-    for (hash_entry_t *x = old_lists[i]; x; x = hash_entry_next(x))
+    if (hash_entry_is_live(&old_lists[i]))
       {
+	hash_entry_t *x = &old_lists[i];
 	if (count >= end)
 	  return;
 	if (count >= start)
@@ -44882,16 +46793,14 @@ static void check_old_hash(s7_scheme *sc, s7_pointer old_hash, s7_pointer new_ha
 
 static s7_pointer hash_table_copy(s7_scheme *sc, s7_pointer old_hash, s7_pointer new_hash, s7_int start, s7_int end)
 {
-  s7_int old_len, new_mask, count = 0;
-  hash_entry_t **old_lists, **new_lists;
+  s7_int old_len, count = 0;
+  hash_entry_t *old_lists;
 
   if (is_typed_hash_table(new_hash))
     check_old_hash(sc, old_hash, new_hash, start, end);
 
   old_len = hash_table_mask(old_hash) + 1;
-  new_mask = hash_table_mask(new_hash);
   old_lists = hash_table_elements(old_hash);
-  new_lists = hash_table_elements(new_hash);
 
   if (hash_table_entries(new_hash) == 0)
     {
@@ -44899,41 +46808,28 @@ static s7_pointer hash_table_copy(s7_scheme *sc, s7_pointer old_hash, s7_pointer
 	  (end >= hash_table_entries(old_hash)))
 	{
 	  for (s7_int i = 0; i < old_len; i++)
-	    for (hash_entry_t *x = old_lists[i]; x; x = hash_entry_next(x))
-	      {
-		s7_int loc = hash_entry_raw_hash(x) & new_mask;
-		hash_entry_t *p = make_hash_entry(sc, hash_entry_key(x), hash_entry_value(x), hash_entry_raw_hash(x));
-		hash_entry_next(p) = new_lists[loc];
-		new_lists[loc] = p;
-	      }
-	  hash_table_entries(new_hash) = hash_table_entries(old_hash);
+	    if (hash_entry_is_live(&old_lists[i]))
+	      hash_table_insert(sc, new_hash, hash_entry_key(&old_lists[i]), hash_entry_value(&old_lists[i]), hash_entry_raw_hash(&old_lists[i]));
 	  return(new_hash);
 	}
       for (s7_int i = 0; i < old_len; i++)
-	for (hash_entry_t *x = old_lists[i]; x; x = hash_entry_next(x))
+	if (hash_entry_is_live(&old_lists[i]))
 	  {
+	    hash_entry_t *x = &old_lists[i];
 	    if (count >= end)
-	      {
-		hash_table_entries(new_hash) = end - start;
-		return(new_hash);
-	      }
+	      return(new_hash);
 	    if (count >= start)
-	      {
-		s7_int loc = hash_entry_raw_hash(x) & new_mask;
-		hash_entry_t *p = make_hash_entry(sc, hash_entry_key(x), hash_entry_value(x), hash_entry_raw_hash(x));
-		hash_entry_next(p) = new_lists[loc];
-		new_lists[loc] = p;
-	      }
+	      hash_table_insert(sc, new_hash, hash_entry_key(x), hash_entry_value(x), hash_entry_raw_hash(x));
 	    count++;
 	  }
-      hash_table_entries(new_hash) = count - start;
       return(new_hash);
     }
 
   /* this can't be optimized much because we have to look for key matches (we're copying old_hash into the existing, non-empty new_hash) */
   for (s7_int i = 0; i < old_len; i++)
-    for (hash_entry_t *x = old_lists[i]; x; x = hash_entry_next(x))
+    if (hash_entry_is_live(&old_lists[i]))
       {
+	hash_entry_t *x = &old_lists[i];
 	if (count >= end)
 	  return(new_hash);
 	if (count >= start)
@@ -44943,11 +46839,7 @@ static s7_pointer hash_table_copy(s7_scheme *sc, s7_pointer old_hash, s7_pointer
 	      hash_entry_set_value(y, hash_entry_value(x));
 	    else
 	      {
-		s7_int loc = hash_entry_raw_hash(x) & new_mask;
-		hash_entry_t *p = make_hash_entry(sc, hash_entry_key(x), hash_entry_value(x), hash_entry_raw_hash(x));
-		hash_entry_next(p) = new_lists[loc];
-		new_lists[loc] = p;
-		hash_table_entries(new_hash)++;
+		hash_table_insert(sc, new_hash, hash_entry_key(x), hash_entry_value(x), hash_entry_raw_hash(x));
 		if (!hash_chosen(new_hash))
 		  hash_table_set_default_checker(new_hash, type(hash_entry_key(x)));
 	      }}
@@ -44964,32 +46856,11 @@ static s7_pointer hash_table_fill(s7_scheme *sc, s7_pointer args)
 
   if (hash_table_entries(table) > 0)
     {
-      hash_entry_t **entries = hash_table_elements(table);
+      hash_entry_t *entries = hash_table_elements(table);
       s7_int len = hash_table_mask(table) + 1;      /* minimum len is 2 (see s7_make_hash_table) */
       if (val == sc->F)                      /* hash-table-ref returns $f if it can't find a key, so val == $f here means empty the table */
 	{
-	  hash_entry_t **hp = entries;
-	  hash_entry_t **hn = (hash_entry_t **)(hp + len);
-	  for (; hp < hn; hp++)
-	    {
-	      if (*hp)
-		{
-		  hash_entry_t *p = *hp;
-		  while (hash_entry_next(p)) p = hash_entry_next(p);
-		  hash_entry_next(p) = sc->block_lists[BLOCK_LIST];
-		  sc->block_lists[BLOCK_LIST] = *hp;
-		}
-	      hp++;
-	      if (*hp)
-		{
-		  hash_entry_t *p = *hp;
-		  while (hash_entry_next(p)) p = hash_entry_next(p);
-		  hash_entry_next(p) = sc->block_lists[BLOCK_LIST];
-		  sc->block_lists[BLOCK_LIST] = *hp;
-		}}
-	  if (len >= 8)
-	    memclr64(entries, len * sizeof(hash_entry_t *));
-	  else memclr(entries, len * sizeof(hash_entry_t *));
+	  memclr(entries, (len + 1) * sizeof(hash_entry_t)); /* [c4augustus] also clears the removed count */
 	  if (hash_table_mapper(table) == default_hash_map)
 	    {
 	      hash_table_checker(table) = hash_empty;
@@ -45008,8 +46879,8 @@ static s7_pointer hash_table_fill(s7_scheme *sc, s7_pointer args)
 	  wrong_type_error_nr(sc, sc->fill_symbol, 2, val, wrap_string(sc, tstr, safe_strlen(tstr)));
 	}
       for (s7_int i = 0; i < len; i++)
-	for (hash_entry_t *x = entries[i]; x; x = hash_entry_next(x))
-	  hash_entry_set_value(x, val);
+	if (hash_entry_is_live(&entries[i]))
+	  hash_entry_set_value(&entries[i], val);
       /* keys haven't changed, so no need to mess with hash_table_checker */
     }
   return(val);
@@ -45018,14 +46889,14 @@ static s7_pointer hash_table_fill(s7_scheme *sc, s7_pointer args)
 static s7_pointer hash_table_reverse(s7_scheme *sc, s7_pointer old_hash)
 {
   s7_int len = hash_table_mask(old_hash) + 1;
-  hash_entry_t **old_lists = hash_table_elements(old_hash);
+  hash_entry_t *old_lists = hash_table_elements(old_hash);
   s7_pointer new_hash = s7_make_hash_table(sc, len);
   s7_int gc_loc = gc_protect_1(sc, new_hash);
 
   /* old_hash checker/mapper functions don't always make sense reversed, although the key/value typers might be ok */
   for (s7_int i = 0; i < len; i++)
-    for (hash_entry_t *x = old_lists[i]; x; x = hash_entry_next(x))
-      s7_hash_table_set(sc, new_hash, hash_entry_value(x), hash_entry_key(x));
+    if (hash_entry_is_live(&old_lists[i]))
+      s7_hash_table_set(sc, new_hash, hash_entry_value(&old_lists[i]), hash_entry_key(&old_lists[i]));
 
   if (is_weak_hash_table(old_hash)) /* 17-May-23, not sure it makes sense to reverse a weak-hash-table but... */
     {
@@ -45419,7 +47290,6 @@ s7_pointer s7_make_function_star(s7_scheme *sc, const char *name, s7_function fn
 		    (is_normal_symbol(defaults[i])))
 		  {
 		    c_func_clear_simple_defaults(func);
-		    mark_function[T_C_FUNCTION_STAR] = mark_c_proc_star;
 		  }}
 	    else
 	      {
@@ -47242,7 +49112,7 @@ static bool c_objects_are_equivalent(s7_scheme *sc, s7_pointer x, s7_pointer y,
 
 static bool hash_table_equal_1(s7_scheme *sc, s7_pointer x, s7_pointer y, shared_info_t *ci, bool equivalent)
 {
-  hash_entry_t **lists;
+  hash_entry_t *lists;
   s7_int len;
   shared_info_t *nci = ci;
   hash_check_t hf;
@@ -47279,8 +49149,9 @@ static bool hash_table_equal_1(s7_scheme *sc, s7_pointer x, s7_pointer y, shared
   if ((hf != hash_equal) && (hf != hash_equivalent))
     {
       for (s7_int i = 0; i < len; i++)
-	for (hash_entry_t *p = lists[i]; p; p = hash_entry_next(p))
+	if (hash_entry_is_live(&lists[i]))
 	  {
+	    hash_entry_t *p = &lists[i];
 	    hash_entry_t *y_val = hf(sc, y, hash_entry_key(p));
 	    if (y_val == sc->unentry)
 	      return(false);
@@ -47297,14 +49168,14 @@ static bool hash_table_equal_1(s7_scheme *sc, s7_pointer x, s7_pointer y, shared
    *   outside equal?/eqivalent? they can safely assume that they can start a new shared_info process.
    */
   for (s7_int i = 0; i < len; i++)
-    for (hash_entry_t *p = lists[i]; p; p = hash_entry_next(p))
+    if (hash_entry_is_live(&lists[i]))
       {
+	hash_entry_t *p = &lists[i];
 	s7_pointer key = hash_entry_key(p);
 	s7_int hash = hash_loc(sc, y, key);
-	s7_int loc = hash & hash_table_mask(y);
 	hash_entry_t *xe;
 
-	for (xe = hash_table_element(y, loc); xe; xe = hash_entry_next(xe))
+	for (xe = hash_table_first(y, hash); xe; xe = hash_table_next(y, xe))
 	  if ((hash_entry_raw_hash(xe) == hash) &&
 	      (eqf(sc, hash_entry_key(xe), key, nci)))
 	    break;
@@ -49032,14 +50903,13 @@ static s7_pointer s7_copy_1(s7_scheme *sc, s7_pointer caller, s7_pointer args)
     case T_HASH_TABLE:
       {
 	s7_int loc = -1, skip = start;
-	hash_entry_t **elements = hash_table_elements(source);
+	hash_entry_t *elements = hash_table_elements(source);
 	hash_entry_t *x = NULL;
 
 	while (skip > 0)
 	  {
-	    while (!x) x = elements[++loc];
+	    do x = &elements[++loc]; while (!hash_entry_is_live(x));
 	    skip--;
-	    x = hash_entry_next(x);
 	  }
 	if (is_pair(dest))
 	  {
@@ -49047,9 +50917,8 @@ static s7_pointer s7_copy_1(s7_scheme *sc, s7_pointer caller, s7_pointer args)
 	    check_free_heap_size(sc, end - start);
 	    for (i = start, p = dest; (i < end) && (is_pair(p)); i++, p = cdr(p))
 	      {
-		while (!x) x = elements[++loc];
+		do x = &elements[++loc]; while (!hash_entry_is_live(x));
 		set_car(p, cons_unchecked(sc, hash_entry_key(x), hash_entry_value(x)));
-		x = hash_entry_next(x);
 	      }}
 	else
 	  if (is_let(dest))
@@ -49057,7 +50926,7 @@ static s7_pointer s7_copy_1(s7_scheme *sc, s7_pointer caller, s7_pointer args)
 	      for (i = start; i < end; i++)
 		{
 		  s7_pointer symbol;
-		  while (!x) x = elements[++loc];
+		  do x = &elements[++loc]; while (!hash_entry_is_live(x));
 		  symbol = hash_entry_key(x);
 		  if (!is_symbol(symbol))
 		    copy_element_error_nr(sc, caller, i + 1, symbol, T_SYMBOL);
@@ -49067,16 +50936,14 @@ static s7_pointer s7_copy_1(s7_scheme *sc, s7_pointer caller, s7_pointer args)
 		  if ((symbol != sc->let_ref_fallback_symbol) &&
 		      (symbol != sc->let_set_fallback_symbol))
 		    add_slot_checked_with_id(sc, dest, symbol, hash_entry_value(x)); /* ...unchecked... if size ok */
-		  x = hash_entry_next(x);
 		}}
 	  else
 	    {
 	      check_free_heap_size(sc, end - start);
 	      for (i = start, j = 0; i < end; i++, j++)
 		{
-		  while (!x) x = elements[++loc];
+		  do x = &elements[++loc]; while (!hash_entry_is_live(x));
 		  set(sc, dest, j, cons_unchecked(sc, hash_entry_key(x), hash_entry_value(x)));
-		  x = hash_entry_next(x);
 		}}
         return(dest);
       }
@@ -51280,9 +53147,10 @@ static s7_pointer g_catch(s7_scheme *sc, s7_pointer args)
   return(sc->F);
 }
 
-s7_pointer s7_call_with_catch(s7_scheme *sc, s7_pointer tag, s7_pointer body, s7_pointer error_handler)
+s7_pointer s7_apply_with_catch(s7_scheme *sc, s7_pointer tag, s7_pointer body, s7_pointer args, s7_pointer error_handler) /* [c4augustus] */
 {
   s7_pointer p, result;
+  s7_int catch_loc; /* [c4augustus] */
   if (sc->stack_end == sc->stack_start) /* no stack! */
     push_stack_direct(sc, OP_EVAL_DONE);
 
@@ -51293,6 +53161,7 @@ s7_pointer s7_call_with_catch(s7_scheme *sc, s7_pointer tag, s7_pointer body, s7
   catch_op_loc(p) = (int32_t)(sc->op_stack_now - sc->op_stack);
   catch_set_handler(p, error_handler);
   catch_cstack(p) = sc->goto_start;
+  catch_loc = catch_goto_loc(p);
 
   {
     declare_jump_info();
@@ -51306,14 +53175,28 @@ s7_pointer s7_call_with_catch(s7_scheme *sc, s7_pointer tag, s7_pointer body, s7
 	catch_cstack(p) = &new_goto_start;
 	if (SHOW_EVAL_OPS) fprintf(stderr, "  longjmp call %s\n", display(body));
 	push_stack(sc, OP_CATCH, error_handler, p);
-	result = s7_call(sc, body, sc->nil);
+	result = s7_call(sc, body, args);
 	if (((opcode_t)sc->stack_end[-1]) == OP_CATCH) sc->stack_end -= 4;
       }
     else
       {
 	if (SHOW_EVAL_OPS) fprintf(stderr, "  jump back with %d (%d)\n", jump_loc, (sc->stack_end == sc->stack_start));
 	if (jump_loc != ERROR_JUMP)
-	  eval(sc, sc->cur_op);
+	  {
+	    /* [c4augustus] the stack is back at catch_loc only when this catch's handler is next, not a catch in body;
+	     *   a C handler is called here and its value returned to our caller, where eval would go on with whatever
+	     *   called us (our caller is still waiting), and it runs unbudgeted even if the budget is spent
+	     */
+	    if ((current_stack_top(sc) == catch_loc) && (sc->cur_op == OP_APPLY) &&
+		(sc->code == error_handler) && (is_c_function(error_handler)))
+	      {
+		s7_int countdown = sc->step_countdown;
+		sc->step_countdown = S7_INT64_MAX;
+		sc->value = c_function_call(error_handler)(sc, sc->args);
+		sc->step_countdown = countdown;
+	      }
+	    else eval(sc, sc->cur_op);
+	  }
 	if ((jump_loc == CATCH_JUMP) &&    /* we're returning from an error in catch */
 	    ((sc->stack_end == sc->stack_start) ||
 	     (((sc->stack_end - 4) == sc->stack_start) && (((opcode_t)sc->stack_end[-1]) == OP_GC_PROTECT)))) /* s7_apply_function probably */
@@ -51326,6 +53209,11 @@ s7_pointer s7_call_with_catch(s7_scheme *sc, s7_pointer tag, s7_pointer body, s7
   return(result);
 }
 
+s7_pointer s7_call_with_catch(s7_scheme *sc, s7_pointer tag, s7_pointer body, s7_pointer error_handler)
+{
+  return(s7_apply_with_catch(sc, tag, body, sc->nil, error_handler));
+}
+
 static void op_c_catch(s7_scheme *sc)
 {
   /* (catch $t (^ () (=> ("hi") $\a)) (^ args args))
@@ -51658,7 +53546,23 @@ static bool catch_dynamic_wind_function(s7_scheme *sc, s7_int i, s7_pointer type
     {
       dynamic_wind_state(x) = DWIND_FINISH;    /* make sure an uncaught error in the exit thunk doesn't cause us to loop */
       if (dynamic_wind_out(x) != sc->F)
-	sc->value = s7_call(sc, dynamic_wind_out(x), sc->nil);
+	{
+	  /* [c4augustus] on a spent budget every step raises, so the exit thunk gets the whole budget again while
+	   *   the error unwinds; it is spent again when the thunk returns or raises, so no catch can carry on with it
+	   */
+	  bool reprieve = ((sc->step_budget > 0) && (sc->step_countdown <= 0) && (!sc->step_reprieve));
+	  if (reprieve)
+	    {
+	      sc->step_reprieve = true;
+	      sc->step_countdown = sc->step_budget;
+	    }
+	  sc->value = s7_call(sc, dynamic_wind_out(x), sc->nil);
+	  if ((reprieve) && (sc->step_reprieve))
+	    {
+	      sc->step_reprieve = false;
+	      sc->step_countdown = 0;
+	    }
+	}
     }
   return(false);
 }
@@ -51927,6 +53831,11 @@ static noreturn void error_nr(s7_scheme *sc, s7_pointer type, s7_pointer info)
   sc->object_out_locked = false;  /* possible error in obj->str method after object_out has set this flag */
   sc->has_openlets = true;        /*   same problem -- we need a cleaner way to handle this, op_?_unwind */
   sc->value = info;               /* feeble GC protection (otherwise info is sometimes freed in this function), throw also protects type */
+  if (sc->step_reprieve)          /* [c4augustus] an error in an exit thunk ends the reprieve of its spent budget */
+    {
+      sc->step_reprieve = false;
+      sc->step_countdown = 0;
+    }
 
   if (sc->current_safe_list > 0)
     clear_list_in_use(sc->safe_lists[sc->current_safe_list]);
@@ -52443,6 +54352,33 @@ void s7_set_begin_hook(s7_scheme *sc, void (*hook)(s7_scheme *sc, bool *val))
   sc->begin_op = (hook) ? OP_BEGIN_HOOK : OP_BEGIN_NO_HOOK;
 }
 
+/* [c4augustus] a spent budget stays spent: every later step raises budget-exceeded again, so a catch inside the budgeted
+ *   code cannot carry on; only a C handler of s7_call_with_catch runs unbudgeted
+ */
+s7_int s7_set_step_budget(s7_scheme *sc, s7_int steps)
+{
+  s7_int left = s7_step_budget(sc);
+  sc->step_reprieve = false;
+  sc->step_budget = (steps > 0) ? steps : 0;
+  sc->step_countdown = (steps > 0) ? steps : S7_INT64_MAX;
+  return(left);
+}
+
+s7_int s7_step_budget(s7_scheme *sc) {return((sc->step_budget > 0) ? (((sc->step_countdown > 0) && (!sc->step_reprieve)) ? sc->step_countdown : 1) : 0);} /* [c4augustus] a reprieve is of a spent budget */
+
+static void step_budget_exceeded(s7_scheme *sc)
+{
+  s7_int budget = sc->step_budget;
+  if (budget == 0) /* S7_INT64_MAX steps without a budget */
+    {
+      sc->step_countdown = S7_INT64_MAX;
+      return;
+    }
+  sc->step_countdown = 0;
+  error_nr(sc, make_symbol(sc, "budget-exceeded", 15),
+	   set_elist_2(sc, wrap_string(sc, "evaluation ran past its budget of ~D steps", 42), make_integer(sc, budget)));
+}
+
 static bool call_begin_hook(s7_scheme *sc)
 {
   bool result = false;
@@ -65481,6 +67417,7 @@ static s7_pointer opt_do_any(opt_info *o)
     }
   while (true)
     {
+      step_tick(sc); /* [c4augustus] */
       /* end */
       if (ostart->v[0].fb(ostart))
 	break;
@@ -65537,6 +67474,7 @@ static s7_pointer opt_do_step_1(opt_info *o)
     }
   while (!(ostart->v[0].fb(ostart)))
     {
+      step_tick(sc); /* [c4augustus] */
       body->v[0].fp(body);
       slot_set_value(stepper, ostep->v[0].fp(ostep));
     }
@@ -65574,6 +67512,7 @@ static s7_pointer opt_do_step_i(opt_info *o)
   if (stepper) slot_set_value(stepper, si);
   while (integer(si) != end)
     {
+      step_tick(sc); /* [c4augustus] */
       body->v[0].fp(body);
       integer(si) += incr;
     }
@@ -65599,16 +67538,18 @@ static s7_pointer opt_do_no_vars(opt_info *o)
   s7_gc_protect_via_stack(sc, old_e);
   set_curlet(sc, do_curlet(o));
   if (len == 0)       /* titer */
-    while (!(fb(ostart)));
+    while (!(fb(ostart))) step_tick(sc); /* [c4augustus] */
   else
     {
       opt_info *body = do_no_vars_body(o);
       while (!(fb(ostart)))   /* tshoot, tfft */
-	for (int32_t i = 0; i < len; i++)
-	  {
-	    opt_info *o1 = body->v[i].o1;
-	    o1->v[0].fp(o1);
-	  }}
+	{
+	  step_tick(sc); /* [c4augustus] */
+	  for (int32_t i = 0; i < len; i++)
+	    {
+	      opt_info *o1 = body->v[i].o1;
+	      o1->v[0].fp(o1);
+	    }}}
   unstack(sc);
   set_curlet(sc, old_e);
   return(sc->T);
@@ -65640,12 +67581,14 @@ static s7_pointer opt_do_1(opt_info *o)
 	  if (ostep->v[0].fp == opt_p_ii_ss_add)
 	    while (!ostart->v[0].fb(ostart))
 	      {
+		step_tick(sc); /* [c4augustus] */
 		body->v[0].fp(body);
 		integer(step_val) = opt_i_ii_ss_add(ostep);
 	      }
 	  else
 	    while (!ostart->v[0].fb(ostart))
 	      {
+		step_tick(sc); /* [c4augustus] */
 		body->v[0].fp(body);
 		integer(step_val) = ostep->v[O_WRAP].fi(ostep);
 	      }
@@ -65657,6 +67600,7 @@ static s7_pointer opt_do_1(opt_info *o)
     }
   while (!(ostart->v[0].fb(ostart)))   /* s7test tref */
     {
+      step_tick(sc); /* [c4augustus] */
       body->v[0].fp(body);
       slot_set_value(vp, ostep->v[0].fp(ostep));
     }
@@ -65686,6 +67630,7 @@ static s7_pointer opt_do_n(opt_info *o)
       opt_info *e1 = body->v[0].o1, *e2 = body->v[1].o1;
       while (!(ostart->v[0].fb(ostart)))
 	{
+	  step_tick(sc); /* [c4augustus] */
 	  e1->v[0].fp(e1);
 	  e2->v[0].fp(e2);
 	  slot_set_value(vp, ostep->v[0].fp(ostep));
@@ -65702,12 +67647,14 @@ static s7_pointer opt_do_n(opt_info *o)
       if (len == 7)
 	while (!ostart->v[0].fb(ostart)) /* tfft teq */
 	  {
+	    step_tick(sc); /* [c4augustus] */
 	    fp[0](os[0]); fp[1](os[1]); fp[2](os[2]); fp[3](os[3]); fp[4](os[4]); fp[5](os[5]); fp[6](os[6]);
 	    slot_set_value(vp, ostep->v[0].fp(ostep));
 	  }
       else
 	while (!ostart->v[0].fb(ostart)) /* tfft teq */
 	  {
+	    step_tick(sc); /* [c4augustus] */
 	    for (int32_t i = 0; i < len; i++) fp[i](os[i]);
 	    slot_set_value(vp, ostep->v[0].fp(ostep));
 	  }}
@@ -65729,6 +67676,7 @@ static s7_pointer opt_do_times(opt_info *o)
   s7_gc_protect_via_stack(sc, old_e);
   set_curlet(sc, do_curlet(o));
   integer(vp) = integer(o1->v[0].fp(o1));
+  step_charge(sc, integer(vp), end); /* [c4augustus] */
   if (len == 2)                 /* tmac tmisc */
     {
       opt_info *e1 = body->v[0].o1, *e2 = body->v[1].o1;
@@ -65768,6 +67716,7 @@ static s7_pointer opt_do_list_simple(opt_info *o)
   if (fp == opt_if_bp)
     while (is_pair(slot_value(vp)))
       {
+	step_tick(sc); /* [c4augustus] */
 	if (o1->v[3].fb(o1->v[2].o1))
 	  o1->v[5].fp(o1->v[4].o1);
 	slot_set_value(vp, cdr(slot_value(vp)));
@@ -65775,6 +67724,7 @@ static s7_pointer opt_do_list_simple(opt_info *o)
   else
     while (!is_null(slot_value(vp)))
       {
+	step_tick(sc); /* [c4augustus] */
 	fp(o1);
 	slot_set_value(vp, cdr(slot_value(vp)));
       }
@@ -65795,6 +67745,7 @@ static s7_pointer opt_do_very_simple(opt_info *o)
   s7_gc_protect_via_stack(sc, old_e);
   set_curlet(sc, do_curlet(o));
   integer(vp) = integer(o1->v[0].fp(o1));
+  step_charge(sc, integer(vp), end); /* [c4augustus] */
   o1 = do_any_body(o);
   f = o1->v[0].fp;
   if (f == opt_p_pip_ssf)                            /* tref.scm */
@@ -65886,6 +67837,7 @@ static s7_pointer opt_do_prepackaged(opt_info *o)
   s7_gc_protect_via_stack(sc, old_e);
   set_curlet(sc, do_curlet(o));
   integer(vp) = integer(o1->v[0].fp(o1));
+  step_charge(sc, integer(vp), end); /* [c4augustus] */
 
   do_prepack_stepper(o) = vp;
   do_prepack_end(o) = end;
@@ -69147,6 +71099,7 @@ static void init_choosers(s7_scheme *sc)
   sc->format_no_column = make_function_with_class(sc, f, "format", g_format_no_column, 1, 0, true);
   sc->format_just_control_string = make_function_with_class(sc, f, "format", g_format_just_control_string, 2, 0, false);
   sc->format_as_objstr = make_function_with_class(sc, f, "format", g_format_as_objstr, 3, 0, true);
+  sc->format_compiled = make_function_with_class(sc, f, "format", g_format_compiled, 2, 0, true); // [c4augustus]
 
   /* list */
   f = set_function_chooser(sc->list_symbol, list_chooser);
@@ -80706,7 +82659,7 @@ static goto_t op_dox_no_body_1(s7_scheme *sc, s7_pointer slots, s7_pointer end,
       if (((f == fx_cdr_s) || (f == fx_cdr_t)) &&
 	  (cadr(a) == slot_symbol(stepper)))
 	{
-	  do {slot_set_value(stepper, cdr(slot_value(stepper)));} while (endf(sc, endp) == sc->F);
+	  do {step_tick(sc); slot_set_value(stepper, cdr(slot_value(stepper)));} while (endf(sc, endp) == sc->F); /* [c4augustus] */
 	  sc->value = sc->T;
 	}
       else /* (- n 1) tpeak dup */
@@ -80721,7 +82674,7 @@ static goto_t op_dox_no_body_1(s7_scheme *sc, s7_pointer slots, s7_pointer end,
 		  {                          /*    but tc is much slower (and bool|int_optimize dominates) */
 		    opt_info *o = sc->opts[0];
 		    bool (*fb)(opt_info *o) = o->v[0].fb;
-		    do {integer(p)++;} while (!fb(o)); /* do {integer(p)++;} while ((sc->value = optf(sc, endp)) == sc->F); */
+		    do {step_tick(sc); integer(p)++;} while (!fb(o)); /* do {integer(p)++;} while ((sc->value = optf(sc, endp)) == sc->F); */ /* [c4augustus] */
 		    clear_mutable_integer(p);
 		    sc->value = sc->T;
 		    sc->code = cdr(end);
@@ -80729,10 +82682,10 @@ static goto_t op_dox_no_body_1(s7_scheme *sc, s7_pointer slots, s7_pointer end,
 		  }
 		set_no_bool_opt(end);
 	      }
-	    do {integer(p)++;} while ((sc->value = endf(sc, endp)) == sc->F);
+	    do {step_tick(sc); integer(p)++;} while ((sc->value = endf(sc, endp)) == sc->F); /* [c4augustus] */
 	    clear_mutable_integer(p);
 	  }
-	else do {slot_set_value(stepper, f(sc, a));} while ((sc->value = endf(sc, endp)) == sc->F);
+	else do {step_tick(sc); slot_set_value(stepper, f(sc, a));} while ((sc->value = endf(sc, endp)) == sc->F); /* [c4augustus] */
 
       sc->code = cdr(end);
       return(goto_do_end_clauses);
@@ -80749,11 +82702,13 @@ static goto_t op_dox_no_body_1(s7_scheme *sc, s7_pointer slots, s7_pointer end,
 	  (endf == fx_num_eq_ui))
 	{
 	  s7_int lim = integer(caddr(endp));
+	  step_charge(sc, lim, integer(slot_value(step2))); /* [c4augustus] */
 	  for (s7_int i = integer(slot_value(step2)) - 1; i >= lim; i--)
 	    slot_set_value(step1, fx_call(sc, expr1));
 	}
       else
 	do {
+	  step_tick(sc); /* [c4augustus] */
 	  slot_set_value(step1, fx_call(sc, expr1));
 	  slot_set_value(step2, fx_call(sc, expr2));
 	} while ((sc->value = endf(sc, endp)) == sc->F);
@@ -80768,6 +82723,7 @@ static goto_t op_dox_no_body_1(s7_scheme *sc, s7_pointer slots, s7_pointer end,
     }
   do {
     s7_pointer slt = slots;
+    step_tick(sc); /* [c4augustus] */
     do {
       if (slot_has_expression(slt))
 	slot_set_value(slt, fx_call(sc, slot_expression(slt)));
@@ -80889,6 +82845,7 @@ static goto_t op_dox(s7_scheme *sc)
 			  if (has_loop_end(stepper))
 			    {
 			      s7_int lim = loop_end(stepper);
+			      step_charge(sc, i, lim); /* [c4augustus] */
 			      if ((i >= 0) && (lim < NUM_SMALL_INTS))
 				do {fp(o); slot_set_value(stepper, small_int(++i));} while (i < lim);
 			      else do {fp(o); slot_set_value(stepper, make_integer(sc, ++i));} while (i < lim);
@@ -80896,6 +82853,7 @@ static goto_t op_dox(s7_scheme *sc)
 			    }
 			  else
 			    do {
+			      step_tick(sc); /* [c4augustus] */
 			      fp(o);
 			      slot_set_value(stepper, make_integer(sc, ++i));
 			    } while ((sc->value = endf(sc, endp)) == sc->F);
@@ -80914,6 +82872,7 @@ static goto_t op_dox(s7_scheme *sc)
 			   (copy_if_end_ok(sc, slot_value(o->v[1].p), slot_value(o->v[4].o1->v[1].p), i, endp, stepper)))))
 		      /* here the has_loop_end business doesn't happen much */
 		      do {
+			step_tick(sc); /* [c4augustus] */
 			bodyf(sc);
 			slot_set_value(stepper, make_integer(sc, ++i));
 		      } while ((sc->value = endf(sc, endp)) == sc->F);
@@ -80921,6 +82880,7 @@ static goto_t op_dox(s7_scheme *sc)
 		  return(goto_do_end_clauses);
 		}
 	      do {
+		step_tick(sc); /* [c4augustus] */
 		bodyf(sc);
 		slot_set_value(stepper, stepf(sc, stepa));
 	      } while ((sc->value = endf(sc, endp)) == sc->F);
@@ -80947,6 +82907,7 @@ static goto_t op_dox(s7_scheme *sc)
 		      (is_t_integer(caddr(endp))) && (!s7_tree_memq(sc, cadr(endp), body)))
 		    {
 		      s7_int i = integer(slot_value(s2)), endi = integer(caddr(endp));
+		      step_charge(sc, i, endi); /* [c4augustus] */
 		      do {
 			fp(o);
 			slot_set_value(s1, f1(sc, p1));
@@ -80955,6 +82916,7 @@ static goto_t op_dox(s7_scheme *sc)
 		    }
 		  else
 		    do {
+		      step_tick(sc); /* [c4augustus] */
 		      fp(o);
 		      slot_set_value(s1, f1(sc, p1));
 		      slot_set_value(s2, f2(sc, p2));
@@ -80962,6 +82924,7 @@ static goto_t op_dox(s7_scheme *sc)
 		}
 	      else
 		do {
+		  step_tick(sc); /* [c4augustus] */
 		  bodyf(sc);
 		  slot_set_value(s1, f1(sc, p1));
 		  slot_set_value(s2, f2(sc, p2));
@@ -80975,6 +82938,7 @@ static goto_t op_dox(s7_scheme *sc)
 	      s7_pointer (*fp)(opt_info *o) = o->v[0].fp;
 	      do {
 		s7_pointer slot1 = slots;
+		step_tick(sc); /* [c4augustus] */
 		fp(o);
 		do {
 		  if (slot_has_expression(slot1))
@@ -80986,6 +82950,7 @@ static goto_t op_dox(s7_scheme *sc)
 	  else
 	    do {
 	      s7_pointer slot1 = slots;
+	      step_tick(sc); /* [c4augustus] */
 	      bodyf(sc);
 	      do {
 		if (slot_has_expression(slot1))
@@ -81017,6 +82982,7 @@ static goto_t op_dox(s7_scheme *sc)
 	  stepf = fx_proc(slot_expression(stepper));
 	  stepa = car(slot_expression(stepper));
 	  do {
+	    step_tick(sc); /* [c4augustus] */
 	    slot_set_value(slot, valf(sc, val));
 	    slot_set_value(stepper, stepf(sc, stepa));
 	  } while ((sc->value = endf(sc, endp)) == sc->F);
@@ -81030,6 +82996,7 @@ static goto_t op_dox(s7_scheme *sc)
 	  s7_function f = fx_proc_unchecked(code);
 	  do {
 	    s7_pointer slot1 = slots;
+	    step_tick(sc); /* [c4augustus] */
 	    f(sc, body);
 	    do {
 	      if (slot_has_expression(slot1))
@@ -81089,6 +83056,7 @@ static goto_t op_dox(s7_scheme *sc)
 	    }
 	  while (true)
 	    {
+	      step_tick(sc); /* [c4augustus] */
 	      if (use_opts)
 		for (int32_t i = 0; i < body_len; i++)
 		  body[i]->v[0].fp(body[i]);
@@ -81202,9 +83170,9 @@ static void op_dox_no_body(s7_scheme *sc)
 	  s7_function f1 = fx_proc(cdr(test));
 	  s7_function f2 = fx_proc(cddr(test));
 	  while ((f1(sc, t1) == sc->F) && (f2(sc, t2) == sc->F))
-	    integer(istep) += incr;
+	    {step_tick(sc); integer(istep) += incr;} /* [c4augustus] */
 	}
-      else while (testf(sc, test) == sc->F) {integer(istep) += incr;}
+      else while (testf(sc, test) == sc->F) {step_tick(sc); integer(istep) += incr;} /* [c4augustus] */
       if (is_small_int(integer(istep)))
 	slot_set_value(slot, small_int(integer(istep)));
       else clear_mutable_integer(istep);
@@ -81228,15 +83196,15 @@ static void op_dox_no_body(s7_scheme *sc)
 	      slot_set_value(slot, ip);
 	      while ((f1(sc, f1_arg) == sc->F) &&
 		     ((f2(sc, f2_arg) == sc->F) || (f3(sc, f3_arg) == sc->F)))
-		integer(ip)++;
+		{step_tick(sc); integer(ip)++;} /* [c4augustus] */
 	      clear_mutable_integer(ip);
 	    }
 	  else
 	    while ((f1(sc, f1_arg) == sc->F) &&
 		   ((f2(sc, f2_arg) == sc->F) || (f3(sc, f3_arg) == sc->F)))
-	      slot_set_value(slot, stepf(sc, step));
+	      {step_tick(sc); slot_set_value(slot, stepf(sc, step));} /* [c4augustus] */
 	}
-      else while (testf(sc, test) == sc->F) {slot_set_value(slot, stepf(sc, step));}
+      else while (testf(sc, test) == sc->F) {step_tick(sc); slot_set_value(slot, stepf(sc, step));} /* [c4augustus] */
       sc->value = fx_call(sc, result);
     }
 }
@@ -81274,6 +83242,7 @@ static void op_dox_pending_no_body(s7_scheme *sc)
       s7_pointer expr2 = slot_expression(slot2);
       while (fx_call(sc, test) == sc->F)
 	{
+	  step_tick(sc); /* [c4augustus] */
 	  slot_simply_set_pending_value(slot1, fx_call(sc, expr1)); /* use pending_value for GC protection */
 	  slot_set_value(slot2, fx_call(sc, expr2));
 	  slot_set_value(slot1, slot_pending_value(slot1));
@@ -81284,6 +83253,7 @@ static void op_dox_pending_no_body(s7_scheme *sc)
     }
   while ((sc->value = fx_call(sc, test)) == sc->F)
     {
+      step_tick(sc); /* [c4augustus] */
       s7_pointer slt = slots;
       do {
 	if (slot_has_expression(slt))
@@ -81321,7 +83291,7 @@ static bool op_do_no_vars(s7_scheme *sc)
       sc->curlet = inline_make_let(sc, sc->curlet);
       if (i == 1)
 	{
-	  while ((sc->value = fx_call(sc, end)) == sc->F) body[0]->v[0].fp(body[0]);
+	  while ((sc->value = fx_call(sc, end)) == sc->F) {step_tick(sc); body[0]->v[0].fp(body[0]);} /* [c4augustus] */
 	  sc->code = cdr(end);
 	  return(true);
 	}
@@ -81329,13 +83299,16 @@ static bool op_do_no_vars(s7_scheme *sc)
 	{
 	  s7_function endf = fx_proc(end);
 	  s7_pointer endp = car(end);
-	  while (!is_true(sc, sc->value = endf(sc, endp))); /* the assignment is (normally) in the noise */
+	  while (!is_true(sc, sc->value = endf(sc, endp))) step_tick(sc); /* the assignment is (normally) in the noise */ /* [c4augustus] */
 	  sc->code = cdr(end);
 	  return(true);
 	}
       while ((sc->value = fx_call(sc, end)) == sc->F)
-	for (int32_t k = 0; k < i; k++)
-	  body[k]->v[0].fp(body[k]);
+	{
+	  step_tick(sc); /* [c4augustus] */
+	  for (int32_t k = 0; k < i; k++)
+	    body[k]->v[0].fp(body[k]);
+	}
       sc->code = cdr(end);
       return(true);
     }
@@ -81576,6 +83549,7 @@ static bool op_simple_do_1(s7_scheme *sc, s7_pointer code)
       s7_int i;
       s7_int start = integer(slot_value(ctr_slot));
       s7_int stop = integer(slot_value(end_slot));
+      step_charge(sc, start, stop); /* [c4augustus] */
 
       if (func == opt_cell_any_nv)
 	{
@@ -81631,6 +83605,7 @@ static bool op_simple_do_1(s7_scheme *sc, s7_pointer code)
       (is_t_integer(slot_value(end_slot))))
     {
       s7_int i, start = integer(slot_value(ctr_slot)), stop = integer(slot_value(end_slot));
+      step_charge(sc, stop, start); /* [c4augustus] */
       if (func == opt_cell_any_nv)
 	{
 	  opt_info *o = sc->opts[0];
@@ -81664,12 +83639,14 @@ static bool op_simple_do_1(s7_scheme *sc, s7_pointer code)
 	  s7_pointer (*fp)(opt_info *o) = o->v[0].fp;
 	  for (i = start; i < stop; i += incr)
 	    {
+	      step_tick(sc); /* [c4augustus] the increment might not be positive */
 	      slot_set_value(ctr_slot, make_integer(sc, i));
 	      fp(o);
 	    }}
       else
 	for (i = start; i < stop; i += incr)
 	  {
+	    step_tick(sc); /* [c4augustus] */
 	    slot_set_value(ctr_slot, make_integer(sc, i));
 	    func(sc);
 	  }
@@ -81686,6 +83663,7 @@ static bool op_simple_do_1(s7_scheme *sc, s7_pointer code)
 	{
 	  s7_int start = integer(slot_value(ctr_slot));
 	  s7_int stop = integer(slot_value(end_slot));
+	  step_charge(sc, start, stop); /* [c4augustus] */
 	  if (fp == opt_cond_1b)
 	    {
 	      s7_pointer (*test_fp)(opt_info *o) = o->v[4].o1->v[O_WRAP].fp;
@@ -81704,6 +83682,7 @@ static bool op_simple_do_1(s7_scheme *sc, s7_pointer code)
 	      }}
       else
 	do {
+	  step_tick(sc); /* [c4augustus] */
 	  fp(o);
 	  set_car(sc->t2_1, slot_value(ctr_slot));
 	  set_car(sc->t2_2, step_var);
@@ -81714,6 +83693,7 @@ static bool op_simple_do_1(s7_scheme *sc, s7_pointer code)
     }
   else
     do {
+	step_tick(sc); /* [c4augustus] */
 	func(sc);
 	set_car(sc->t2_1, slot_value(ctr_slot));
 	set_car(sc->t2_2, step_var);
@@ -81912,6 +83892,7 @@ static bool opt_dotimes(s7_scheme *sc, s7_pointer code, s7_pointer scc, bool saf
 	  s7_int end = loop_end(sc->args);
 	  s7_pointer stepper = make_mutable_integer(sc, integer(slot_value(sc->args)));
 	  slot_set_value(sc->args, stepper);
+	  step_charge(sc, integer(stepper), end); /* [c4augustus] */
 	  if ((func == opt_float_any_nv) ||
 	      (func == opt_cell_any_nv))
 	    {
@@ -82018,6 +83999,7 @@ static bool opt_dotimes(s7_scheme *sc, s7_pointer code, s7_pointer scc, bool saf
 			{
 			  while (step < stop)
 			    {
+			      step_tick(sc); /* [c4augustus] the body can set the stepper */
 			      slot_set_value(step_slot, small_int(step));
 			      if (o->v[4].fb(o->v[3].o1))
 				{
@@ -82029,6 +84011,7 @@ static bool opt_dotimes(s7_scheme *sc, s7_pointer code, s7_pointer scc, bool saf
 		      else
 			while (step < stop)
 			  {
+			    step_tick(sc); /* [c4augustus] */
 			    slot_set_value(step_slot, small_int(step));
 			    fp(o);
 			    step = integer(slot_value(step_slot)) + 1;
@@ -82036,6 +84019,7 @@ static bool opt_dotimes(s7_scheme *sc, s7_pointer code, s7_pointer scc, bool saf
 		  else
 		    while (step < stop)
 		      {
+			step_tick(sc); /* [c4augustus] */
 			slot_set_value(step_slot, make_integer(sc, step));
 			fp(o);
 			step = integer(slot_value(step_slot)) + 1;
@@ -82044,6 +84028,7 @@ static bool opt_dotimes(s7_scheme *sc, s7_pointer code, s7_pointer scc, bool saf
 	    if ((step >= 0) && (stop < NUM_SMALL_INTS))
 	      while (step < stop)
 		{
+		  step_tick(sc); /* [c4augustus] */
 		  slot_set_value(step_slot, small_int(step));
 		  func(sc);
 		  step = integer(slot_value(step_slot)) + 1;
@@ -82055,6 +84040,7 @@ static bool opt_dotimes(s7_scheme *sc, s7_pointer code, s7_pointer scc, bool saf
 		  s7_int (*fi)(opt_info *o) = o->v[0].fi;
 		  while (step < stop)
 		    {
+		      step_tick(sc); /* [c4augustus] */
 		      slot_set_value(step_slot, make_integer(sc, step));
 		      fi(o);
 		      step = integer(slot_value(step_slot)) + 1;
@@ -82062,6 +84048,7 @@ static bool opt_dotimes(s7_scheme *sc, s7_pointer code, s7_pointer scc, bool saf
 	      else
 		while (step < stop)
 		  {
+		    step_tick(sc); /* [c4augustus] */
 		    slot_set_value(step_slot, make_integer(sc, step));
 		    func(sc);
 		    step = integer(slot_value(step_slot)) + 1;
@@ -82099,6 +84086,7 @@ static bool opt_dotimes(s7_scheme *sc, s7_pointer code, s7_pointer scc, bool saf
 		s7_int end = loop_end(sc->args);
 		s7_pointer stepper = make_mutable_integer(sc, integer(slot_value(sc->args)));
 		slot_set_value(sc->args, stepper);
+		step_charge(sc, integer(stepper), end); /* [c4augustus] */
 		for (; integer(stepper) < end; integer(stepper)++)
 		  for (int32_t i = 0; i < body_len; i++) body[i]->v[0].fd(body[i]);
 		clear_mutable_integer(stepper);
@@ -82110,6 +84098,7 @@ static bool opt_dotimes(s7_scheme *sc, s7_pointer code, s7_pointer scc, bool saf
 		s7_int stop = integer(slot_value(end_slot));
 		for (s7_int step = integer(slot_value(step_slot)); step < stop; step = integer(slot_value(step_slot)) + 1)
 		  {
+		    step_tick(sc); /* [c4augustus] */
 		    slot_set_value(step_slot, make_integer(sc, step));
 		    for (int32_t i = 0; i < body_len; i++) body[i]->v[0].fd(body[i]);
 		  }}
@@ -82139,6 +84128,7 @@ static bool opt_dotimes(s7_scheme *sc, s7_pointer code, s7_pointer scc, bool saf
 	    s7_int end = loop_end(sc->args);
 	    s7_pointer stepper = make_mutable_integer(sc, integer(slot_value(sc->args)));
 	    slot_set_value(sc->args, stepper);
+	    step_charge(sc, integer(stepper), end); /* [c4augustus] */
 	    if ((body_len & 0x3) == 0)
 	      for (; integer(stepper) < end; integer(stepper)++)
 		for (int32_t i = 0; i < body_len; )
@@ -82155,6 +84145,7 @@ static bool opt_dotimes(s7_scheme *sc, s7_pointer code, s7_pointer scc, bool saf
 	    s7_int stop = integer(slot_value(end_slot));
 	    for (s7_int step = integer(slot_value(step_slot)); step < stop; step = integer(slot_value(step_slot)) + 1)
 	      {
+		step_tick(sc); /* [c4augustus] */
 		slot_set_value(step_slot, make_integer(sc, step));
 		for (int32_t i = 0; i < body_len; i++) body[i]->v[0].fp(body[i]);
 	      }}
@@ -82226,6 +84217,7 @@ static bool do_let(s7_scheme *sc, s7_pointer step_slot, s7_pointer scc)
   end = loop_end(step_slot);
   let_set_slots(sc->curlet, reverse_slots(let_slots(sc->curlet)));
   ip = slot_value(step_slot);
+  step_charge(sc, numerator(stepper), end); /* [c4augustus] */
 
   if (body_len == 1)
     {
@@ -82403,6 +84395,7 @@ static goto_t op_safe_dotimes(s7_scheme *sc)
 		{
 		  s7_int end = s7_integer_clamped_if_gmp(sc, end_val);
 		  s7_pointer body = cddr(code), stepper = slot_value(sc->args);
+		  step_charge(sc, integer(stepper), end); /* [c4augustus] */
 		  for (; integer(stepper) < end; integer(stepper)++)
 		    fx_call(sc, body);
 		  sc->value = sc->T;
@@ -82503,6 +84496,7 @@ static goto_t op_safe_do(s7_scheme *sc)
 	      s7_int step = integer(slot_value(step_slot));
 	      s7_pointer step_val = make_mutable_integer(sc, step);
 	      slot_set_value(step_slot, step_val);
+	      step_charge(sc, step, endi); /* [c4augustus] */
 	      do {
 		slot_set_value(val_slot, fx_call(sc, fx_p));
 		integer(step_val) = ++step;
@@ -84630,7 +86624,7 @@ static bool check_closure_sym(s7_scheme *sc, int32_t args)
   if ((symbol_ctr(car(sc->code)) != 1) ||
       (unchecked_local_value(car(sc->code)) != opt1_lambda_unchecked(sc->code)))
     {
-      s7_pointer f = lookup_unexamined(sc, car(sc->code));
+      s7_pointer f = lookup_call_head(sc, car(sc->code));
       if ((f != opt1_lambda_unchecked(sc->code)) &&
 	  ((!f) ||
 	   ((typesflag(f) & (TYPE_MASK | T_SAFE_CLOSURE)) != T_CLOSURE) ||
@@ -84743,6 +86737,7 @@ static bool op_tc_case_la(s7_scheme *sc, s7_pointer code)
     {
       while (true)
 	{
+	  step_tick(sc); /* [c4augustus] */
 	  s7_pointer selector = fx_call(sc, selp);
 	  if (selector == opt1_any(clauses))
 	    endp = opt2_any(clauses);
@@ -84758,6 +86753,7 @@ static bool op_tc_case_la(s7_scheme *sc, s7_pointer code)
   else
     while (true)
       {
+	step_tick(sc); /* [c4augustus] */
 	s7_pointer p, selector = fx_call(sc, selp);
 	for (p = clauses; is_pair(cdr(p)); p = cdr(p))
 	  if (selector == opt1_any(p)) {endp = opt2_any(p); goto CASE_ALA_END;}
@@ -84802,6 +86798,7 @@ static void op_tc_and_a_or_a_la(s7_scheme *sc, s7_pointer code)
   /* cell_optimize here is slower! */
   while (true)
     {
+      step_tick(sc); /* [c4augustus] */
       s7_pointer p;
       if (fx_call(sc, fx_and) == sc->F) {sc->value = sc->F; return;}
       p = fx_call(sc, fx_or);
@@ -84824,6 +86821,7 @@ static void op_tc_or_a_and_a_la(s7_scheme *sc, s7_pointer code)
   s7_pointer fx_la = cdadr(fx_and);
   while (true)
     {
+      step_tick(sc); /* [c4augustus] */
       s7_pointer p = fx_call(sc, fx_or);
       if (p != sc->F) {sc->value = p; return;}
       if (fx_call(sc, fx_and) == sc->F) {sc->value = sc->F; return;}
@@ -84846,6 +86844,7 @@ static void op_tc_and_a_or_a_a_la(s7_scheme *sc, s7_pointer code)
   s7_pointer fx_la = cdadr(fx_or2);
   while (true)
     {
+      step_tick(sc); /* [c4augustus] */
       s7_pointer p;
       if (fx_call(sc, fx_and) == sc->F) {sc->value = sc->F; return;}
       p = fx_call(sc, fx_or1);
@@ -84871,6 +86870,7 @@ static void op_tc_or_a_and_a_a_la(s7_scheme *sc, s7_pointer code)
   s7_pointer fx_la = cdadr(fx_and2);
   while (true)
     {
+      step_tick(sc); /* [c4augustus] */
       s7_pointer p = fx_call(sc, fx_or);
       if (p != sc->F) {sc->value = p; return;}
       if ((fx_call(sc, fx_and1) == sc->F) ||
@@ -84896,6 +86896,7 @@ static void op_tc_or_a_a_and_a_a_la(s7_scheme *sc, s7_pointer code)
   s7_pointer fx_la = cdadr(fx_and2);
   while (true)
     {
+      step_tick(sc); /* [c4augustus] */
       s7_pointer p = fx_call(sc, fx_or1);
       if (p != sc->F) {sc->value = p; return;}
       p = fx_call(sc, fx_or2);
@@ -84927,6 +86928,7 @@ static void op_tc_and_a_or_a_laa(s7_scheme *sc, s7_pointer code)
       s7_pointer la_val = slot_value(la_slot), laa_val = slot_value(laa_slot);
       while (true)
 	{
+	  step_tick(sc); /* [c4augustus] */
 	  if (is_null(laa_val)) {sc->value = sc->F; return;}
 	  if (is_null(la_val)) {sc->value = sc->T; return;}
 	  la_val = cdr(la_val);
@@ -84934,6 +86936,7 @@ static void op_tc_and_a_or_a_laa(s7_scheme *sc, s7_pointer code)
 	}}
   while (true)
     {
+      step_tick(sc); /* [c4augustus] */
       s7_pointer p;
       if (fx_call(sc, fx_and) == sc->F) {sc->value = sc->F; return;}
       p = fx_call(sc, fx_or);
@@ -84961,6 +86964,7 @@ static void op_tc_or_a_and_a_laa(s7_scheme *sc, s7_pointer code)
   s7_pointer laa_slot = next_slot(la_slot);
   while (true)
     {
+      step_tick(sc); /* [c4augustus] */
       s7_pointer p = fx_call(sc, fx_or);
       if (p != sc->F) {sc->value = p; return;}
       if (fx_call(sc, fx_and) == sc->F) {sc->value = sc->F; return;}
@@ -84989,6 +86993,7 @@ static void op_tc_and_a_or_a_l3a(s7_scheme *sc, s7_pointer code)
   s7_pointer l3a_slot = next_slot(laa_slot);
   while (true)
     {
+      step_tick(sc); /* [c4augustus] */
       s7_pointer p;
       if (fx_call(sc, fx_and) == sc->F) {sc->value = sc->F; return;}
       p = fx_call(sc, fx_or);
@@ -85021,6 +87026,7 @@ static void op_tc_or_a_and_a_l3a(s7_scheme *sc, s7_pointer code)
   s7_pointer l3a_slot = next_slot(laa_slot);
   while (true)
     {
+      step_tick(sc); /* [c4augustus] */
       s7_pointer p = fx_call(sc, fx_or);
       if (p != sc->F) {sc->value = p; return;}
       if (fx_call(sc, fx_and) == sc->F) {sc->value = sc->F; return;}
@@ -85057,6 +87063,7 @@ static void op_tc_or_a_and_a_a_l3a(s7_scheme *sc, s7_pointer code)
       fx_and2 = cdar(fx_and2);
       while (true)
 	{
+	  step_tick(sc); /* [c4augustus] */
 	  s7_pointer p = fx_call(sc, fx_or);
 	  if (p != sc->F) {sc->value = p; return;}
 	  if ((fx_call(sc, fx_and1) != sc->F) || (fx_call(sc, fx_and2) != sc->F)) {sc->value = sc->F; return;}
@@ -85068,6 +87075,7 @@ static void op_tc_or_a_and_a_a_l3a(s7_scheme *sc, s7_pointer code)
 	}}
   while (true)
     {
+      step_tick(sc); /* [c4augustus] */
       s7_pointer p = fx_call(sc, fx_or);
       if (p != sc->F) {sc->value = p; return;}
       if ((fx_call(sc, fx_and1) == sc->F) || (fx_call(sc, fx_and2) == sc->F)) {sc->value = sc->F; return;}
@@ -85104,10 +87112,10 @@ static bool op_tc_if_a_z_la(s7_scheme *sc, s7_pointer code, bool cond)
 	    {
 	      s7_pointer val = make_mutable_integer(sc, integer(slot_value(la_slot)));
 	      slot_set_value(la_slot, val);
-	      while (!(o->v[0].fb(o))){integer(val) = o1->v[0].fi(o1);}
+	      while (!(o->v[0].fb(o))) {step_tick(sc); integer(val) = o1->v[0].fi(o1);} /* [c4augustus] */
 	      return(op_tc_z(sc, if_true));
 	    }}}
-  while (fx_call(sc, if_test) == sc->F) {slot_set_value(la_slot, fx_call(sc, la));}
+  while (fx_call(sc, if_test) == sc->F) {step_tick(sc); slot_set_value(la_slot, fx_call(sc, la));} /* [c4augustus] */
   return(op_tc_z(sc, if_true));
 }
 
@@ -85141,10 +87149,10 @@ static bool op_tc_if_a_la_z(s7_scheme *sc, s7_pointer code, bool cond)
 	    {
 	      s7_pointer val = make_mutable_integer(sc, integer(slot_value(la_slot)));
 	      slot_set_value(la_slot, val);
-	      while (o->v[0].fb(o)) {integer(val) = o1->v[0].fi(o1);}
+	      while (o->v[0].fb(o)) {step_tick(sc); integer(val) = o1->v[0].fi(o1);} /* [c4augustus] */
 	      return(op_tc_z(sc, if_false));
 	    }}}
-  while (fx_call(sc, if_test) != sc->F) {slot_set_value(la_slot, fx_call(sc, la));}
+  while (fx_call(sc, if_test) != sc->F) {step_tick(sc); slot_set_value(la_slot, fx_call(sc, la));} /* [c4augustus] */
   return(op_tc_z(sc, if_false));
 }
 
@@ -85213,6 +87221,7 @@ static bool op_tc_if_a_z_laa(s7_scheme *sc, s7_pointer code, bool z_first, tc_ch
 			  s7_pointer slot1 = o->v[1].p, slot2 = o1->v[1].p;
 			  while (integer(slot_value(slot1)) >= lim)
 			    {
+			      step_tick(sc); /* [c4augustus] */
 			      s7_int i1 = integer(slot_value(slot2)) - m;
 			      integer(val2) = fi2(o2);
 			      integer(val1) = i1;
@@ -85220,6 +87229,7 @@ static bool op_tc_if_a_z_laa(s7_scheme *sc, s7_pointer code, bool z_first, tc_ch
 		      else
 			while (fb(o) != z_first)
 			  {
+			    step_tick(sc); /* [c4augustus] */
 			    s7_int i1 = fi1(o1);
 			    integer(val2) = fi2(o2);
 			    integer(val1) = i1;
@@ -85253,6 +87263,7 @@ static bool op_tc_if_a_z_laa(s7_scheme *sc, s7_pointer code, bool z_first, tc_ch
 			  s7_pointer slot2 = o1->v[1].p;
 			  while (real(slot_value(slot1)) >= lim)
 			    {
+			      step_tick(sc); /* [c4augustus] */
 			      s7_double x1 = real(slot_value(slot2)) - m;
 			      real(val2) = fd2(o2);
 			      real(val1) = x1;
@@ -85260,6 +87271,7 @@ static bool op_tc_if_a_z_laa(s7_scheme *sc, s7_pointer code, bool z_first, tc_ch
 		      else
 			while (fb(o) != z_first)
 			  {
+			    step_tick(sc); /* [c4augustus] */
 			    s7_double x1 = fd1(o1);
 			    real(val2) = fd2(o2);
 			    real(val1) = x1;
@@ -85286,6 +87298,7 @@ static bool op_tc_if_a_z_laa(s7_scheme *sc, s7_pointer code, bool z_first, tc_ch
       else
 	while (tf(sc, if_test) == sc->F)
 	  {
+	    step_tick(sc); /* [c4augustus] */
 	    sc->rec_p1 = fx_call(sc, la);
 	    slot_set_value(laa_slot, fx_call(sc, laa));
 	    slot_set_value(la_slot, sc->rec_p1);
@@ -85293,6 +87306,7 @@ static bool op_tc_if_a_z_laa(s7_scheme *sc, s7_pointer code, bool z_first, tc_ch
   else
     while (tf(sc, if_test) != sc->F)
       {
+	step_tick(sc); /* [c4augustus] */
 	sc->rec_p1 = fx_call(sc, la);
 	slot_set_value(laa_slot, fx_call(sc, laa));
 	slot_set_value(la_slot, sc->rec_p1);
@@ -85340,6 +87354,7 @@ static void op_tc_when_la(s7_scheme *sc, s7_pointer code)
   la = cdar(la_call);
   while (tf(sc, if_test) != sc->F)
     {
+      step_tick(sc); /* [c4augustus] */
       for (s7_pointer p = body; p != la_call; p = cdr(p)) fx_call(sc, p);
       slot_set_value(la_slot, fx_call(sc, la));
     }
@@ -85356,6 +87371,7 @@ static void op_tc_when_laa(s7_scheme *sc, s7_pointer code)
   laa_slot = next_slot(la_slot);
   while (tf(sc, if_test) != sc->F)
     {
+      step_tick(sc); /* [c4augustus] */
       for (s7_pointer p = body; p != la_call; p = cdr(p)) fx_call(sc, p);
       sc->rec_p1 = fx_call(sc, la);
       slot_set_value(laa_slot, fx_call(sc, laa));
@@ -85377,6 +87393,7 @@ static void op_tc_when_l3a(s7_scheme *sc, s7_pointer code)
   l3a_slot = next_slot(laa_slot);
   while (tf(sc, if_test) != sc->F)
     {
+      step_tick(sc); /* [c4augustus] */
       for (s7_pointer p = body; p != la_call; p = cdr(p)) fx_call(sc, p);
       sc->rec_p1 = fx_call(sc, la);
       sc->rec_p2 = fx_call(sc, laa);
@@ -85401,6 +87418,7 @@ static bool op_tc_if_a_z_l3a(s7_scheme *sc, s7_pointer code, bool z_first)
   if_test = car(if_test);
   while ((tf(sc, if_test) == sc->F) == z_first)
     {
+      step_tick(sc); /* [c4augustus] */
       sc->rec_p1 = fx_call(sc, la);
       sc->rec_p2 = fx_call(sc, laa);
       slot_set_value(l3a_slot, fx_call(sc, l3a));
@@ -85468,6 +87486,7 @@ static bool op_tc_if_a_z_if_a_z_la(s7_scheme *sc, s7_pointer code, bool z_first,
  		  if (tc_and)
 		    while (true)
 		      {
+			step_tick(sc); /* [c4augustus] */
 			if (!o->v[0].fb(o)) {sc->value = sc->F; return(true);}
 			if (o1->v[0].fb(o1) == z_first) {endp = f_z; break;}
 			integer(val) = o2->v[0].fi(o2);
@@ -85475,6 +87494,7 @@ static bool op_tc_if_a_z_if_a_z_la(s7_scheme *sc, s7_pointer code, bool z_first,
  		  else
 		    while (true)
 		      {
+			step_tick(sc); /* [c4augustus] */
 			if (o->v[0].fb(o)) {endp = if_true; break;}
 			if (o1->v[0].fb(o1) == z_first) {endp = f_z; break;}
 			integer(val) = o2->v[0].fi(o2);
@@ -85484,6 +87504,7 @@ static bool op_tc_if_a_z_if_a_z_la(s7_scheme *sc, s7_pointer code, bool z_first,
 #endif
   while (true)
     {
+      step_tick(sc); /* [c4augustus] */
       if ((fx_call(sc, if_test) == sc->F) == tc_and) {if (tc_and) {sc->value = sc->F; return(true);} else {endp = if_true; break;}}
       if ((fx_call(sc, f_test) == sc->F) != z_first) {endp = f_z; break;}
       slot_set_value(la_slot, fx_call(sc, la));
@@ -85553,6 +87574,7 @@ static bool op_tc_if_a_z_if_a_z_laa(s7_scheme *sc, bool cond, s7_pointer code)
 	  s7_pointer la_val = slot_value(la_slot), laa_val = slot_value(laa_slot);
 	  while (true)
 	    {
+	      step_tick(sc); /* [c4augustus] */
 	      if (is_null(laa_val)) {sc->value = car(if_true); return(true);}
 	      if (is_null(la_val)) {sc->value = car(f_true); return(true);}
 	      la_val = cdr(la_val);
@@ -85560,6 +87582,7 @@ static bool op_tc_if_a_z_if_a_z_laa(s7_scheme *sc, bool cond, s7_pointer code)
 	    }}
       while (true)
 	{
+	  step_tick(sc); /* [c4augustus] */
 	  if (is_null(slot_value(slot1))) {endp = if_true; break;}
 	  if (fx_call(sc, f_test) != sc->F) {endp = f_true; break;}
 	  sc->rec_p1 = fx_call(sc, la);
@@ -85569,6 +87592,7 @@ static bool op_tc_if_a_z_if_a_z_laa(s7_scheme *sc, bool cond, s7_pointer code)
   else
     while (true)
       {
+	step_tick(sc); /* [c4augustus] */
 	if (fx_call(sc, if_test) != sc->F) {endp = if_true; break;}
 	if (fx_call(sc, f_test) != sc->F) {endp = f_true; break;}
 	sc->rec_p1 = fx_call(sc, la);
@@ -85608,6 +87632,7 @@ static bool op_tc_if_a_z_if_a_laa_z(s7_scheme *sc, bool cond, s7_pointer code)
   laa_slot = next_slot(la_slot);
   while (true)
     {
+      step_tick(sc); /* [c4augustus] */
       if (fx_call(sc, if_test) != sc->F) {endp = if_true; break;}
       if (fx_call(sc, f_test) == sc->F) {endp = f_false; break;}
       sc->rec_p1 = fx_call(sc, la);
@@ -85652,6 +87677,7 @@ static bool op_tc_if_a_z_if_a_l3a_l3a(s7_scheme *sc, s7_pointer code)
   s7_pointer l3a_slot = next_slot(laa_slot);
   while (true)
     {
+      step_tick(sc); /* [c4augustus] */
       if (fx_call(sc, if_test) != sc->F) {endp = if_true; break;}
       if (fx_call(sc, f_test) != sc->F)
 	{
@@ -85698,6 +87724,7 @@ static bool op_tc_let_if_a_z_la(s7_scheme *sc, s7_pointer code)
 
   while (fx_call(sc, if_test) == sc->F)
     {
+      step_tick(sc); /* [c4augustus] */
       slot_set_value(la_slot, fx_call(sc, la));
       set_curlet(sc, outer_let);
       slot_set_value(let_slot, fx_call(sc, let_var));
@@ -85764,6 +87791,7 @@ static bool op_tc_let_if_a_z_laa(s7_scheme *sc, s7_pointer code)
 			  slot_set_value(let_slot, val3);
 			  while (!(o->v[0].fb(o)))
 			    {
+			      step_tick(sc); /* [c4augustus] */
 			      s7_int i1 = o1->v[0].fi(o1);
 			      integer(val2) = o2->v[0].fi(o2);
 			      integer(val1) = i1;
@@ -85781,6 +87809,7 @@ static bool op_tc_let_if_a_z_laa(s7_scheme *sc, s7_pointer code)
 #endif
   while (fx_call(sc, if_test) == sc->F)
     {
+      step_tick(sc); /* [c4augustus] */
       sc->rec_p1 = fx_call(sc, la);
       slot_set_value(laa_slot, fx_call(sc, laa));
       slot_set_value(la_slot, sc->rec_p1);
@@ -85835,12 +87864,14 @@ static void op_tc_let_when_laa(s7_scheme *sc, bool when, s7_pointer code)
 	      a2 = slot_value(next_slot(let_slots(outer_let)));
 	      while (c != EOF)
 		{
+		  step_tick(sc); /* [c4augustus] */
 		  inline_file_write_char(sc, (uint8_t)c, a2);
 		  c = string_read_char(sc, a1);
 		}}
 	  else
 	    while (fx_call(sc, if_test) == sc->F)
 	      {
+		step_tick(sc); /* [c4augustus] */
 		fx_call(sc, if_true);
 		set_curlet(sc, outer_let);
 		slot_set_value(let_slot, fx_call(sc, let_var));
@@ -85849,6 +87880,7 @@ static void op_tc_let_when_laa(s7_scheme *sc, bool when, s7_pointer code)
       else
 	while (true)
 	  {
+	    step_tick(sc); /* [c4augustus] */
 	    p = fx_call(sc, if_test);
 	    if (when) {if (p == sc->F) break;} else {if (p != sc->F) break;}
 	    for (p = if_true; is_pair(cdr(p)); p = cdr(p))
@@ -85863,6 +87895,7 @@ static void op_tc_let_when_laa(s7_scheme *sc, bool when, s7_pointer code)
       s7_pointer laa_slot = next_slot(la_slot);
       while (true)
 	{
+	  step_tick(sc); /* [c4augustus] */
 	  p = fx_call(sc, if_test);
 	  if (when) {if (p == sc->F) break;} else {if (p != sc->F) break;}
 	  for (p = if_true; is_pair(cdr(p)); p = cdr(p))
@@ -85920,6 +87953,7 @@ static bool op_tc_if_a_z_let_if_a_z_laa(s7_scheme *sc, s7_pointer code)
 
   while (true)
     {
+      step_tick(sc); /* [c4augustus] */
       if (fx_call(sc, if1_test) != sc->F) {endp = if1_true; break;}
       slot = let_slots(inner_let);
       slot_set_value(slot, fx_call(sc, cdar(let_vars)));
@@ -85967,6 +88001,7 @@ static bool op_tc_let_cond(s7_scheme *sc, s7_pointer code)
   if (opt3_arglen(cdr(code)) == 0) /* (loop) etc -- no args */
     while (true)
       {
+	step_tick(sc); /* [c4augustus] */
 	for (s7_pointer p = cond_body; is_pair(p); p = cdr(p))
 	  if (fx_call(sc, car(p)) != sc->F)
 	    {
@@ -85980,7 +88015,7 @@ static bool op_tc_let_cond(s7_scheme *sc, s7_pointer code)
 	    }}
   else
     if (opt3_arglen(cdr(code)) == 1)
-      while (true)
+      for (;; step_tick(sc)) /* [c4augustus] was while (true) */
 	for (s7_pointer p = cond_body; is_pair(p); p = cdr(p))
 	  if (fx_call(sc, car(p)) != sc->F)
 	    {
@@ -85996,7 +88031,7 @@ static bool op_tc_let_cond(s7_scheme *sc, s7_pointer code)
 
   let_set_has_pending_value(outer_let);
   read_case = ((letf == read_char_p_p) && (is_input_port(let_var)) && (is_string_port(let_var)) && (!port_is_closed(let_var)));
-  while (true)
+  for (;; step_tick(sc)) /* [c4augustus] was while (true) */
     for (s7_pointer p = cond_body; is_pair(p); p = cdr(p))
       if (fx_call(sc, car(p)) != sc->F)
 	{
@@ -86051,6 +88086,7 @@ static bool op_tc_cond_a_z_a_laa_laa(s7_scheme *sc, s7_pointer code)
   s7_pointer laa_slot = next_slot(la_slot);
   while (true)
     {
+      step_tick(sc); /* [c4augustus] */
       if (fx_call(sc, c1) != sc->F) {c1 = cdr(c1); break;}
       if (fx_call(sc, c2) != sc->F)
 	{
@@ -86236,6 +88272,7 @@ static opt_pid_t opinit_if_a_a_opa_laq(s7_scheme *sc, bool a_op, bool la_op, s7_
 static s7_int oprec_i_if_a_a_opa_laq(s7_scheme *sc)
 {
   s7_int i1;
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_test_o->v[0].fb(sc->rec_test_o)) return(sc->rec_result_o->v[0].fi(sc->rec_result_o));
   i1 = sc->rec_a1_o->v[0].fi(sc->rec_a1_o);
   integer(sc->rec_val1) = sc->rec_a2_o->v[0].fi(sc->rec_a2_o);
@@ -86245,6 +88282,7 @@ static s7_int oprec_i_if_a_a_opa_laq(s7_scheme *sc)
 static s7_int oprec_i_if_a_opa_laq_a(s7_scheme *sc)
 {
   s7_int i1;
+  step_tick(sc); /* [c4augustus] */
   if (!sc->rec_test_o->v[0].fb(sc->rec_test_o)) return(sc->rec_result_o->v[0].fi(sc->rec_result_o));
   i1 = sc->rec_a1_o->v[0].fi(sc->rec_a1_o);
   integer(sc->rec_val1) = sc->rec_a2_o->v[0].fi(sc->rec_a2_o);
@@ -86253,6 +88291,7 @@ static s7_int oprec_i_if_a_opa_laq_a(s7_scheme *sc)
 
 static s7_pointer oprec_if_a_a_opa_laq(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) != sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   recur_push(sc, sc->rec_f1f(sc, sc->rec_f1p));
   slot_set_value(sc->rec_slot1, sc->rec_f2f(sc, sc->rec_f2p));
@@ -86273,6 +88312,7 @@ static s7_pointer oprec_if_a_a_opa_laq(s7_scheme *sc)
 
 static s7_pointer oprec_if_a_a_opla_aq(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) != sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   recur_push(sc, sc->rec_f1f(sc, sc->rec_f1p));
   slot_set_value(sc->rec_slot1, sc->rec_f2f(sc, sc->rec_f2p));
@@ -86283,6 +88323,7 @@ static s7_pointer oprec_if_a_a_opla_aq(s7_scheme *sc)
 
 static s7_pointer oprec_if_a_opa_laq_a(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) == sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   recur_push(sc, sc->rec_f1f(sc, sc->rec_f1p));
   slot_set_value(sc->rec_slot1, sc->rec_f2f(sc, sc->rec_f2p));
@@ -86303,6 +88344,7 @@ static s7_pointer oprec_if_a_opa_laq_a(s7_scheme *sc)
 
 static s7_pointer oprec_if_a_opla_aq_a(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) == sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   recur_push(sc, sc->rec_f1f(sc, sc->rec_f1p));
   slot_set_value(sc->rec_slot1, sc->rec_f2f(sc, sc->rec_f2p));
@@ -86391,6 +88433,7 @@ static void opinit_if_a_a_opa_laaq(s7_scheme *sc, int32_t a_op)
 
 static s7_pointer oprec_if_a_a_opa_laaq(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) != sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   recur_push(sc, sc->rec_f1f(sc, sc->rec_f1p));
   recur_push(sc, sc->rec_f2f(sc, sc->rec_f2p));
@@ -86414,6 +88457,7 @@ static s7_pointer oprec_if_a_a_opa_laaq(s7_scheme *sc)
 
 static s7_pointer oprec_if_a_opa_laaq_a(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) == sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   recur_push(sc, sc->rec_f1f(sc, sc->rec_f1p));
   recur_push(sc, sc->rec_f2f(sc, sc->rec_f2p));
@@ -86461,6 +88505,7 @@ static void opinit_if_a_a_opa_l3aq(s7_scheme *sc)
 
 static s7_pointer oprec_if_a_a_opa_l3aq(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) != sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   recur_push(sc, sc->rec_f1f(sc, sc->rec_f1p));
   recur_push(sc, sc->rec_f2f(sc, sc->rec_f2p));
@@ -86567,6 +88612,7 @@ static opt_pid_t opinit_if_a_a_opla_laq(s7_scheme *sc, bool a_op)
 static s7_int oprec_i_if_a_a_opla_laq(s7_scheme *sc)
 {
   s7_int i1, i2;
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_test_o->v[0].fb(sc->rec_test_o))                   /* if_(A) */
     return(sc->rec_result_o->v[0].fi(sc->rec_result_o));         /* if_a_(A) */
   i1 = sc->rec_a1_o->v[0].fi(sc->rec_a1_o);                      /* save a1 */
@@ -86579,6 +88625,7 @@ static s7_int oprec_i_if_a_a_opla_laq(s7_scheme *sc)
 static s7_int oprec_i_if_a_a_opla_laq_0(s7_scheme *sc)
 {
   s7_int i1, i2;
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_fb1(sc->rec_test_o)) return(sc->rec_fi1(sc->rec_result_o));
   i1 = sc->rec_fi2(sc->rec_a1_o);
   integer(sc->rec_val1) = sc->rec_fi3(sc->rec_a2_o);
@@ -86600,6 +88647,7 @@ static s7_int oprec_i_if_a_a_opla_laq_0(s7_scheme *sc)
 static s7_double oprec_d_if_a_a_opla_laq(s7_scheme *sc)
 {
   s7_double x1, x2;
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_test_o->v[0].fb(sc->rec_test_o)) return(sc->rec_result_o->v[0].fd(sc->rec_result_o));
   x1 = sc->rec_a1_o->v[0].fd(sc->rec_a1_o);
   real(sc->rec_val1) = sc->rec_a2_o->v[0].fd(sc->rec_a2_o);
@@ -86620,6 +88668,7 @@ static s7_double oprec_d_if_a_a_opla_laq(s7_scheme *sc)
 
 static s7_pointer oprec_if_a_a_opla_laq(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) != sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   recur_push(sc, sc->rec_f1f(sc, sc->rec_f1p));
   slot_set_value(sc->rec_slot1, sc->rec_f2f(sc, sc->rec_f2p));
@@ -86632,6 +88681,7 @@ static s7_pointer oprec_if_a_a_opla_laq(s7_scheme *sc)
 static s7_int oprec_i_if_a_opla_laq_a(s7_scheme *sc)
 {
   s7_int i1, i2;
+  step_tick(sc); /* [c4augustus] */
   if (!(sc->rec_test_o->v[0].fb(sc->rec_test_o))) return(sc->rec_result_o->v[0].fi(sc->rec_result_o));
   i1 = sc->rec_a1_o->v[0].fi(sc->rec_a1_o);
   integer(sc->rec_val1) = sc->rec_a2_o->v[0].fi(sc->rec_a2_o);
@@ -86643,6 +88693,7 @@ static s7_int oprec_i_if_a_opla_laq_a(s7_scheme *sc)
 static s7_int oprec_i_if_a_opla_laq_a_0(s7_scheme *sc)
 {
   s7_int i1, i2;
+  step_tick(sc); /* [c4augustus] */
   if (!sc->rec_fb1(sc->rec_test_o)) return(sc->rec_fi1(sc->rec_result_o));
   i1 = sc->rec_fi2(sc->rec_a1_o);
   integer(sc->rec_val1) = sc->rec_fi3(sc->rec_a2_o);
@@ -86664,6 +88715,7 @@ static s7_int oprec_i_if_a_opla_laq_a_0(s7_scheme *sc)
 static s7_double oprec_d_if_a_opla_laq_a(s7_scheme *sc)
 {
   s7_double x1, x2;
+  step_tick(sc); /* [c4augustus] */
   if (!(sc->rec_test_o->v[0].fb(sc->rec_test_o))) return(sc->rec_result_o->v[0].fd(sc->rec_result_o));
   x1 = sc->rec_a1_o->v[0].fd(sc->rec_a1_o);
   real(sc->rec_val1) = sc->rec_a2_o->v[0].fd(sc->rec_a2_o);
@@ -86674,6 +88726,7 @@ static s7_double oprec_d_if_a_opla_laq_a(s7_scheme *sc)
 
 static s7_pointer oprec_if_a_opla_laq_a(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) == sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   recur_push(sc, sc->rec_f1f(sc, sc->rec_f1p));
   slot_set_value(sc->rec_slot1, sc->rec_f2f(sc, sc->rec_f2p));
@@ -86719,6 +88772,7 @@ static void opinit_if_a_a_opa_la_laq(s7_scheme *sc, bool a_op)
 
 static s7_pointer oprec_if_a_a_opa_la_laq(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) != sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   recur_push(sc, sc->rec_f1f(sc, sc->rec_f1p));
   recur_push(sc, sc->rec_f2f(sc, sc->rec_f2p));
@@ -86732,6 +88786,7 @@ static s7_pointer oprec_if_a_a_opa_la_laq(s7_scheme *sc)
 
 static s7_pointer oprec_if_a_opa_la_laq_a(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) == sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   recur_push(sc, sc->rec_f1f(sc, sc->rec_f1p));
   recur_push(sc, sc->rec_f2f(sc, sc->rec_f2p));
@@ -86770,6 +88825,7 @@ static void opinit_if_a_a_opla_la_laq(s7_scheme *sc, bool a_op)
 
 static s7_pointer oprec_if_a_a_opla_la_laq(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) != sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   recur_push(sc, sc->rec_f1f(sc, sc->rec_f1p));
   recur_push(sc, sc->rec_f2f(sc, sc->rec_f2p));
@@ -86845,6 +88901,7 @@ static void opinit_if_a_a_lopl3a_l3a_l3aq(s7_scheme *sc)
 
 static s7_pointer oprec_if_a_a_lopl3a_l3a_l3aq(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) != sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   recur_push(sc, sc->rec_f1f(sc, sc->rec_f1p));
   recur_push(sc, sc->rec_f2f(sc, sc->rec_f2p));
@@ -86897,6 +88954,7 @@ static void opinit_if_a_a_and_a_laa_laa(s7_scheme *sc, s7_pointer code)
 
 static s7_pointer oprec_if_a_a_and_a_laa_laa(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) != sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   if (sc->rec_f1f(sc, sc->rec_f1p) == sc->F) return(sc->F);
   recur_push(sc, slot_value(sc->rec_slot1));
@@ -86960,6 +89018,7 @@ static void opinit_cond_a_a_a_a_opla_laq(s7_scheme *sc, s7_pointer code, bool co
 
 static inline s7_pointer oprec_cond_a_a_a_a_opla_laq(s7_scheme *sc) /* inline = 27 in trec */
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) != sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   if (sc->rec_f1f(sc, sc->rec_f1p) != sc->F) return(sc->rec_f2f(sc, sc->rec_f2p));
   recur_push(sc, sc->rec_f3f(sc, sc->rec_f3p));
@@ -87026,6 +89085,7 @@ static void opinit_cond_a_a_a_a_oplaa_laaq(s7_scheme *sc, bool cond_case)
 
 static s7_pointer oprec_cond_a_a_a_a_oplaa_laaq(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) != sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   if (sc->rec_f1f(sc, sc->rec_f1p) != sc->F) return(sc->rec_f2f(sc, sc->rec_f2p));
   recur_push(sc, sc->rec_f3f(sc, sc->rec_f3p));
@@ -87075,6 +89135,7 @@ static void opinit_cond_a_a_a_a_opa_laaq(s7_scheme *sc)
 
 static s7_pointer oprec_cond_a_a_a_a_opa_laaq(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) != sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   if (sc->rec_f1f(sc, sc->rec_f1p) != sc->F) return(sc->rec_f2f(sc, sc->rec_f2p));
   recur_push(sc, sc->rec_f3f(sc, sc->rec_f3p));
@@ -87118,6 +89179,7 @@ static void opinit_cond_a_a_a_laa_opa_laaq(s7_scheme *sc, bool cond)
 
 static s7_pointer oprec_cond_a_a_a_laa_opa_laaq(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) != sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   if (sc->rec_f1f(sc, sc->rec_f1p) != sc->F)
     {
@@ -87242,6 +89304,7 @@ static opt_pid_t opinit_cond_a_a_a_laa_lopa_laaq(s7_scheme *sc)
 static s7_int oprec_i_cond_a_a_a_laa_lopa_laaq(s7_scheme *sc)
 {
   s7_int i1, i2;
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_test_o->v[0].fb(sc->rec_test_o)) return(sc->rec_result_o->v[0].fi(sc->rec_result_o));
   if (sc->rec_a1_o->v[0].fb(sc->rec_a1_o))
     {
@@ -87262,6 +89325,7 @@ static s7_int oprec_i_cond_a_a_a_laa_lopa_laaq(s7_scheme *sc)
 static s7_int oprec_i_cond_a_a_a_laa_lopa_laaq_0(s7_scheme *sc)
 {
   s7_int i1, i2;
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_fb1(sc->rec_test_o)) return(sc->rec_fi1(sc->rec_result_o));
   if (sc->rec_fb2(sc->rec_a1_o))
     {
@@ -87281,6 +89345,7 @@ static s7_int oprec_i_cond_a_a_a_laa_lopa_laaq_0(s7_scheme *sc)
 
 static s7_pointer oprec_cond_a_a_a_laa_lopa_laaq(s7_scheme *sc)
 {
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) != sc->F) return(sc->rec_resf(sc, sc->rec_resp));
   if (sc->rec_f1f(sc, sc->rec_f1p) != sc->F)
     {
@@ -87329,6 +89394,7 @@ static void opinit_and_a_or_a_laa_laa(s7_scheme *sc, s7_pointer code)
 static s7_pointer oprec_and_a_or_a_laa_laa(s7_scheme *sc)
 {
   s7_pointer p;
+  step_tick(sc); /* [c4augustus] */
   if (sc->rec_testf(sc, sc->rec_testp) == sc->F) return(sc->F);
   p = sc->rec_resf(sc, sc->rec_resp);
   if (p != sc->F) return(p);
@@ -89189,13 +91255,21 @@ static bool pop_read_list(s7_scheme *sc)
 
 static bool op_load_return_if_eof(s7_scheme *sc)
 {
+  bool recording = (is_pair(sc->load_record)) && (car(sc->load_record) == current_input_port(sc)); /* [c4augustus] */
   if (sc->tok != TOKEN_EOF)
     {
+      if (recording) /* [c4augustus] see s7_load_c_string_record */
+	{
+	  s7_pointer port = current_input_port(sc);
+	  set_cdr(sc->load_record, cons(sc, sc->value, cdr(sc->load_record)));
+	  set_car(cdr(sc->load_record), cons(sc, sc->value, cons(sc, make_integer(sc, port_line_number(port)), make_integer_unchecked(sc, port_position(port)))));
+	}
       push_stack_op_let(sc, OP_LOAD_RETURN_IF_EOF);
       push_stack_op_let(sc, OP_READ_INTERNAL);
       sc->code = sc->value;
       return(true);             /* we read an expression, now evaluate it, and return to read the next */
     }
+  if (recording) set_car(sc->load_record, sc->T); /* [c4augustus] the load reached the end */
   sc->current_file = NULL;
   return(false);
 }
@@ -90187,7 +92261,7 @@ static bool c_function_is_ok_cadr_caddadr(s7_scheme *sc, s7_pointer p)
 
 static /* inline */ bool closure_is_ok_1(s7_scheme *sc, s7_pointer code, uint16_t type, int32_t args)
 {
-  s7_pointer f = lookup_unexamined(sc, car(code));
+  s7_pointer f = lookup_call_head(sc, car(code));
   if ((f == opt1_lambda_unchecked(code)) ||
       ((f) && /* this fixup check does save time (e.g. cb) */
        (typesflag(f) == type) &&
@@ -90200,7 +92274,7 @@ static /* inline */ bool closure_is_ok_1(s7_scheme *sc, s7_pointer code, uint16_
 
 static /* inline */ bool closure_is_fine_1(s7_scheme *sc, s7_pointer code, uint16_t type, int32_t args)
 {
-  s7_pointer f = lookup_unexamined(sc, car(code));
+  s7_pointer f = lookup_call_head(sc, car(code));
   if ((f == opt1_lambda_unchecked(code)) ||
       ((f) &&
        ((typesflag(f) & (TYPE_MASK | T_SAFE_CLOSURE)) == type) &&
@@ -90213,7 +92287,7 @@ static /* inline */ bool closure_is_fine_1(s7_scheme *sc, s7_pointer code, uint1
 
 static bool closure_np_is_ok_1(s7_scheme *sc, s7_pointer code)
 {
-  s7_pointer f = lookup_unexamined(sc, car(code));
+  s7_pointer f = lookup_call_head(sc, car(code));
   if ((f == opt1_lambda_unchecked(code)) ||
       ((f) &&
        (is_closure(f)) &&
@@ -90230,7 +92304,7 @@ static bool closure_np_is_ok_1(s7_scheme *sc, s7_pointer code)
 
 static /* inline */ bool closure_is_eq(s7_scheme *sc)
 {
-  sc->last_function = lookup_unexamined(sc, car(sc->code));
+  sc->last_function = lookup_call_head(sc, car(sc->code));
   return(sc->last_function == opt1_lambda_unchecked(sc->code));
 }
 
@@ -90242,7 +92316,7 @@ static bool star_arity_is_ok(s7_scheme *sc, s7_pointer val, int32_t args)
 
 static bool closure_star_is_fine_1(s7_scheme *sc, s7_pointer code, uint16_t type, int32_t args)
 {
-  s7_pointer val = lookup_unexamined(sc, car(code));
+  s7_pointer val = lookup_call_head(sc, car(code));
   if ((val == opt1_lambda_unchecked(code)) ||
       ((val) &&
        ((typesflag(val) & (T_SAFE_CLOSURE | TYPE_MASK)) == type) &&
@@ -90292,6 +92366,7 @@ static s7_pointer eval(s7_scheme *sc, opcode_t first_op)
 
     EVAL:
       sc->cur_op = optimize_op(sc->code); /* sc->code can be anything, optimize_op examines a type field (opt_choice) */
+      step_tick(sc); /* [c4augustus] */
 
     TOP_NO_POP:
       if (SHOW_EVAL_OPS) safe_print(fprintf(stderr, "%s (%d), code: %s\n", op_names[sc->cur_op], (int)(sc->cur_op), display_80(sc->code)));
@@ -92075,6 +94150,832 @@ static s7_pointer eval(s7_scheme *sc, opcode_t first_op)
 }
 
 
+/* -------------------------------- images -------------------------------- */
+/* [c4augustus] a compact binary image of an object graph, so a session can skip re-reading and re-evaluating
+ *   code it has already seen.  The heap itself cannot be dumped: cells hold raw pointers, optimizer state and
+ *   c-function addresses, so the image records structure instead and decoding rebuilds it.  Shared and cyclic
+ *   structure is kept via back-references, closures are saved as their kind, name, environment, args and body
+ *   and re-made from those (then optimized afresh), c-functions, c-macros and syntax are saved by name.
+ *   C objects, c-pointers, ports, iterators, continuations, weak or typed hash-tables, typed or multidimensional
+ *   vectors and the special lets can't be imaged, s7_image_write returns #f for a graph holding any of them.
+ *   The header carries the s7 version and date, so an image from another build is refused, not misread,
+ *   and a checksum of the rest, so a damaged one is refused before anything is decoded.
+ */
+
+#define IMAGE_MAGIC "s7im"
+#define IMAGE_FORMAT 3
+#define IMAGE_BUILD_ID "s7 " S7_VERSION " " S7_DATE
+
+enum {IMAGE_NIL, IMAGE_TRUE, IMAGE_FALSE, IMAGE_UNSPECIFIED, IMAGE_UNDEFINED, IMAGE_EOF, IMAGE_ROOTLET,
+      IMAGE_INTEGER, IMAGE_RATIO, IMAGE_REAL, IMAGE_COMPLEX, IMAGE_CHARACTER, IMAGE_C_FUNCTION,
+      IMAGE_STRING, IMAGE_SYMBOL, IMAGE_PAIR, IMAGE_VECTOR, IMAGE_INT_VECTOR, IMAGE_FLOAT_VECTOR, IMAGE_BYTE_VECTOR,
+      IMAGE_HASH_TABLE, IMAGE_LET, IMAGE_CLOSURE, IMAGE_REF};
+
+#define IMAGE_IMMUTABLE 1
+#define IMAGE_OPENLET 2
+
+typedef struct {
+  uint8_t *data;
+  s7_int top, size;
+  s7_pointer *seen;                /* open-addressed, seen[i] was given id ids[i] */
+  s7_int *ids, seen_mask, seen_count;
+  bool failed;
+} image_writer_t;
+
+static void image_put_bytes(image_writer_t *w, const void *bytes, s7_int len)
+{
+  if (w->top + len > w->size)
+    {
+      while (w->top + len > w->size) w->size *= 2;
+      w->data = (uint8_t *)Realloc(w->data, w->size);
+    }
+  memcpy((void *)(w->data + w->top), bytes, len);
+  w->top += len;
+}
+
+static void image_put_byte(image_writer_t *w, uint8_t b) {image_put_bytes(w, &b, 1);}
+
+static void image_put_uint(image_writer_t *w, uint64_t n)
+{
+  uint8_t buf[10];
+  int32_t len = 0;
+  for (; n >= 0x80; n >>= 7) buf[len++] = (uint8_t)(n | 0x80);
+  buf[len++] = (uint8_t)n;
+  image_put_bytes(w, buf, len);
+}
+
+static void image_put_int(image_writer_t *w, s7_int n) {image_put_uint(w, ((uint64_t)n << 1) ^ (uint64_t)(n >> 63));} /* zigzag */
+static void image_put_double(image_writer_t *w, s7_double x) {image_put_bytes(w, &x, sizeof(s7_double));}
+
+static void image_put_chars(image_writer_t *w, const char *str, s7_int len)
+{
+  image_put_uint(w, len);
+  image_put_bytes(w, str, len);
+}
+
+static uint64_t image_checksum(const uint8_t *data, s7_int len)  /* FNV-1a a word at a time, it's on the load path */
+{
+  uint64_t h = 0xcbf29ce484222325ULL, word;
+  s7_int i = 0;
+  for (; i + 8 <= len; i += 8)
+    {
+      memcpy((void *)&word, (const void *)(data + i), 8);
+      h = (h ^ word) * 0x100000001b3ULL;
+      h ^= h >> 29;
+    }
+  for (; i < len; i++) h = (h ^ data[i]) * 0x100000001b3ULL;
+  return(h);
+}
+
+static s7_int image_seen_slot(image_writer_t *w, s7_pointer p)
+{
+  s7_int loc = (s7_int)((((uintptr_t)p >> 4) * 0x9E3779B97F4A7C15ULL) >> 20) & w->seen_mask;
+  while ((w->seen[loc]) && (w->seen[loc] != p)) loc = (loc + 1) & w->seen_mask;
+  return(loc);
+}
+
+static s7_int image_seen_id(image_writer_t *w, s7_pointer p)
+{
+  s7_int loc = image_seen_slot(w, p);
+  return((w->seen[loc]) ? w->ids[loc] : -1);
+}
+
+static void image_add_seen(image_writer_t *w, s7_pointer p)
+{
+  s7_int loc;
+  if (2 * (w->seen_count + 1) > w->seen_mask)
+    {
+      s7_pointer *old_seen = w->seen;
+      s7_int *old_ids = w->ids, old_size = w->seen_mask + 1;
+      w->seen_mask = 2 * old_size - 1;
+      w->seen = (s7_pointer *)Calloc(2 * old_size, sizeof(s7_pointer));
+      w->ids = (s7_int *)Malloc(2 * old_size * sizeof(s7_int));
+      for (s7_int i = 0; i < old_size; i++)
+	if (old_seen[i])
+	  {
+	    loc = image_seen_slot(w, old_seen[i]);
+	    w->seen[loc] = old_seen[i];
+	    w->ids[loc] = old_ids[i];
+	  }
+      free(old_seen);
+      free(old_ids);
+    }
+  loc = image_seen_slot(w, p);
+  w->seen[loc] = p;
+  w->ids[loc] = w->seen_count++;  /* ids are handed out in the order the reader will meet the objects */
+}
+
+static void image_write_object(s7_scheme *sc, image_writer_t *w, s7_pointer p);
+
+static void image_write_let_ref(s7_scheme *sc, image_writer_t *w, s7_pointer e)
+{
+  if ((e == sc->nil) || (e == sc->rootlet))  /* the outlet of a top-level let is nil */
+    image_put_byte(w, IMAGE_ROOTLET);
+  else image_write_object(sc, w, e);
+}
+
+static void image_write_let(s7_scheme *sc, image_writer_t *w, s7_pointer e)
+{
+  s7_int len = 0;
+  s7_pointer *slots;
+  if ((e == sc->s7_starlet) || (e == sc->shadow_rootlet))
+    {
+      w->failed = true;
+      return;
+    }
+  image_put_byte(w, IMAGE_LET);
+  image_put_byte(w, (is_immutable(e) ? IMAGE_IMMUTABLE : 0) | (is_openlet(e) ? IMAGE_OPENLET : 0));
+  image_write_let_ref(sc, w, let_outlet(e));
+  for (s7_pointer slot = let_slots(e); tis_slot(slot); slot = next_slot(slot)) len++;
+  image_put_uint(w, len);
+  slots = (s7_pointer *)Malloc((len + 1) * sizeof(s7_pointer));
+  len = 0;
+  for (s7_pointer slot = let_slots(e); tis_slot(slot); slot = next_slot(slot)) slots[len++] = slot;
+  while ((len > 0) && (!w->failed))                /* oldest first, so re-adding each at the front restores the order */
+    {
+      s7_pointer slot = slots[--len];
+      image_write_object(sc, w, slot_symbol(slot));
+      image_put_byte(w, (is_immutable_slot(slot)) ? IMAGE_IMMUTABLE : 0);
+      image_write_object(sc, w, slot_value(slot));
+    }
+  free(slots);
+}
+
+static void image_write_closure(s7_scheme *sc, image_writer_t *w, s7_pointer p)
+{
+  s7_pointer e = closure_let(p), name = sc->F;
+  if ((is_let(e)) && (e != sc->rootlet) && (is_funclet(e)))
+    {
+      name = funclet_function(e);  /* the funclet is remade for the new closure, its slots are only the args */
+      e = let_outlet(e);
+    }
+  image_put_byte(w, IMAGE_CLOSURE);
+  image_put_byte(w, (uint8_t)type(p));
+  image_write_object(sc, w, name);
+  image_write_let_ref(sc, w, e);
+  image_write_object(sc, w, closure_args(p));
+  image_write_object(sc, w, closure_body(p));
+  image_write_object(sc, w, closure_setter(p));
+}
+
+static void image_write_hash_table(s7_scheme *sc, image_writer_t *w, s7_pointer p)
+{
+  const char *checker = hash_table_checker_name(sc, p);
+  hash_entry_t *els = hash_table_elements(p);
+  if ((is_weak_hash_table(p)) || (is_typed_hash_table(p)) || (is_pair(hash_table_procedures(p))))
+    {
+      w->failed = true;
+      return;
+    }
+  image_put_byte(w, IMAGE_HASH_TABLE);
+  image_put_byte(w, (is_immutable(p)) ? IMAGE_IMMUTABLE : 0);
+  if (checker[0] == '$') checker = "";             /* not chosen yet */
+  image_put_chars(w, checker, safe_strlen(checker));
+  image_put_uint(w, hash_table_mask(p) + 1);
+  image_put_uint(w, hash_table_entries(p));
+  for (s7_int i = 0; (i <= hash_table_mask(p)) && (!w->failed); i++)
+    if (hash_entry_is_live(&els[i]))
+      {
+	image_write_object(sc, w, hash_entry_key(&els[i]));
+	image_write_object(sc, w, hash_entry_value(&els[i]));
+      }
+}
+
+static void image_write_object(s7_scheme *sc, image_writer_t *w, s7_pointer p)
+{
+  s7_int id;
+  if (w->failed) return;
+  if (p == sc->nil) {image_put_byte(w, IMAGE_NIL); return;}
+  if (p == sc->T) {image_put_byte(w, IMAGE_TRUE); return;}
+  if (p == sc->F) {image_put_byte(w, IMAGE_FALSE); return;}
+  if (p == sc->unspecified) {image_put_byte(w, IMAGE_UNSPECIFIED); return;}
+  if (p == sc->undefined) {image_put_byte(w, IMAGE_UNDEFINED); return;}
+  if (p == eof_object) {image_put_byte(w, IMAGE_EOF); return;}
+  if (p == sc->rootlet) {image_put_byte(w, IMAGE_ROOTLET); return;}
+  switch (type(p))
+    {
+    case T_INTEGER:
+      image_put_byte(w, IMAGE_INTEGER);
+      image_put_int(w, integer(p));
+      return;
+    case T_RATIO:
+      image_put_byte(w, IMAGE_RATIO);
+      image_put_int(w, numerator(p));
+      image_put_int(w, denominator(p));
+      return;
+    case T_REAL:
+      image_put_byte(w, IMAGE_REAL);
+      image_put_double(w, real(p));
+      return;
+    case T_COMPLEX:
+      image_put_byte(w, IMAGE_COMPLEX);
+      image_put_double(w, real_part(p));
+      image_put_double(w, imag_part(p));
+      return;
+    case T_CHARACTER:
+      image_put_byte(w, IMAGE_CHARACTER);
+      image_put_byte(w, character(p));
+      return;
+    case T_SYNTAX:
+      image_put_byte(w, IMAGE_C_FUNCTION);
+      image_put_chars(w, symbol_name(syntax_symbol(p)), symbol_name_length(syntax_symbol(p)));
+      return;
+    case T_C_MACRO:
+      image_put_byte(w, IMAGE_C_FUNCTION);
+      image_put_chars(w, c_macro_name(p), safe_strlen(c_macro_name(p)));
+      return;
+    case T_C_FUNCTION_STAR: case T_C_FUNCTION: case T_C_RST_NO_REQ_FUNCTION:
+      image_put_byte(w, IMAGE_C_FUNCTION);
+      image_put_chars(w, c_function_name(p), safe_strlen(c_function_name(p)));
+      return;
+    case T_STRING: case T_SYMBOL: case T_PAIR: case T_VECTOR: case T_INT_VECTOR: case T_FLOAT_VECTOR: case T_BYTE_VECTOR:
+    case T_HASH_TABLE: case T_LET: case T_CLOSURE: case T_CLOSURE_STAR: case T_MACRO: case T_MACRO_STAR: case T_BACRO: case T_BACRO_STAR:
+      break;
+    default:
+      w->failed = true;
+      return;
+    }
+
+  id = image_seen_id(w, p);
+  if (id >= 0)
+    {
+      image_put_byte(w, IMAGE_REF);
+      image_put_uint(w, id);
+      return;
+    }
+  image_add_seen(w, p);                            /* before the children, so a cycle back to p finds it */
+  switch (type(p))
+    {
+    case T_STRING:
+      image_put_byte(w, IMAGE_STRING);
+      image_put_byte(w, (is_immutable(p)) ? IMAGE_IMMUTABLE : 0);
+      image_put_chars(w, string_value(p), string_length(p));
+      return;
+    case T_SYMBOL:
+      image_put_byte(w, IMAGE_SYMBOL);
+      image_put_chars(w, symbol_name(p), symbol_name_length(p));
+      return;
+    case T_PAIR:                                   /* along the cdrs without recursion, so long lists don't blow the C stack */
+      image_put_byte(w, IMAGE_PAIR);
+      image_write_object(sc, w, car(p));
+      for (p = cdr(p); (is_pair(p)) && (image_seen_id(w, p) < 0) && (!w->failed); p = cdr(p))
+	{
+	  image_add_seen(w, p);
+	  image_put_byte(w, IMAGE_PAIR);
+	  image_write_object(sc, w, car(p));
+	}
+      image_write_object(sc, w, p);
+      return;
+    case T_LET:
+      image_write_let(sc, w, p);
+      return;
+    case T_HASH_TABLE:
+      image_write_hash_table(sc, w, p);
+      return;
+    case T_CLOSURE: case T_CLOSURE_STAR: case T_MACRO: case T_MACRO_STAR: case T_BACRO: case T_BACRO_STAR:
+      image_write_closure(sc, w, p);
+      return;
+    default:                                       /* the vectors */
+      {
+	s7_int len = vector_length(p);
+	if ((vector_rank(p) > 1) || (is_subvector(p)) || ((is_normal_vector(p)) && (is_typed_vector(p))))
+	  {
+	    w->failed = true;
+	    return;
+	  }
+	image_put_byte(w, (is_normal_vector(p)) ? IMAGE_VECTOR : ((is_int_vector(p)) ? IMAGE_INT_VECTOR :
+			  ((is_float_vector(p)) ? IMAGE_FLOAT_VECTOR : IMAGE_BYTE_VECTOR)));
+	image_put_byte(w, (is_immutable(p)) ? IMAGE_IMMUTABLE : 0);
+	image_put_uint(w, len);
+	if (is_normal_vector(p))
+	  for (s7_int i = 0; i < len; i++) image_write_object(sc, w, vector_element(p, i));
+	else
+	  if (is_int_vector(p))
+	    for (s7_int i = 0; i < len; i++) image_put_int(w, int_vector(p, i));
+	  else
+	    if (is_float_vector(p))
+	      image_put_bytes(w, float_vector_floats(p), len * sizeof(s7_double));
+	    else image_put_bytes(w, byte_vector_bytes(p), len);
+      }}
+}
+
+s7_pointer s7_image_write(s7_scheme *sc, s7_pointer obj)
+{
+  image_writer_t w;
+  s7_pointer result;
+  uint16_t order = 1;
+  uint64_t sum = 0;
+  s7_int sum_at;
+  memset((void *)&w, 0, sizeof(image_writer_t));
+  w.size = 1024;
+  w.data = (uint8_t *)Malloc(w.size);
+  w.seen_mask = 255;
+  w.seen = (s7_pointer *)Calloc(w.seen_mask + 1, sizeof(s7_pointer));
+  w.ids = (s7_int *)Malloc((w.seen_mask + 1) * sizeof(s7_int));
+
+  image_put_bytes(&w, IMAGE_MAGIC, 4);
+  image_put_byte(&w, IMAGE_FORMAT);
+  image_put_bytes(&w, &order, sizeof(uint16_t));   /* refuses images from a host of the other byte order */
+  image_put_byte(&w, sizeof(s7_int));
+  image_put_chars(&w, IMAGE_BUILD_ID, safe_strlen(IMAGE_BUILD_ID));
+  sum_at = w.top;
+  image_put_bytes(&w, &sum, sizeof(uint64_t));
+  image_write_object(sc, &w, obj);
+
+  if (w.failed)
+    result = sc->F;
+  else
+    {
+      sum = image_checksum(w.data + sum_at + sizeof(uint64_t), w.top - sum_at - sizeof(uint64_t));
+      memcpy((void *)(w.data + sum_at), (void *)&sum, sizeof(uint64_t));
+      result = make_simple_byte_vector(sc, w.top);
+      memcpy((void *)byte_vector_bytes(result), (void *)w.data, w.top);
+    }
+  free(w.data);
+  free(w.seen);
+  free(w.ids);
+  return(result);
+}
+
+typedef struct {
+  s7_pointer obj, key;             /* key: the hash-table key, or the vector index as an integer */
+  s7_int id;
+  uint8_t kind;
+} image_patch_t;
+
+enum {IMAGE_PATCH_CAR, IMAGE_PATCH_CDR, IMAGE_PATCH_ELEMENT, IMAGE_PATCH_SLOT, IMAGE_PATCH_HASH};
+
+typedef struct {
+  const uint8_t *cur, *end;
+  s7_pointer *objs;                /* by id, NULL while a closure is still being made */
+  s7_int objs_top, objs_size;
+  image_patch_t *patches;          /* references to such a closure, filled in once it exists */
+  s7_int patches_top, patches_size, pending;
+  bool failed;
+} image_reader_t;
+
+static bool image_get_bytes(image_reader_t *r, void *bytes, s7_int len)
+{
+  if ((len < 0) || (len > r->end - r->cur))
+    {
+      r->failed = true;
+      return(false);
+    }
+  memcpy(bytes, (const void *)r->cur, len);
+  r->cur += len;
+  return(true);
+}
+
+static inline uint8_t image_get_byte(image_reader_t *r)
+{
+  if (r->cur >= r->end)
+    {
+      r->failed = true;
+      return(0);
+    }
+  return(*(r->cur++));
+}
+
+static inline uint64_t image_get_uint(image_reader_t *r)
+{
+  uint64_t n = 0;
+  if ((r->cur < r->end) && (*(r->cur) < 0x80))   /* ids and lengths are mostly one byte */
+    return(*(r->cur++));
+  for (int32_t shift = 0; shift < 64; shift += 7)
+    {
+      uint8_t b = image_get_byte(r);
+      n |= (uint64_t)(b & 0x7f) << shift;
+      if (!(b & 0x80)) return(n);
+    }
+  r->failed = true;
+  return(0);
+}
+
+static s7_int image_get_int(image_reader_t *r)
+{
+  uint64_t n = image_get_uint(r);
+  return((s7_int)(n >> 1) ^ -(s7_int)(n & 1));
+}
+
+static s7_int image_get_length(image_reader_t *r)  /* a count of bytes or more still to come, so a damaged one can't ask for a huge allocation */
+{
+  uint64_t n = image_get_uint(r);
+  if (n > (uint64_t)(r->end - r->cur))
+    {
+      r->failed = true;
+      return(0);
+    }
+  return((s7_int)n);
+}
+
+static inline s7_int image_add_object(image_reader_t *r, s7_pointer p)
+{
+  if (r->objs_top == r->objs_size)
+    {
+      r->objs_size *= 2;
+      r->objs = (s7_pointer *)Realloc(r->objs, r->objs_size * sizeof(s7_pointer));
+    }
+  r->objs[r->objs_top] = p;
+  return(r->objs_top++);
+}
+
+static void image_defer(image_reader_t *r, uint8_t kind, s7_pointer obj, s7_pointer key)
+{
+  if (r->patches_top == r->patches_size)
+    {
+      r->patches_size *= 2;
+      r->patches = (image_patch_t *)Realloc(r->patches, r->patches_size * sizeof(image_patch_t));
+    }
+  r->patches[r->patches_top].obj = obj;
+  r->patches[r->patches_top].key = key;
+  r->patches[r->patches_top].id = r->pending;
+  r->patches[r->patches_top++].kind = kind;
+}
+
+static s7_pointer image_read_object(s7_scheme *sc, image_reader_t *r);
+
+static s7_pointer image_read_let_ref(s7_scheme *sc, image_reader_t *r)
+{
+  s7_pointer e = image_read_object(sc, r);
+  if (e == sc->rootlet) return(sc->nil);
+  if ((!r->failed) && (!is_let(e))) r->failed = true;
+  return(e);
+}
+
+static s7_pointer image_read_let(s7_scheme *sc, image_reader_t *r)
+{
+  uint8_t flags = image_get_byte(r);
+  s7_pointer e = make_let(sc, sc->nil), outlet;    /* made before the outlet is read, so a slot out there can refer back to it */
+  s7_int len;
+  image_add_object(r, e);
+  outlet = image_read_let_ref(sc, r);
+  if (r->failed) return(NULL);
+  let_set_outlet(e, outlet);
+  let_set_id(e, ++sc->let_number);                 /* inner lets are newer than their outlets */
+  len = image_get_length(r);
+  for (s7_int i = 0; (i < len) && (!r->failed); i++)
+    {
+      s7_pointer sym = image_read_object(sc, r), slot, val;
+      uint8_t slot_flags = image_get_byte(r);
+      if ((r->failed) || (!is_symbol(sym))) {r->failed = true; return(NULL);}
+      val = image_read_object(sc, r);
+      if (r->failed) return(NULL);
+      slot = add_slot_checked_with_id(sc, e, sym, val);
+      if (slot_flags & IMAGE_IMMUTABLE) set_immutable_slot(slot);
+      if (val == sc->unused) image_defer(r, IMAGE_PATCH_SLOT, slot, NULL);
+    }
+  if (flags & IMAGE_IMMUTABLE) set_immutable(e);
+  if (flags & IMAGE_OPENLET) set_has_methods(e);
+  return(e);
+}
+
+static s7_pointer image_read_closure(s7_scheme *sc, image_reader_t *r)
+{
+  uint8_t kind = image_get_byte(r);
+  s7_int id = image_add_object(r, NULL);
+  s7_pointer name, e, args, body, setter, func, old_curlet;
+
+  name = image_read_object(sc, r);
+  e = image_read_let_ref(sc, r);
+  args = image_read_object(sc, r);
+  body = image_read_object(sc, r);
+  setter = image_read_object(sc, r);
+  if ((r->failed) ||
+      ((kind != T_CLOSURE) && (kind != T_CLOSURE_STAR) && (kind != T_MACRO) && (kind != T_MACRO_STAR) && (kind != T_BACRO) && (kind != T_BACRO_STAR)) ||
+      ((name != sc->F) && (!is_symbol(name))) || (!is_pair(body)) || (args == sc->unused) ||
+      ((setter != sc->F) && (!is_any_procedure(setter))))
+    {
+      r->failed = true;
+      return(NULL);
+    }
+  /* remade as define would: check and optimize the lambda form in e, then give a named one its funclet */
+  old_curlet = sc->curlet;
+  sc->curlet = e;                                  /* nil for the rootlet */
+  if (kind == T_CLOSURE)
+    {
+      int32_t arity = check_lambda(sc, cons(sc, sc->lambda_proc_symbol, cons(sc, args, body)), true);
+      func = make_closure(sc, args, body, T_CLOSURE | ((arity < 0) ? T_COPY_ARGS : 0), arity);
+    }
+  else func = s7_eval(sc, cons(sc, procedure_type_to_symbol(sc, kind), cons(sc, args, body)), e);
+  if (type(func) != kind)
+    {
+      sc->curlet = old_curlet;
+      r->failed = true;
+      return(NULL);
+    }
+  if (is_symbol(name))
+    {
+      if (is_safe_closure_body(closure_body(func)))
+	{
+	  set_safe_closure(func);
+	  if (is_very_safe_closure_body(closure_body(func)))
+	    set_very_safe_closure(func);
+	}
+      make_funclet(sc, func, name, closure_let(func));
+    }
+  sc->curlet = old_curlet;
+  if (setter != sc->F) closure_set_setter(func, setter);
+  r->objs[id] = func;
+  return(func);
+}
+
+static s7_pointer image_read_hash_table(s7_scheme *sc, image_reader_t *r)
+{
+  uint8_t flags = image_get_byte(r);
+  s7_int len = image_get_length(r), size, entries;
+  char checker[64];
+  s7_pointer table;
+  if ((r->failed) || (len >= (s7_int)sizeof(checker)) || (!image_get_bytes(r, checker, len))) {r->failed = true; return(NULL);}
+  checker[len] = '\0';
+  size = image_get_uint(r);
+  entries = image_get_length(r);
+  if ((r->failed) || (size <= 0) || (size > sc->max_vector_length)) {r->failed = true; return(NULL);}
+  if (len == 0)
+    table = s7_make_hash_table(sc, size);
+  else
+    {
+      s7_pointer func = s7_name_to_value(sc, checker);
+      if (!is_any_procedure(func)) {r->failed = true; return(NULL);}
+      table = g_make_hash_table(sc, list_2(sc, make_integer(sc, size), func));
+    }
+  image_add_object(r, table);
+  for (s7_int i = 0; (i < entries) && (!r->failed); i++)
+    {
+      s7_pointer key = image_read_object(sc, r), val;
+      if (key == sc->unused) r->failed = true;
+      val = image_read_object(sc, r);
+      if (r->failed) return(NULL);
+      s7_hash_table_set(sc, table, key, val);
+      if (val == sc->unused) image_defer(r, IMAGE_PATCH_HASH, table, key);
+    }
+  if (flags & IMAGE_IMMUTABLE) set_immutable(table);
+  return(table);
+}
+
+static s7_pointer image_read_vector(s7_scheme *sc, image_reader_t *r, uint8_t tag)
+{
+  uint8_t flags = image_get_byte(r);
+  s7_int len = image_get_length(r);
+  s7_pointer vec;
+  if (r->failed) return(NULL);
+  switch (tag)
+    {
+    case IMAGE_VECTOR:
+      vec = make_simple_vector(sc, len);
+      normal_vector_fill(vec, sc->nil);
+      image_add_object(r, vec);
+      for (s7_int i = 0; (i < len) && (!r->failed); i++)
+	{
+	  s7_pointer val = image_read_object(sc, r);
+	  if (r->failed) return(NULL);
+	  vector_element(vec, i) = val;
+	  if (val == sc->unused) image_defer(r, IMAGE_PATCH_ELEMENT, vec, make_integer(sc, i));
+	}
+      break;
+    case IMAGE_INT_VECTOR:
+      vec = make_simple_int_vector(sc, len);
+      image_add_object(r, vec);
+      for (s7_int i = 0; i < len; i++) int_vector(vec, i) = image_get_int(r);
+      break;
+    case IMAGE_FLOAT_VECTOR:
+      if (len > (r->end - r->cur) / (s7_int)sizeof(s7_double)) {r->failed = true; return(NULL);}
+      vec = make_simple_float_vector(sc, len);
+      image_add_object(r, vec);
+      image_get_bytes(r, float_vector_floats(vec), len * sizeof(s7_double));
+      break;
+    default:
+      vec = make_simple_byte_vector(sc, len);
+      image_add_object(r, vec);
+      image_get_bytes(r, byte_vector_bytes(vec), len);
+      break;
+    }
+  if (flags & IMAGE_IMMUTABLE) set_immutable(vec);
+  return(vec);
+}
+
+static s7_pointer image_read_object(s7_scheme *sc, image_reader_t *r)
+{
+  uint8_t tag = image_get_byte(r);
+  if (r->failed) return(NULL);
+  switch (tag)
+    {
+    case IMAGE_NIL:         return(sc->nil);
+    case IMAGE_TRUE:        return(sc->T);
+    case IMAGE_FALSE:       return(sc->F);
+    case IMAGE_UNSPECIFIED: return(sc->unspecified);
+    case IMAGE_UNDEFINED:   return(sc->undefined);
+    case IMAGE_EOF:         return(eof_object);
+    case IMAGE_ROOTLET:     return(sc->rootlet);
+    case IMAGE_INTEGER:     return(make_integer(sc, image_get_int(r)));
+    case IMAGE_CHARACTER:   return(chars[image_get_byte(r)]);
+
+    case IMAGE_RATIO:
+      {
+	s7_int num = image_get_int(r), den = image_get_int(r);
+	if ((r->failed) || (den <= 1)) {r->failed = true; return(NULL);}
+	return(make_simple_ratio(sc, num, den));
+      }
+    case IMAGE_REAL:
+      {
+	s7_double x = 0.0;
+	image_get_bytes(r, &x, sizeof(s7_double));
+	return(make_real(sc, x));
+      }
+    case IMAGE_COMPLEX:
+      {
+	s7_double rl = 0.0, im = 0.0;
+	image_get_bytes(r, &rl, sizeof(s7_double));
+	image_get_bytes(r, &im, sizeof(s7_double));
+	return(s7_make_complex(sc, rl, im));
+      }
+    case IMAGE_C_FUNCTION:
+      {
+	s7_int len = image_get_length(r);
+	s7_pointer sym, func;
+	if (r->failed) return(NULL);
+	sym = make_symbol(sc, (const char *)(r->cur), len);
+	r->cur += len;
+	func = (is_slot(global_slot(sym))) ? global_value(sym) : sc->undefined;
+	if ((!is_c_function(func)) && (!is_c_macro(func)) && (!is_syntax(func))) {r->failed = true; return(NULL);}
+	return(func);
+      }
+    case IMAGE_STRING:
+      {
+	uint8_t flags = image_get_byte(r);
+	s7_int len = image_get_length(r);
+	s7_pointer str;
+	if (r->failed) return(NULL);
+	str = make_string_with_length(sc, (const char *)(r->cur), len);
+	r->cur += len;
+	if (flags & IMAGE_IMMUTABLE) set_immutable(str);
+	image_add_object(r, str);
+	return(str);
+      }
+    case IMAGE_SYMBOL:
+      {
+	s7_int len = image_get_length(r);
+	s7_pointer sym;
+	if ((r->failed) || (len == 0)) {r->failed = true; return(NULL);}
+	sym = make_symbol(sc, (const char *)(r->cur), len);
+	r->cur += len;
+	image_add_object(r, sym);
+	return(sym);
+      }
+    case IMAGE_PAIR:
+      {
+	s7_pointer first = cons(sc, sc->nil, sc->nil), p = first, val;
+	image_add_object(r, p);
+	while (true)
+	  {
+	    val = image_read_object(sc, r);
+	    if (r->failed) return(NULL);
+	    set_car(p, val);
+	    if (val == sc->unused) image_defer(r, IMAGE_PATCH_CAR, p, NULL);
+	    if ((r->cur < r->end) && (*(r->cur) == IMAGE_PAIR))
+	      {
+		s7_pointer next = cons(sc, sc->nil, sc->nil);
+		r->cur++;
+		image_add_object(r, next);
+		set_cdr(p, next);
+		p = next;
+	      }
+	    else break;
+	  }
+	val = image_read_object(sc, r);
+	if (r->failed) return(NULL);
+	set_cdr(p, val);
+	if (val == sc->unused) image_defer(r, IMAGE_PATCH_CDR, p, NULL);
+	return(first);
+      }
+    case IMAGE_VECTOR: case IMAGE_INT_VECTOR: case IMAGE_FLOAT_VECTOR: case IMAGE_BYTE_VECTOR:
+      return(image_read_vector(sc, r, tag));
+    case IMAGE_HASH_TABLE: return(image_read_hash_table(sc, r));
+    case IMAGE_LET:        return(image_read_let(sc, r));
+    case IMAGE_CLOSURE:    return(image_read_closure(sc, r));
+
+    case IMAGE_REF:
+      {
+	uint64_t id = image_get_uint(r);
+	if ((r->failed) || (id >= (uint64_t)r->objs_top)) {r->failed = true; return(NULL);}
+	if (r->objs[id]) return(r->objs[id]);
+	r->pending = (s7_int)id;                   /* a closure we are inside of, the caller defers the store */
+	return(sc->unused);
+      }
+    default:
+      r->failed = true;
+      return(NULL);
+    }
+}
+
+s7_pointer s7_image_read(s7_scheme *sc, const uint8_t *image, s7_int size)
+{
+  image_reader_t r;
+  s7_pointer result = NULL;
+  char build_id[64];
+  uint16_t order = 0;
+  uint64_t sum = 0;
+  s7_int len;
+  bool old_gc_off = sc->gc_off;
+  s7_pointer old_curlet = sc->curlet;
+
+  if ((!image) || (size < 8) || (memcmp((const void *)image, IMAGE_MAGIC, 4) != 0)) return(NULL);
+  memset((void *)&r, 0, sizeof(image_reader_t));
+  r.cur = image + 4;
+  r.end = image + size;
+  if ((image_get_byte(&r) != IMAGE_FORMAT) ||
+      (!image_get_bytes(&r, &order, sizeof(uint16_t))) || (order != 1) ||
+      (image_get_byte(&r) != sizeof(s7_int)))
+    return(NULL);
+  len = image_get_length(&r);
+  if ((r.failed) || (len != safe_strlen(IMAGE_BUILD_ID)) || (!image_get_bytes(&r, build_id, len)) ||
+      (memcmp((const void *)build_id, IMAGE_BUILD_ID, len) != 0) ||
+      (!image_get_bytes(&r, &sum, sizeof(uint64_t))) || (sum != image_checksum(r.cur, r.end - r.cur)))
+    return(NULL);
+
+  r.objs_size = 256;
+  r.objs = (s7_pointer *)Malloc(r.objs_size * sizeof(s7_pointer));
+  r.patches_size = 16;
+  r.patches = (image_patch_t *)Malloc(r.patches_size * sizeof(image_patch_t));
+  sc->gc_off = true;                               /* nothing decoded is reachable from a root until we return it */
+  result = image_read_object(sc, &r);
+  if ((r.failed) || (r.cur != r.end) || (result == sc->unused))
+    result = NULL;
+  else
+    for (s7_int i = 0; i < r.patches_top; i++)
+      {
+	image_patch_t *p = &r.patches[i];
+	s7_pointer val = r.objs[p->id];
+	if (!val) {result = NULL; break;}
+	switch (p->kind)
+	  {
+	  case IMAGE_PATCH_CAR:     set_car(p->obj, val); break;
+	  case IMAGE_PATCH_CDR:     set_cdr(p->obj, val); break;
+	  case IMAGE_PATCH_ELEMENT: vector_element(p->obj, integer(p->key)) = val; break;
+	  case IMAGE_PATCH_SLOT:    slot_set_value(p->obj, val); break;
+	  default:                  s7_hash_table_set(sc, p->obj, p->key, val); break;
+	  }}
+  sc->gc_off = old_gc_off;
+  sc->curlet = old_curlet;
+  free(r.objs);
+  free(r.patches);
+  return(result);
+}
+
+s7_pointer s7_rootlet_values(s7_scheme *sc)
+{
+  s7_pointer values = make_simple_vector(sc, sc->rootlet_entries);
+  for (s7_int i = 0; i < sc->rootlet_entries; i++)
+    vector_element(values, i) = slot_value(rootlet_element(sc->rootlet, i));
+  return(values);
+}
+
+s7_pointer s7_rootlet_image(s7_scheme *sc, s7_pointer before, s7_pointer effects)
+{
+  /* the rootlet as it now stands differs from before in the slots added since and the older ones given new values,
+   *   the image holds those bindings and effects, which stands for whatever the caller keeps outside the heap.
+   *   Nothing is replayed: a form that changed state only left its result behind in some binding.
+   */
+  s7_pointer bindings = sc->nil, result;
+  s7_int old_entries = (is_normal_vector(before)) ? vector_length(before) : 0;
+  bool old_gc_off = sc->gc_off;
+  sc->gc_off = true;
+  for (s7_int i = 0; i < sc->rootlet_entries; i++)
+    {
+      s7_pointer slot = rootlet_element(sc->rootlet, i);
+      if ((i >= old_entries) || (slot_value(slot) != vector_element(before, i)))
+	bindings = cons(sc, list_3(sc, slot_symbol(slot), slot_value(slot), make_boolean(sc, is_immutable_slot(slot))), bindings);
+    }
+  result = s7_image_write(sc, cons(sc, proper_list_reverse_in_place(sc, bindings), effects));
+  sc->gc_off = old_gc_off;
+  return(result);
+}
+
+s7_pointer s7_load_rootlet_image(s7_scheme *sc, const uint8_t *image, s7_int size)
+{
+  s7_pointer obj = s7_image_read(sc, image, size);
+  s7_int loc;
+  if ((!obj) || (!is_pair(obj)) || (!s7_is_proper_list(sc, car(obj))))
+    return(NULL);
+  for (s7_pointer p = car(obj); is_pair(p); p = cdr(p))
+    if ((!is_pair(car(p))) || (!is_symbol(caar(p))) || (!is_pair(cdar(p))) || (!is_pair(cddar(p))) ||
+	((is_slot(global_slot(caar(p)))) && (is_immutable_slot(global_slot(caar(p))))))
+      return(NULL);                                  /* checked first, so a refused image defines nothing */
+  loc = s7_gc_protect(sc, obj);
+  for (s7_pointer p = car(obj); is_pair(p); p = cdr(p))
+    {
+      s7_pointer sym = caar(p);
+      s7_define(sc, sc->nil, sym, cadar(p));
+      if (caddar(p) != sc->F)
+	{
+	  set_immutable(sym);
+	  set_possibly_constant(sym);
+	  set_immutable_slot(global_slot(sym));
+	}}
+  s7_gc_unprotect_at(sc, loc);
+  return(cdr(obj));
+}
+
+
 /* -------------------------------- s7_heap_scan -------------------------------- */
 #if S7_DEBUGGING
 static void mark_holdee(s7_pointer holder, s7_pointer holdee, const char *root)
@@ -92170,17 +95071,17 @@ static void save_holder_data(s7_scheme *sc, s7_pointer p)
       if (hash_table_entries(p) > 0)
 	{
 	  s7_int len = hash_table_mask(p) + 1;
-	  hash_entry_t **entries = hash_table_elements(p);
-	  hash_entry_t **last = (hash_entry_t **)(entries + len);
+	  hash_entry_t *xp = hash_table_elements(p);
+	  hash_entry_t *last = (hash_entry_t *)(xp + len);
 	  if ((is_weak_hash_table(p)) && (weak_hash_iters(p) == 0))
-	    while (entries < last)
+	    for (; xp < last; xp++)
 	      {
-		for (hash_entry_t *xp = *entries++; xp; xp = hash_entry_next(xp))
+		if (hash_entry_is_live(xp))
 		  mark_holdee(p, hash_entry_value(xp), NULL);
 	      }
 	  else
-	    while (entries < last)
-	      for (hash_entry_t *xp = *entries++; xp; xp = hash_entry_next(xp))
+	    for (; xp < last; xp++)
+	      if (hash_entry_is_live(xp))
 		{
 		  mark_holdee(p, hash_entry_key(xp), NULL);
 		  mark_holdee(p, hash_entry_value(xp), NULL);
@@ -92515,24 +95416,22 @@ static s7_pointer make_s7_starlet(s7_scheme *sc)  /* *s7* is semipermanent -- 20
 static void add_symbol_table(s7_scheme *sc, s7_pointer mu_let)
 {
   /* check the symbol table, counting gensyms etc */
-  s7_int syms = 0, gens = 0, keys = 0, mx_list = 0;
-  s7_pointer *els = vector_elements(sc->symbol_table);
-  for (s7_int i = 0; i < SYMBOL_TABLE_SIZE; i++)
-    {
-      s7_pointer x;
-      s7_int k = 0;
-      for (x = els[i]; is_not_null(x); x = cdr(x), k++)
-	{
-	  syms++;
-	  if (is_gensym(car(x))) gens++;
-	  if (is_keyword(car(x))) keys++;
-	}
-      if (k > mx_list) mx_list = k;
-    }
+  s7_int syms = 0, gens = 0, keys = 0, mx_probe = 0;
+  symbol_slot_t *table = sc->symbol_table;
+  for (s7_int i = 0; i <= sc->symbol_table_mask; i++)
+    if (symbol_slot_is_live(sc, &table[i]))
+      {
+	s7_pointer sym = car(table[i].entry);
+	s7_int k = (i - (s7_int)(table[i].hash >> sc->symbol_table_shift)) & sc->symbol_table_mask; /* [c4augustus] distance from its home slot */
+	syms++;
+	if (is_gensym(sym)) gens++;
+	if (is_keyword(sym)) keys++;
+	if (k > mx_probe) mx_probe = k;
+      }
   add_slot_unchecked_with_id(sc, mu_let, sc->symbol_table_symbol,
 			     s7_list(sc, 9,
-				     make_integer(sc, SYMBOL_TABLE_SIZE),
-				     make_symbol(sc, "max-bin", 7), make_integer(sc, mx_list),
+				     make_integer(sc, sc->symbol_table_mask + 1),
+				     make_symbol(sc, "max-probe", 9), make_integer(sc, mx_probe),
 				     make_symbol(sc, "symbols", 7), cons(sc, make_integer(sc, syms), make_integer(sc, syms - gens - keys)),
 				     make_symbol(sc, "gensyms", 7), make_integer(sc, gens),
 				     make_symbol(sc, "keys", 4),    make_integer(sc, keys)));
@@ -92709,8 +95608,7 @@ static s7_pointer memory_usage(s7_scheme *sc)
   for (i = 0, gp = sc->hash_tables; i < gp->loc; i++)
     {
       s7_pointer v = gp->list[i];
-      hlen += ((hash_table_mask(v) + 1) * sizeof(hash_entry_t *));
-      hlen += (hash_table_entries(v) * sizeof(hash_entry_t));
+      hlen += ((hash_table_mask(v) + 2) * sizeof(hash_entry_t));
     }
   add_slot_unchecked_with_id(sc, mu_let, make_symbol(sc, "hash-tables", 11),
 			     cons(sc, make_integer(sc, sc->hash_tables->loc), make_integer(sc, hlen)));
@@ -92785,7 +95683,7 @@ static s7_pointer memory_usage(s7_scheme *sc)
     add_slot_unchecked_with_id(sc, mu_let,
 			       make_symbol(sc, "approximate-s7-size", 19),
 			       kmg(sc, ((sc->semipermanent_cells + NUM_SMALL_INTS + sc->heap_size) * sizeof(s7_cell)) +
-				   ((2 * sc->heap_size + SYMBOL_TABLE_SIZE + sc->stack_size) * sizeof(s7_pointer)) +
+				   ((2 * sc->heap_size + sc->stack_size) * sizeof(s7_pointer)) + ((sc->symbol_table_mask + 1) * sizeof(symbol_slot_t)) +
 				   len + hlen + (vlen * sizeof(s7_pointer)) + (flen * sizeof(s7_double)) + (ilen * sizeof(s7_int)) + blen));
   }
   s7_gc_unprotect_at(sc, gc_loc);
@@ -93461,7 +96359,6 @@ static const char *decoded_name(s7_scheme *sc, const s7_pointer p)
   if (p == sc->unspecified)     return("unspecified");
   if (p == sc->no_value)        return("no_value");
   if (p == sc->unused)          return("$<unused>");
-  if (p == sc->symbol_table)    return("symbol_table");
   if (p == sc->rootlet)         return("rootlet");
   if (p == sc->s7_starlet)      return("*s7*"); /* this is the function */
   if (p == sc->unlet)           return("unlet");
@@ -93483,10 +96380,10 @@ static bool is_decodable(s7_scheme *sc, const s7_pointer p)
   s7_pointer *heap_top = (s7_pointer *)(sc->heap + sc->heap_size);
 
   /* check symbol-table */
-  for (i = 0; i < SYMBOL_TABLE_SIZE; i++)
-    for (s7_pointer x = vector_element(sc->symbol_table, i); is_not_null(x); x = cdr(x))
+  for (s7_int k = 0; k <= sc->symbol_table_mask; k++)
+    if (symbol_slot_is_live(sc, &sc->symbol_table[k]))
       {
-	s7_pointer sym = car(x);
+	s7_pointer sym = car(sc->symbol_table[k].entry);
 	if ((sym == p) ||
 	    ((is_global(sym)) && (is_slot(global_slot(sym))) && (p == global_value(sym))))
 	  return(true);
@@ -94415,8 +97312,7 @@ static void init_wrappers(s7_scheme *sc)
 static s7_pointer syntax(s7_scheme *sc, const char *name, opcode_t op, s7_pointer min_args, s7_pointer max_args, const char *doc)
 {
   uint64_t hash = raw_string_hash((const uint8_t *)name, safe_strlen(name));
-  uint32_t loc = hash % SYMBOL_TABLE_SIZE;
-  s7_pointer x = new_symbol(sc, name, safe_strlen(name), hash, loc);
+  s7_pointer x = new_symbol(sc, name, safe_strlen(name), hash);
   s7_pointer syn = alloc_pointer(sc);
 
   set_full_type(syn, T_SYNTAX | T_SYNTACTIC | T_DONT_EVAL_ARGS | T_GLOBAL | T_UNHEAP);
@@ -95154,6 +98050,7 @@ static void init_rootlet(s7_scheme *sc)
   sc->reverse_symbol =               defun("reverse",		reverse,		1, 0, false);
   sc->reverseb_symbol =              defun("reverse!",		reverse_in_place,	1, 0, false);
   sc->sort_symbol =                  unsafe_defun("sort!",      sort, 	                2, 0, false); /* not semisafe! */
+  sc->sort_by_symbol =               unsafe_defun("sort-by!",   sort_by, 	                2, 1, false); /* [c4augustus] calls key and less? */
   sc->append_symbol =                defun("append",		append,			0, 0, true);
   sc->qq_append_symbol =             defun("[list*]",           qq_append,		2, 0, false);
 
@@ -95186,6 +98083,15 @@ static void init_rootlet(s7_scheme *sc)
   sc->make_float_vector_symbol =     defun("make-float-vector", make_float_vector,	1, 1, false);
   sc->float_vector_set_symbol =      defun("float-vector-set!", float_vector_set,	3, 0, true);
   sc->float_vector_ref_symbol =      defun("float-vector-ref",  float_vector_ref,	2, 0, true);
+  sc->float_vector_add_symbol =      defun("float-vector-add!", float_vector_add,	2, 2, false); // [c4augustus]
+  sc->float_vector_scale_symbol =    defun("float-vector-scale!", float_vector_scale,	2, 2, false);
+  sc->float_vector_fma_symbol =      defun("float-vector-fma!", float_vector_fma,	3, 2, false);
+  sc->float_vector_lerp_symbol =     defun("float-vector-lerp!", float_vector_lerp,	3, 2, false);
+  sc->float_vector_clamp_symbol =    defun("float-vector-clamp!", float_vector_clamp,	3, 2, false);
+  sc->float_vector_dot_symbol =      defun("float-vector-dot",  float_vector_dot,	2, 2, false);
+  sc->float_vector_sum_symbol =      defun("float-vector-sum",  float_vector_sum,	1, 2, false);
+  sc->float_vector_min_symbol =      defun("float-vector-min",  float_vector_min,	1, 2, false);
+  sc->float_vector_max_symbol =      defun("float-vector-max",  float_vector_max,	1, 2, false);
 
   sc->int_vector_symbol =            defun("int-vector",	int_vector,		0, 0, true);
   sc->make_int_vector_symbol =       defun("make-int-vector",	make_int_vector,	1, 1, false);
@@ -95381,21 +98287,37 @@ static void init_rootlet(s7_scheme *sc)
 
 #if (!MS_WINDOWS)
 static pthread_mutex_t init_lock = PTHREAD_MUTEX_INITIALIZER;
+#define init_lock_acquire() pthread_mutex_lock(&init_lock)
+#define init_lock_release() pthread_mutex_unlock(&init_lock)
+#else
+/* [c4augustus] a spin lock without windows.h, held only while the first s7_init fills the shared tables */
+#include <intrin.h>
+static volatile long init_lock = 0;
+#if defined(_M_ARM64)
+  #define init_lock_acquire() while (_InterlockedCompareExchange(&init_lock, 1, 0) != 0) __yield()
+#else
+  #define init_lock_acquire() while (_InterlockedCompareExchange(&init_lock, 1, 0) != 0) _mm_pause()
+#endif
+#define init_lock_release() _InterlockedExchange(&init_lock, 0)
 #endif
 
 s7_scheme *s7_init(void)
+{
+  return(s7_init_with_heap_size(INITIAL_HEAP_SIZE)); // [c4augustus]
+}
+
+s7_scheme *s7_init_with_heap_size(s7_int initial_heap_size) // [c4augustus]
 {
   int32_t i;
   s7_scheme *sc;
   static bool already_inited = false;
 
-#if (!MS_WINDOWS)
-  setlocale(LC_NUMERIC, "C"); /* use decimal point in floats */
-  pthread_mutex_lock(&init_lock);
-#endif
-
+  init_lock_acquire(); /* [c4augustus] the tables below are shared by every s7_scheme, filled once under the lock */
   if (!already_inited)
     {
+#if (!MS_WINDOWS)
+      setlocale(LC_NUMERIC, "C"); /* use decimal point in floats */ /* [c4augustus] process-wide, so only once */
+#endif
       init_types();
       init_ctables();
       init_mark_functions();
@@ -95417,15 +98339,20 @@ s7_scheme *s7_init(void)
 #if S7_DEBUGGING
   init_never_unheaped();
 #endif
-#if (!MS_WINDOWS)
-  pthread_mutex_unlock(&init_lock);
-#endif
+  init_lock_release(); /* [c4augustus] */
   sc = (s7_scheme *)Calloc(1, sizeof(s7_scheme)); /* not malloc! */
 #if S7_DEBUGGING || POINTER_32 || WITH_WARNINGS || DISABLE_FILE_OUTPUT
   cur_sc = sc;                                    /* for gdb/debugging */
 #endif
   sc->gc_off = true;                              /* sc->args and so on are not set yet, so a gc during init -> segfault */
   sc->gc_in_progress = false;
+  sc->gc_sweeping = false;                        // [c4augustus]
+  sc->gc_defer_heap_limit = 0;                    // [c4augustus]
+  sc->heap_growth_factor = 0.0;                   // [c4augustus]
+  sc->heap_resize_hook = NULL;                    // [c4augustus]
+  sc->gc_roots = NULL;                            // [c4augustus]
+  sc->gc_roots_size = 0;                          // [c4augustus]
+  sc->gc_roots_loc = 0;                           // [c4augustus]
   sc->gc_stats = 0;
 
   sc->saved_pointers = (void **)Malloc(INITIAL_SAVED_POINTERS_SIZE * sizeof(void *));
@@ -95445,6 +98372,7 @@ s7_scheme *s7_init(void)
   sc->num_to_str_size = -1;
   sc->num_to_str = NULL;
   init_block_lists(sc);
+  sc->allocator = default_allocator; /* [c4augustus] */
   sc->alloc_string_k = ALLOC_STRING_SIZE;
   sc->alloc_string_cells = NULL;
   sc->alloc_opt_func_cells = NULL;
@@ -95549,6 +98477,7 @@ s7_scheme *s7_init(void)
   sc->temp10 = sc->unused;
   sc->rec_p1 = sc->unused;
   sc->rec_p2 = sc->unused;
+  sc->load_record = sc->F; /* [c4augustus] */
 
   sc->begin_hook = NULL;
   sc->autoload_table = sc->nil;
@@ -95563,18 +98492,18 @@ s7_scheme *s7_init(void)
 #endif
   sc->rec_stack = NULL;
 
-  sc->heap_size = INITIAL_HEAP_SIZE;
+  sc->heap_size = (initial_heap_size < 1024) ? 1024 : initial_heap_size; // [c4augustus]
   if ((sc->heap_size % 32) != 0)
     sc->heap_size = 32 * (int64_t)ceil((double)(sc->heap_size) / 32.0);
   sc->heap = (s7_pointer *)Malloc(sc->heap_size * sizeof(s7_pointer));
   sc->free_heap = (s7_cell **)Malloc(sc->heap_size * sizeof(s7_cell *));
-  sc->free_heap_top = (s7_cell **)(sc->free_heap + INITIAL_HEAP_SIZE);
+  sc->free_heap_top = (s7_cell **)(sc->free_heap + sc->heap_size); // [c4augustus] all three were INITIAL_HEAP_SIZE
   sc->free_heap_trigger = (s7_cell **)(sc->free_heap + GC_TRIGGER_SIZE);
   sc->previous_free_heap_top = sc->free_heap_top;
   {
-    s7_cell *cells = (s7_cell *)Malloc(INITIAL_HEAP_SIZE * sizeof(s7_cell)); /* was calloc 14-Apr-22 */
+    s7_cell *cells = (s7_cell *)Malloc(sc->heap_size * sizeof(s7_cell)); /* was calloc 14-Apr-22 */
     add_saved_pointer(sc, (void *)cells);
-    for (i = 0; i < INITIAL_HEAP_SIZE; i++)       /* LOOP_4 here is slower! */
+    for (i = 0; i < sc->heap_size; i++)       /* LOOP_4 here is slower! */
       {
 	sc->heap[i] = &cells[i];
  	sc->free_heap[i] = sc->heap[i];
@@ -95639,13 +98568,7 @@ s7_scheme *s7_init(void)
   initialize_op_stack(sc);
 
   /* keep the symbol table out of the heap */
-  sc->symbol_table = (s7_pointer)Malloc(sizeof(s7_cell)); /* was calloc 14-Apr-22 */
-  full_type(sc->symbol_table) = T_VECTOR | T_UNHEAP;
-  vector_length(sc->symbol_table) = SYMBOL_TABLE_SIZE;
-  vector_elements(sc->symbol_table) = (s7_pointer *)Malloc(SYMBOL_TABLE_SIZE * sizeof(s7_pointer));
-  vector_getter(sc->symbol_table) = normal_vector_getter;
-  vector_setter(sc->symbol_table) = normal_vector_setter;
-  normal_vector_fill(sc->symbol_table, sc->nil);
+  init_symbol_table(sc, SYMBOL_TABLE_SIZE); /* [c4augustus] */
 
   { /* sc->opts */
     opt_info *os = (opt_info *)Malloc(OPTS_SIZE * sizeof(opt_info)); /* was calloc, 17-Oct-21 */
@@ -95744,6 +98667,9 @@ s7_scheme *s7_init(void)
   sc->unentry = (hash_entry_t *)Malloc(sizeof(hash_entry_t));
   hash_entry_set_value(sc->unentry, sc->F);
   sc->begin_op = OP_BEGIN_NO_HOOK;
+  sc->step_countdown = S7_INT64_MAX; /* [c4augustus] */
+  sc->step_budget = 0;
+  sc->step_reprieve = false; /* [c4augustus] */
   /* we used to laboriously set various other fields to null, but the calloc takes care of that */
   sc->tree_pointers = NULL;
   sc->tree_pointers_size = 0;
@@ -96065,6 +98991,8 @@ void s7_free(s7_scheme *sc)
   gc_list_free(sc->weak_refs);
   gc_list_free(sc->weak_hash_iterators);
   gc_list_free(sc->opt1_funcs);
+  gc_list_free(sc->gc_sweep_parked); // [c4augustus]
+  if (sc->gc_roots) free(sc->gc_roots); // [c4augustus]
 
   free(port_port(sc->standard_output));
   free(port_port(sc->standard_error));
@@ -96081,6 +99009,13 @@ void s7_free(s7_scheme *sc)
   for (block_t *top = sc->block_lists[TOP_BLOCK_LIST]; top; top = block_next(top))
     if (block_data(top))
       free(block_data(top));
+  for (i = 3; i < TOP_BLOCK_LIST; i++) /* [c4augustus] */
+    while (sc->block_slabs[i])
+      {
+	block_slab_t *slab = sc->block_slabs[i];
+	sc->block_slabs[i] = slab->next;
+	(*(slab->release))(slab->release_data, (void *)slab, slab->bytes);
+      }
 
   for (i = 0; i < sc->saved_pointers_loc; i++)
     free(sc->saved_pointers[i]);
@@ -96096,8 +99031,7 @@ void s7_free(s7_scheme *sc)
 
   free(sc->heap);
   free(sc->free_heap);
-  free(vector_elements(sc->symbol_table)); /* alloc'd directly, not via block */
-  free(sc->symbol_table);
+  free(sc->symbol_table); /* [c4augustus] alloc'd directly, not via block */
   free(sc->unlet);
   free(sc->setters);
   free(sc->op_stack);
@@ -96123,6 +99057,7 @@ void s7_free(s7_scheme *sc)
 	free(sc->fdats[i]);
       }
   free(sc->fdats);
+  if (sc->format_programs) free(sc->format_programs); // [c4augustus]
 
   if (sc->profile_data)
     {
@@ -96203,7 +99138,7 @@ void s7_repl(s7_scheme *sc)
     {
       s7_pointer libs = global_slot(sc->libraries_symbol);
       uint64_t hash = raw_string_hash((const uint8_t *)"*libc*", 6);  /* hack around an idiotic gcc 10.2.1 warning */
-      s7_define(sc, sc->nil, new_symbol(sc, "*libc*", 6, hash, hash % SYMBOL_TABLE_SIZE), e);
+      s7_define(sc, sc->nil, new_symbol(sc, "*libc*", 6, hash), e);
       slot_set_value(libs, cons(sc, cons(sc, s7_make_semipermanent_string(sc, "libc.scm"), e), slot_value(libs)));
     }
   s7_set_curlet(sc, old_e);       /* restore incoming (curlet) */
@@ -0,0 +1,310 @@
+// Copyright © 2025 Christopher Augustus
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// used by the C++ that Source/aboa/aot.aboa generates from Aboa modules,
+// the errors raise the same s7 errors the interpreted builtins would
+
+#pragma once
+
+#include "aboa-s7.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <initializer_list>
+#include <type_traits>
+
+struct aotRootFrame {
+  s7_scheme * const s7;
+  s7_int      const frame;
+  aotRootFrame(s7_scheme * s7) : s7(s7), frame(s7_gc_push_root_frame(s7)) {}
+  ~aotRootFrame() { s7_gc_pop_root_frame(s7, frame); }
+};
+  // ^ each compiled definition and each pass of a loop that holds s7
+  //   values opens one, so what aotRoot roots in it lives until its end
+
+inline auto aotRoot(
+  s7_scheme *  const s7,
+  s7_pointer   const value
+) -> s7_pointer {
+  return s7_gc_root(s7, value);
+}
+
+inline auto aotArg(
+  s7_pointer const args,
+  int        const index
+) -> s7_pointer {
+  auto mutArgs = args;
+  for (int mutI = 1; mutI < index; mutI++)
+    mutArgs = s7_cdr(mutArgs);
+  return s7_car(mutArgs);
+}
+
+inline auto aotReal(
+  s7_scheme *  const s7,
+  char const * const caller,
+  s7_pointer   const value,
+  int          const index = 0
+) -> s7_double {
+  if (!s7_is_real(value))
+    s7_wrong_type_arg_error(s7, caller, index, value, "a real");
+  return s7_number_to_real(s7, value);
+}
+
+inline auto aotInt(
+  s7_scheme *  const s7,
+  char const * const caller,
+  s7_pointer   const value,
+  int          const index = 0
+) -> s7_int {
+  if (!s7_is_integer(value))
+    s7_wrong_type_arg_error(s7, caller, index, value, "an integer");
+  return s7_integer(value);
+}
+
+inline auto aotFloatVector(
+  s7_scheme *  const s7,
+  char const * const caller,
+  s7_pointer   const value,
+  int          const index = 0
+) -> s7_pointer {
+  if (!s7_is_float_vector(value))
+    s7_wrong_type_arg_error(s7, caller, index, value, "a float-vector");
+  return value;
+}
+
+inline auto aotRealArg(
+  s7_scheme * const s7, char const * const caller,
+  s7_pointer  const args, int const index
+) -> s7_double {
+  return aotReal(s7, caller, aotArg(args, index), index);
+}
+
+inline auto aotIntArg(
+  s7_scheme * const s7, char const * const caller,
+  s7_pointer  const args, int const index
+) -> s7_int {
+  return aotInt(s7, caller, aotArg(args, index), index);
+}
+
+inline auto aotFloatVectorArg(
+  s7_scheme * const s7, char const * const caller,
+  s7_pointer  const args, int const index
+) -> s7_pointer {
+  return aotFloatVector(s7, caller, aotArg(args, index), index);
+}
+
+inline auto aotFloatVectorRef(
+  s7_scheme *  const s7,
+  char const * const caller,
+  s7_pointer   const vector,
+  s7_int       const index
+) -> s7_double {
+  if (index < 0 || index >= s7_vector_length(vector))
+    s7_out_of_range_error(s7, caller, 2,
+      s7_make_integer(s7, index), "a valid index");
+  return s7_float_vector_elements(vector)[index];
+}
+
+inline auto aotFloatVectorSet(
+  s7_scheme *  const s7,
+  char const * const caller,
+  s7_pointer   const vector,
+  s7_int       const index,
+  s7_double    const value
+) -> s7_double {
+  if (index < 0 || index >= s7_vector_length(vector))
+    s7_out_of_range_error(s7, caller, 2,
+      s7_make_integer(s7, index), "a valid index");
+  return s7_float_vector_elements(vector)[index] = value;
+}
+
+inline auto aotQuotient(
+  s7_scheme *  const s7,
+  char const * const caller,
+  s7_int       const dividend,
+  s7_int       const divisor
+) -> s7_int {
+  if (divisor == 0)
+    s7_error(s7, s7_make_symbol(s7, "division-by-zero"),
+      s7_list(s7, 2, s7_make_string(s7, "~A: division by zero"),
+        s7_make_string(s7, caller)));
+  return dividend / divisor;
+}
+
+inline auto aotRemainder(
+  s7_scheme *  const s7,
+  char const * const caller,
+  s7_int       const dividend,
+  s7_int       const divisor
+) -> s7_int {
+  return dividend - aotQuotient(s7, caller, dividend, divisor) * divisor;
+}
+
+inline auto aotModulo(
+  s7_scheme *  const s7,
+  char const * const caller,
+  s7_int       const dividend,
+  s7_int       const divisor
+) -> s7_int {
+  auto const remainder = aotRemainder(s7, caller, dividend, divisor);
+  return (remainder != 0 && (remainder < 0) != (divisor < 0))
+    ? remainder + divisor : remainder;
+}
+
+inline auto aotGlobal(
+  s7_scheme *  const s7,
+  char const * const name
+) -> s7_pointer {
+  return s7_name_to_value(s7, name);
+}
+  // ^ looked up on every use, so redefining the binding takes effect
+
+inline auto aotCall(
+  s7_scheme *  const s7,
+  char const * const name,
+  std::initializer_list<s7_pointer> const args
+) -> s7_pointer {
+  aotRootFrame const frame(s7);
+  auto mutList = s7_nil(s7);
+  for (auto mutArg = args.end(); mutArg != args.begin(); )
+    mutList = aotRoot(s7, s7_cons(s7, *--mutArg, mutList));
+  return s7_call(s7, aotGlobal(s7, name), mutList);
+}
+  // ^ calls whatever the name is bound to, a native binding or Aboa,
+  //   the caller roots the result
+
+// the generic arithmetic takes each operand as an s7 value when its type
+// is only known at run time, or as s7_int or s7_double when it is known
+
+template <typename Number>
+inline auto aotIsInteger(Number const value) -> bool {
+  if constexpr (std::is_same_v<Number, s7_pointer>)
+    return s7_is_integer(value);
+  else
+    return std::is_integral_v<Number>;
+}
+
+template <typename Number>
+inline auto aotIsDouble(Number const value) -> bool {
+  if constexpr (std::is_same_v<Number, s7_pointer>)
+    return s7_is_real(value) && !s7_is_rational(value);
+  else
+    return std::is_floating_point_v<Number>;
+}
+
+template <typename Number>
+inline auto aotIntegerOf(Number const value) -> s7_int {
+  if constexpr (std::is_same_v<Number, s7_pointer>)
+    return s7_is_integer(value) ? s7_integer(value) : 0;
+  else
+    return std::is_integral_v<Number> ? static_cast<s7_int>(value) : 0;
+}
+
+template <typename Number>
+inline auto aotRealOf(
+  s7_scheme * const s7,
+  Number      const value
+) -> s7_double {
+  if constexpr (std::is_same_v<Number, s7_pointer>)
+    return s7_number_to_real(s7, value);
+  else
+    return static_cast<s7_double>(value);
+}
+
+template <typename Number>
+inline auto aotBox(
+  s7_scheme * const s7,
+  Number      const value
+) -> s7_pointer {
+  if constexpr (std::is_same_v<Number, s7_pointer>)
+    return value;
+  else if constexpr (std::is_integral_v<Number>)
+    return s7_make_integer(s7, value);
+  else
+    return s7_make_real(s7, value);
+}
+
+template <typename A, typename B>
+inline auto aotAreNumbers(A const a, B const b) -> bool {
+  return (aotIsDouble(a) && (aotIsDouble(b) || aotIsInteger(b)))
+    || (aotIsDouble(b) && aotIsInteger(a));
+}
+  // ^ a double with a double or an integer, which s7 combines as doubles
+
+template <typename A, typename B>
+inline auto aotCallBoxed(
+  s7_scheme *  const s7,
+  char const * const name,
+  A            const a,
+  B            const b
+) -> s7_pointer {
+  aotRootFrame const frame(s7);
+  auto const x = aotRoot(s7, aotBox(s7, a));
+  auto const y = aotRoot(s7, aotBox(s7, b));
+  return aotCall(s7, name, {x, y});
+}
+  // ^ ratios, overflow and what is not a number, as s7 would
+
+template <typename A, typename B, typename Operation>
+inline auto aotArithmetic(
+  s7_scheme *  const s7,
+  char const * const name,
+  A            const a,
+  B            const b,
+  Operation    const operation,
+  bool         const fits
+) -> s7_pointer {
+  if (aotIsInteger(a) && aotIsInteger(b) && fits)
+    return s7_make_integer(s7, operation(aotIntegerOf(a), aotIntegerOf(b)));
+  if (aotAreNumbers(a, b))
+    return s7_make_real(s7, operation(aotRealOf(s7, a), aotRealOf(s7, b)));
+  return aotCallBoxed(s7, name, a, b);
+}
+  // ^ the caller roots the result
+
+template <typename A, typename B>
+inline auto aotAdd(s7_scheme * const s7, A const a, B const b) -> s7_pointer {
+  auto const x = aotIntegerOf(a);
+  auto const y = aotIntegerOf(b);
+  return aotArithmetic(s7, "+", a, b, std::plus<>(),
+    y >= 0 ? x <= INT64_MAX - y : x >= INT64_MIN - y);
+}
+
+template <typename A, typename B>
+inline auto aotSubtract(s7_scheme * const s7, A const a, B const b) -> s7_pointer {
+  auto const x = aotIntegerOf(a);
+  auto const y = aotIntegerOf(b);
+  return aotArithmetic(s7, "-", a, b, std::minus<>(),
+    y >= 0 ? x >= INT64_MIN + y : x <= INT64_MAX + y);
+}
+
+template <typename A, typename B>
+inline auto aotMultiply(s7_scheme * const s7, A const a, B const b) -> s7_pointer {
+  auto const small = [](s7_int const value) {
+    return value >= -INT64_C(3037000499) && value <= INT64_C(3037000499);
+  };
+  return aotArithmetic(s7, "*", a, b, std::multiplies<>(),
+    small(aotIntegerOf(a)) && small(aotIntegerOf(b)));
+}
+  // ^ both under the square root of INT64_MAX cannot overflow
+
+template <typename A, typename B, typename Compare>
+inline auto aotCompare(
+  s7_scheme *  const s7,
+  char const * const name,
+  A            const a,
+  B            const b,
+  Compare      const compare
+) -> bool {
+  if (aotIsInteger(a) && aotIsInteger(b))
+    return compare(aotIntegerOf(a), aotIntegerOf(b));
+  if (aotAreNumbers(a, b))
+    return compare(aotRealOf(s7, a), aotRealOf(s7, b));
+  return aotCallBoxed(s7, name, a, b) != s7_f(s7);
+}
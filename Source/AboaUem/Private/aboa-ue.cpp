@@ -23,25 +23,51 @@
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Character.h"
+#include "HAL/FileManager.h"
+#include "HAL/LowLevelMemTracker.h"
 #include "HAL/PlatformFileManager.h"
+#include "Hash/CityHash.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Misc/FileHelper.h"
+#include "Stats/Stats.h"
 
+#include <algorithm>
 #include <array>
-#include <stack>
+#include <cmath>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <variant>
+#include <vector>
 
 #define ALK_TRACING 0
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAlkScheme, Log, All);
 DEFINE_LOG_CATEGORY(LogAlkScheme);
 
+DECLARE_STATS_GROUP(TEXT("Aboa"), STATGROUP_Aboa, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Heap Cells"), STAT_AboaHeapCells, STATGROUP_Aboa);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Heap Resizes"), STAT_AboaHeapResizes, STATGROUP_Aboa);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Heap Resize ms"), STAT_AboaHeapResizeMs, STATGROUP_Aboa);
+DECLARE_MEMORY_STAT(TEXT("Slab Bytes"), STAT_AboaSlabBytes, STATGROUP_Aboa);
+
+LLM_DEFINE_TAG(AboaUE);
+
 struct s7pointerError { s7_pointer const pointer; };
 struct s7pointerValid { s7_pointer const pointer; };
 
+struct s7rootFrame {
+  s7_scheme * const s7;
+  s7_int      const frame;
+  s7rootFrame(s7_scheme * s7) : s7(s7), frame(s7_gc_push_root_frame(s7)) {}
+  ~s7rootFrame() { s7_gc_pop_root_frame(s7, frame); }
+  auto root(s7_pointer const pointer) -> s7_pointer {
+    return s7_gc_root(s7, pointer);
+  }
+};
+  // ^ roots C++ locals until the end of the scope
+
 static auto
 scheme_arg_boolean_or_error(
   s7_scheme *  const s7,
@@ -597,23 +623,216 @@ ue_character_get_mesh(s7_scheme * s7, s7_pointer args) -> s7_pointer {
   return s7_make_c_pointer(s7, character->GetMesh());
 }
 
+// each callee of callAboaUeCode keeps the thunk that makes its call,
+// run under a catch so an error comes back to us instead of to the
+// top level, and counts the errors it raised in a row; at the limit it
+// is suspended with one summary line, and skipped without evaluating
+// anything until resetAboaUeCallErrors(...) after its script reloads
+struct AboaUeCallee {
+  std::string expr;
+    // ^ the call the thunk was made for, the argument names can vary
+  s7_pointer  thunk = nullptr;
+  s7_int      protectLoc = 0;
+  int32       errors = 0;
+  bool        suspended = false;
+  int64       skipped = 0;
+};
+
+struct AboaUeCallRegistry {
+  std::unordered_map<std::string, AboaUeCallee> callees;
+  s7_pointer errorHandler = nullptr;
+  s7_int     errorHandlerLoc = 0;
+  s7_pointer errorFormatter = nullptr;
+  s7_int     errorFormatterLoc = 0;
+    // ^ formats the error info under its own catch, the format string
+    //   and its args come from the script and can be wrong themselves
+  s7_pointer lastError = nullptr;
+    // ^ what the handler returned, so a nested call cannot mistake it
+};
+
+static std::map<s7_scheme const *, AboaUeCallRegistry> mutCallRegistries;
+
+static auto
+call_error_handler(s7_scheme * s7, s7_pointer args) -> s7_pointer {
+  return mutCallRegistries[s7].lastError =
+    s7_cons(s7, s7_car(args), s7_cadr(args)); // type . info
+}
+
+static auto
+call_error_message(
+  s7_scheme * const s7,
+  s7_pointer  const error
+) -> FString {
+  auto const type = s7_car(error);
+  auto const info = s7_cdr(error);
+  auto const typeName = s7_is_symbol(type)
+    ? FString(ANSI_TO_TCHAR(s7_symbol_name(type))) : FString(TEXT("error"));
+  auto const formatter = mutCallRegistries[s7].errorFormatter;
+  if (formatter && s7_is_pair(info) && s7_is_string(s7_car(info))) {
+    auto const formatted = s7_call(s7, formatter, s7_cons(s7, info, s7_nil(s7)));
+    if (s7_is_string(formatted))
+      return typeName + TEXT(": ") + ANSI_TO_TCHAR(s7_string(formatted));
+  } // ^ otherwise the info is shown as is
+  auto const chars = s7_object_to_c_string(s7, info);
+  auto const message = typeName + TEXT(": ") + ANSI_TO_TCHAR(chars);
+  free(chars);
+  return message;
+}
+
+static auto
+call_registry(s7_scheme * const s7) -> AboaUeCallRegistry & {
+  auto & mutRegistry = mutCallRegistries[s7];
+  if (!mutRegistry.errorHandler) {
+    mutRegistry.errorHandler = s7_make_function(s7, "aboa-ue-call-error",
+      call_error_handler, 2, 0, false, "records the error of a caught call");
+    mutRegistry.errorHandlerLoc = s7_gc_protect(s7, mutRegistry.errorHandler);
+    mutRegistry.errorFormatter = s7_eval_c_string(s7,
+      "(> (info) (catch $t (> () (apply format $f info)) (> args $f)))");
+    mutRegistry.errorFormatterLoc = s7_gc_protect(s7, mutRegistry.errorFormatter);
+  }
+  return mutRegistry;
+}
+
+// a call gets the smaller of its own step budget and what is left of the
+// budget of the call it runs in, one without its own runs within that one
+struct AboaUeCallBudget {
+  s7_int const outerSteps;
+  s7_int const steps;
+};
+
+static auto
+call_budget_arm(
+  s7_scheme * const s7,
+  int64       const stepBudget
+) -> AboaUeCallBudget {
+  auto const outerSteps = s7_step_budget(s7);
+  auto const steps =
+    stepBudget > 0 && (outerSteps == 0 || stepBudget < outerSteps)
+      ? s7_int(stepBudget) : outerSteps;
+  s7_set_step_budget(s7, steps);
+  return {outerSteps, steps};
+}
+
+static auto
+call_budget_lift(
+  s7_scheme *      const s7,
+  AboaUeCallBudget const budget
+) -> s7_int {
+  auto const stepsLeft = s7_set_step_budget(s7, 0);
+    // ^ a spent budget raises on every step, so it is lifted while the
+    //   result or the error is handled, then the outer budget is restored
+  return budget.outerSteps > 0
+    ? std::max<s7_int>(budget.outerSteps - (budget.steps - stepsLeft), 1) : 0;
+    // ^ a nested call spends the budget of the call it runs in, and one
+    //   that ran it out leaves that call a last step before it raises too
+}
+
+// calls proc on args under the catch of the call registry and a step
+// budget, logging an error as raised by what and its handle and
+// returning null instead of the result
+static auto
+call_caught(
+  s7_scheme *     const s7,
+  s7_pointer      const proc,
+  s7_pointer      const args,
+  int64           const stepBudget,
+  TCHAR const *   const what,
+  s7_int          const handle
+) -> s7_pointer {
+  s7rootFrame mutRoots(s7);
+  mutRoots.root(proc);
+  mutRoots.root(args);
+  auto & mutRegistry = call_registry(s7);
+  auto const budget = call_budget_arm(s7, stepBudget);
+  auto const result = mutRoots.root(s7_apply_with_catch(
+    s7, s7_t(s7), proc, args, mutRegistry.errorHandler));
+  auto const outerStepsLeft = call_budget_lift(s7, budget);
+  auto const raised = result == mutRegistry.lastError;
+  if (raised) {
+    mutRegistry.lastError = nullptr;
+    UE_LOG(LogAlkScheme, Error,
+      TEXT("%s %lld raised %s"), what, int64(handle), *call_error_message(s7, result))
+  }
+  s7_set_step_budget(s7, outerStepsLeft);
+  return raised ? nullptr : result;
+}
+
+// input events are queued as they arrive during the frame
+// and dispatched once per frame by dispatchAboaUeInput(...)
+// with each handler receiving all of its events packed into one
+// float vector of input_record_stride elements per event:
+//   handle kind finger x y z
+// where kind is the index into input_symbols
+// and finger is -1 for action events
+static auto constexpr input_record_stride = 6;
+
+struct AboaUeInputRecord {
+  s7_int  const handle;
+  int     const kind;
+  int     const finger;
+  FVector const location;
+};
+
+class UInputBinding;
+
+struct AboaUeInputQueue {
+  std::vector<AboaUeInputRecord>    records;
+  std::map<s7_int, UInputBinding *> bindings;
+  s7_int                            nextHandle = 1;
+};
+
+static std::map<s7_scheme const *, AboaUeInputQueue> mutInputQueues;
+
 class UInputBinding : public UObject {
   DECLARE_CLASS_INTRINSIC(UInputBinding, UObject, CLASS_MatchedSerializers, TEXT("/Script/CoreUObject"))
-  s7_scheme * s7          = nullptr;
-  s7_pointer  mutHandler  = nullptr;
+  s7_scheme *        s7               = nullptr;
+  s7_pointer         mutHandler       = nullptr;
+  s7_int             mutProtectLoc    = -1;
+  s7_int             mutHandle        = 0;
+  int                mutKind          = 0;
+  int32              mutActionHandle  = INDEX_NONE;
+  AboaUeInputQueue * mutQueue         = nullptr;
+  TWeakObjectPtr<UInputComponent> mutInputComp;
+
+  auto Protect(
+    s7_scheme * const ins7,
+    s7_pointer  const proc,
+    int         const kind
+  ) -> void {
+    s7 = ins7;
+    mutHandler = proc;
+    mutProtectLoc = s7_gc_protect(s7, mutHandler);
+      // ^ released by Unbind()
+    mutKind = kind;
+    mutQueue = &mutInputQueues[s7];
+    mutHandle = mutQueue->nextHandle++;
+    mutQueue->bindings.emplace(mutHandle, this);
+    AddToRoot(); // !!! nothing else references this binding
+  }
+  auto Enqueue(
+    int     const finger,
+    FVector const & location
+  ) -> void {
+    if (mutQueue)
+      mutQueue->records.push_back({mutHandle, mutKind, finger, location});
+  }
 public:
-  void BindAction(
+  auto Handle()  const -> s7_int     { return mutHandle; }
+  auto Handler() const -> s7_pointer { return mutHandler; }
+  auto BindAction(
     UInputComponent & inputcomp,
     const char *      action,
     EInputEvent const event,
+    int         const kind,
     s7_scheme * const ins7,
     s7_pointer  const proc
-  ) {
+  ) -> s7_int {
     if (ins7 && proc && s7_is_procedure(proc)) {
-      s7 = ins7;
-      mutHandler = proc;
-      s7_gc_protect(s7, mutHandler); // TODO: @@@ PROTECTED INDEFINITELY
-      inputcomp.BindAction(action, event, this, &UInputBinding::HandleAction);
+      Protect(ins7, proc, kind);
+      mutInputComp = &inputcomp;
+      mutActionHandle = inputcomp.BindAction(
+        action, event, this, &UInputBinding::HandleAction
+      ).GetHandle();
 #if ALK_TRACING
       UE_LOG(LogAlkScheme, Display,
         TEXT("TRACE C++ BindAction %s s7 %d handler %d"),
@@ -621,17 +840,18 @@ public:
         s7, mutHandler);
 #endif
     }
+    return mutHandle;
   }
-  void BindEventHandler(
+  auto BindEventHandler(
     UInputComponent & inputcomp,
     EInputEvent const event,
+    int         const kind,
     s7_scheme * const ins7,
     s7_pointer  const proc
-  ) {
+  ) -> s7_int {
     if (ins7 && proc && s7_is_procedure(proc)) {
-      s7 = ins7;
-      mutHandler = proc;
-      s7_gc_protect(s7, mutHandler); // TODO: @@@ PROTECTED INDEFINITELY
+      Protect(ins7, proc, kind);
+      mutInputComp = &inputcomp;
       inputcomp.BindTouch(event, this, &UInputBinding::HandleEvent);
 #if ALK_TRACING
       UE_LOG(LogAlkScheme, Display,
@@ -640,6 +860,33 @@ public:
         s7, mutHandler);
 #endif
     }
+    return mutHandle;
+  }
+  auto Unbind() -> void {
+    auto const inputcomp = mutInputComp.Get();
+    if (inputcomp) {
+      if (mutActionHandle != INDEX_NONE)
+        inputcomp->RemoveActionBindingForHandle(mutActionHandle);
+      else
+        inputcomp->TouchBindings.RemoveAll(
+          [this](FInputTouchBinding const & binding) {
+            return binding.TouchDelegate.IsBoundToObject(this);
+          });
+    }
+    mutInputComp.Reset();
+    if (mutQueue) {
+      mutQueue->bindings.erase(mutHandle);
+      mutQueue = nullptr;
+    }
+    if (s7 && mutProtectLoc >= 0)
+      s7_gc_unprotect_at(s7, mutProtectLoc);
+    mutProtectLoc = -1;
+    mutHandler = nullptr;
+    RemoveFromRoot();
+#if ALK_TRACING
+    UE_LOG(LogAlkScheme, Display,
+      TEXT("TRACE C++ Unbind s7 %d handle %d"), s7, mutHandle);
+#endif
   }
   void HandleAction() {
     if (s7 && mutHandler) {
@@ -648,7 +895,7 @@ public:
       TEXT("TRACE C++ HandleAction s7 %d handler %d"),
       s7, mutHandler);
 #endif
-      s7_apply_function(s7, mutHandler, s7_nil(s7));
+      Enqueue(-1, FVector::ZeroVector);
     }
   }
   void HandleEvent(
@@ -661,9 +908,7 @@ public:
       TEXT("TRACE C++ HandleEvent s7 %d handler %d"),
       s7, mutHandler);
 #endif
-      s7_apply_function(s7, mutHandler,
-        s7_cons(s7, s7_make_integer(s7, FingerIndex),
-          s7_cons(s7, scheme_ue_vector(s7, Location), s7_nil(s7))));
+      Enqueue(FingerIndex, Location);
     }
   }
 };
@@ -698,7 +943,7 @@ ue_bind_input_action(s7_scheme * s7, s7_pointer args) -> s7_pointer {
     s7, s7_caddr(args), 3, "event", input_symbols.data(), input_symbols.size());
   if (argevent.index() == 1)
     return std::get<1>(argevent).pointer;
-  auto const inputevent = input_events[std::get<0>(argevent)];
+  auto const kind = std::get<0>(argevent);
   auto const arghandler = scheme_arg_procedure_or_error(
     s7, s7_cadddr(args), 4, "handler");
   if (arghandler.index() == 1)
@@ -709,10 +954,9 @@ ue_bind_input_action(s7_scheme * s7, s7_pointer args) -> s7_pointer {
   if (!inputcomp)
     return s7_f(s7); // TODO: @@@ REPORT ERROR TO SCHEME
   auto const binding = NewObject<UInputBinding>();
-  binding->BindAction(
-    *inputcomp, std::get<0>(argaction), inputevent, s7, handler);
-  // TODO: ### binding LEAKS FROM HERE
-  return s7_t(s7);
+  return s7_make_integer(s7, binding->BindAction(
+    *inputcomp, std::get<0>(argaction), input_events[kind], kind, s7, handler));
+    // ^ binding is released by ue-unbind-input or shutdownAboaUe(...)
 }
 
 static auto const name_ue_bind_input_touch = "ue-bind-input-touch";
@@ -729,7 +973,7 @@ ue_bind_input_touch(s7_scheme * s7, s7_pointer args) -> s7_pointer {
     s7, s7_cadr(args), 2, "event", input_symbols.data(), input_symbols.size());
   if (argevent.index() == 1)
     return std::get<1>(argevent).pointer;
-  auto const inputevent = input_events[std::get<0>(argevent)];
+  auto const kind = std::get<0>(argevent);
   auto const arghandler = scheme_arg_procedure_or_error(
     s7, s7_caddr(args), 3, "handler");
   if (arghandler.index() == 1)
@@ -740,8 +984,541 @@ ue_bind_input_touch(s7_scheme * s7, s7_pointer args) -> s7_pointer {
   if (!inputcomp)
     return s7_f(s7); // TODO: @@@ REPORT ERROR TO SCHEME
   auto const binding = NewObject<UInputBinding>();
-  binding->BindEventHandler(*inputcomp, inputevent, s7, handler);
-  // TODO: ### binding LEAKS FROM HERE
+  return s7_make_integer(s7, binding->BindEventHandler(
+    *inputcomp, input_events[kind], kind, s7, handler));
+    // ^ binding is released by ue-unbind-input or shutdownAboaUe(...)
+}
+
+static auto const name_ue_unbind_input = "ue-unbind-input";
+static auto
+ue_unbind_input(s7_scheme * s7, s7_pointer args) -> s7_pointer {
+  auto const arghandle = scheme_arg_integer_or_error(
+    s7, s7_car(args), 1, "handle");
+  if (arghandle.index() == 1)
+    return std::get<1>(arghandle).pointer;
+  auto const queueiter = mutInputQueues.find(s7);
+  if (queueiter == mutInputQueues.end())
+    return s7_f(s7);
+  auto const bindingiter = queueiter->second.bindings.find(std::get<0>(arghandle));
+  if (bindingiter == queueiter->second.bindings.end())
+    return s7_f(s7);
+  bindingiter->second->Unbind();
+  return s7_t(s7);
+}
+
+// a task is a chain of continuations in continuation-passing style:
+// each wait registers the procedure that continues the task and returns,
+// so no part of the s7 stack is captured or copied as call/cc would;
+// sleepers sit in a min-heap on their wake time and event waits on their
+// channel of the event bus, so a frame touches only the tasks that wake,
+// the conditions of wait-until are the only ones evaluated every frame
+struct AboaUeTaskWait {
+  s7_int     const task;
+  s7_pointer const condition; // null unless waiting until it holds
+  s7_pointer const proc;
+  s7_int     const protectLoc;
+};
+
+struct AboaUeTaskSleeper {
+  double wakeTime;
+  s7_int wait;
+};
+
+struct AboaUeTaskScheduler {
+  std::unordered_map<s7_int, AboaUeTaskWait>  waits;
+  std::vector<AboaUeTaskSleeper>              sleepers; // min-heap on wakeTime
+  std::vector<s7_int>                         polls;
+  double                                      clock = 0;
+    // ^ seconds of frames dispatched since the session booted
+  s7_int                                      current = 0;
+    // ^ the task whose continuation is running, 0 outside of any
+  s7_int                                      nextHandle = 1;
+    // ^ shared by tasks and their waits
+};
+
+static std::map<s7_scheme const *, AboaUeTaskScheduler> mutTaskSchedulers;
+
+static auto
+task_sleeper_later(
+  AboaUeTaskSleeper const & a,
+  AboaUeTaskSleeper const & b
+) -> bool {
+  return a.wakeTime > b.wakeTime;
+}
+
+static auto
+task_add_wait(
+  s7_scheme *           const s7,
+  AboaUeTaskScheduler &       mutScheduler,
+  s7_pointer            const condition,
+  s7_pointer            const proc
+) -> s7_int {
+  auto const task = mutScheduler.current != 0
+    ? mutScheduler.current : mutScheduler.nextHandle++;
+    // ^ a wait outside of any task starts one
+  auto const wait = mutScheduler.nextHandle++;
+  mutScheduler.waits.emplace(wait, AboaUeTaskWait{task, condition, proc,
+    s7_gc_protect(s7, condition ? s7_cons(s7, condition, proc) : proc)});
+    // ^ released when the task resumes or by ue-task-cancel or shutdownAboaUe(...)
+  return wait;
+}
+
+static auto
+task_resume(
+  s7_scheme *           const s7,
+  AboaUeTaskScheduler &       mutScheduler,
+  s7_int                const wait,
+  s7_pointer            const args,
+  int64                 const stepBudget
+) -> void {
+  auto const iter = mutScheduler.waits.find(wait);
+  if (iter == mutScheduler.waits.end())
+    return; // cancelled since it started waiting
+  auto const task = iter->second.task;
+  s7rootFrame mutRoots(s7);
+  auto const proc = mutRoots.root(iter->second.proc);
+  s7_gc_unprotect_at(s7, iter->second.protectLoc);
+  mutScheduler.waits.erase(iter);
+  auto const previous = mutScheduler.current;
+  mutScheduler.current = task;
+  call_caught(s7, proc, args, stepBudget, TEXT("Task"), task);
+    // ^ an error ends only this task, its continuation is not registered
+  mutScheduler.current = previous;
+}
+
+// channels are interned symbols, each with a contiguous array of
+// subscribers; a handle locates its subscriber for O(1) unsubscribe
+// by swapping the last subscriber of the channel into its place
+struct AboaUeEventSubscriber {
+  s7_int     handle;
+  s7_pointer proc;
+  s7_int     protectLoc;
+};
+
+struct AboaUeEventChannel {
+  s7_pointer                          const symbol;
+  std::vector<AboaUeEventSubscriber>        subscribers;
+  std::vector<s7_int>                       taskWaits;
+    // ^ resumed once by the next event, after the subscribers
+};
+
+struct AboaUeEventLocation {
+  size_t channel;
+  size_t subscriber;
+};
+
+struct AboaUeEventDeferred {
+  size_t     const channel;
+  s7_pointer const args;
+  s7_int     const protectLoc;
+};
+
+struct AboaUeEventBus {
+  std::unordered_map<s7_pointer, size_t>              channelIndices;
+  std::vector<AboaUeEventChannel>                     channels;
+  std::unordered_map<s7_int, AboaUeEventLocation>     locations;
+  std::vector<AboaUeEventDeferred>                    deferred;
+  s7_int                                              nextHandle = 1;
+};
+
+static std::map<s7_scheme const *, AboaUeEventBus> mutEventBuses;
+
+static auto
+event_bus_channel_index(
+  AboaUeEventBus & mutBus,
+  s7_pointer const symbol
+) -> size_t {
+  auto const iter = mutBus.channelIndices.find(symbol);
+  if (iter != mutBus.channelIndices.end())
+    return iter->second;
+  mutBus.channels.push_back({symbol, {}, {}});
+  mutBus.channelIndices.emplace(symbol, mutBus.channels.size() - 1);
+  return mutBus.channels.size() - 1;
+}
+
+static auto
+event_bus_unsubscribe(
+  s7_scheme *      const s7,
+  AboaUeEventBus &       mutBus,
+  s7_int           const handle
+) -> bool {
+  auto const iter = mutBus.locations.find(handle);
+  if (iter == mutBus.locations.end())
+    return false;
+  auto const location = iter->second;
+  mutBus.locations.erase(iter);
+  auto & mutSubscribers = mutBus.channels[location.channel].subscribers;
+  s7_gc_unprotect_at(s7, mutSubscribers[location.subscriber].protectLoc);
+  if (location.subscriber + 1 < mutSubscribers.size()) {
+    mutSubscribers[location.subscriber] = mutSubscribers.back();
+    mutBus.locations[mutSubscribers.back().handle].subscriber = location.subscriber;
+  }
+  mutSubscribers.pop_back();
+  return true;
+}
+
+static auto
+event_bus_publish(
+  s7_scheme *      const s7,
+  AboaUeEventBus &       mutBus,
+  size_t           const channel,
+  s7_pointer       const args,
+  int64            const stepBudget
+) -> void {
+  std::vector<s7_int> handles;
+    // ^ !!! handlers may subscribe or unsubscribe while we publish
+  for (auto const & subscriber : mutBus.channels[channel].subscribers)
+    handles.push_back(subscriber.handle);
+  for (auto const handle : handles) {
+    auto const iter = mutBus.locations.find(handle);
+    if (iter == mutBus.locations.end())
+      continue; // unsubscribed by a handler called earlier
+    auto const proc = mutBus.channels[iter->second.channel]
+      .subscribers[iter->second.subscriber].proc;
+    call_caught(s7, proc, s7_cons(s7, args, s7_nil(s7)), stepBudget,
+      TEXT("Event subscriber"), handle);
+  }
+  if (mutBus.channels[channel].taskWaits.empty())
+    return;
+  std::vector<s7_int> waits;
+  waits.swap(mutBus.channels[channel].taskWaits);
+    // ^ a task that waits on this channel again wakes on the next event
+  auto & mutScheduler = mutTaskSchedulers[s7];
+  for (auto const wait : waits)
+    task_resume(
+      s7, mutScheduler, wait, s7_cons(s7, args, s7_nil(s7)), stepBudget);
+}
+
+static auto const name_ue_event_subscribe = "ue-event-subscribe";
+static auto
+ue_event_subscribe(s7_scheme * s7, s7_pointer args) -> s7_pointer {
+  auto const argchannel = scheme_arg_symbol_or_error(
+    s7, s7_car(args), 1, "channel");
+  if (argchannel.index() == 1)
+    return std::get<1>(argchannel).pointer;
+  auto const arghandler = scheme_arg_procedure_or_error(
+    s7, s7_cadr(args), 2, "handler");
+  if (arghandler.index() == 1)
+    return std::get<1>(arghandler).pointer;
+  auto const handler = std::get<0>(arghandler).pointer;
+  auto & mutBus = mutEventBuses[s7];
+  auto const channel = event_bus_channel_index(mutBus, s7_car(args));
+  auto const handle = mutBus.nextHandle++;
+  auto & mutSubscribers = mutBus.channels[channel].subscribers;
+  mutSubscribers.push_back({handle, handler, s7_gc_protect(s7, handler)});
+    // ^ released by ue-event-unsubscribe or shutdownAboaUe(...)
+  mutBus.locations.emplace(handle,
+    AboaUeEventLocation{channel, mutSubscribers.size() - 1});
+  return s7_make_integer(s7, handle);
+}
+
+static auto const name_ue_event_unsubscribe = "ue-event-unsubscribe";
+static auto
+ue_event_unsubscribe(s7_scheme * s7, s7_pointer args) -> s7_pointer {
+  auto const arghandle = scheme_arg_integer_or_error(
+    s7, s7_car(args), 1, "handle");
+  if (arghandle.index() == 1)
+    return std::get<1>(arghandle).pointer;
+  auto const busiter = mutEventBuses.find(s7);
+  return busiter != mutEventBuses.end()
+      && event_bus_unsubscribe(s7, busiter->second, std::get<0>(arghandle))
+    ? s7_t(s7) : s7_f(s7);
+}
+
+static auto const name_ue_event_publish = "ue-event-publish";
+static auto
+ue_event_publish(s7_scheme * s7, s7_pointer args) -> s7_pointer {
+  auto const argchannel = scheme_arg_symbol_or_error(
+    s7, s7_car(args), 1, "channel");
+  if (argchannel.index() == 1)
+    return std::get<1>(argchannel).pointer;
+  auto const busiter = mutEventBuses.find(s7);
+  if (busiter == mutEventBuses.end())
+    return s7_nil(s7);
+  auto & mutBus = busiter->second;
+  auto const channeliter = mutBus.channelIndices.find(s7_car(args));
+  if (channeliter != mutBus.channelIndices.end())
+    event_bus_publish(s7, mutBus, channeliter->second, s7_cadr(args), 0);
+  return s7_nil(s7);
+}
+
+static auto const name_ue_event_post = "ue-event-post";
+static auto
+ue_event_post(s7_scheme * s7, s7_pointer args) -> s7_pointer {
+  auto const argchannel = scheme_arg_symbol_or_error(
+    s7, s7_car(args), 1, "channel");
+  if (argchannel.index() == 1)
+    return std::get<1>(argchannel).pointer;
+  auto & mutBus = mutEventBuses[s7];
+  auto const channel = event_bus_channel_index(mutBus, s7_car(args));
+  auto const eventargs = s7_cadr(args);
+  for (auto const & deferred : mutBus.deferred)
+    if (deferred.channel == channel && s7_is_equal(s7, deferred.args, eventargs))
+      return s7_f(s7); // coalesced with an event already posted this frame
+  mutBus.deferred.push_back({channel, eventargs, s7_gc_protect(s7, eventargs)});
+  return s7_t(s7);
+}
+
+static auto const name_ue_task_spawn = "ue-task-spawn";
+static auto
+ue_task_spawn(s7_scheme * s7, s7_pointer args) -> s7_pointer {
+  auto const argthunk = scheme_arg_procedure_or_error(
+    s7, s7_car(args), 1, "thunk");
+  if (argthunk.index() == 1)
+    return std::get<1>(argthunk).pointer;
+  auto & mutScheduler = mutTaskSchedulers[s7];
+  auto const task = mutScheduler.nextHandle++;
+  auto const previous = mutScheduler.current;
+  mutScheduler.current = task;
+  call_caught(s7, std::get<0>(argthunk).pointer, s7_nil(s7), 0,
+    TEXT("Task"), task);
+    // ^ runs until its first wait, which registers the rest of it
+  mutScheduler.current = previous;
+  return s7_make_integer(s7, task);
+}
+
+static auto const name_ue_task_wait_seconds = "ue-task-wait-seconds";
+static auto
+ue_task_wait_seconds(s7_scheme * s7, s7_pointer args) -> s7_pointer {
+  auto const argseconds = scheme_arg_real_or_error(
+    s7, s7_car(args), 1, "seconds");
+  if (argseconds.index() == 1)
+    return std::get<1>(argseconds).pointer;
+  auto const argproc = scheme_arg_procedure_or_error(
+    s7, s7_cadr(args), 2, "proc");
+  if (argproc.index() == 1)
+    return std::get<1>(argproc).pointer;
+  auto & mutScheduler = mutTaskSchedulers[s7];
+  auto const wait = task_add_wait(
+    s7, mutScheduler, nullptr, std::get<0>(argproc).pointer);
+  mutScheduler.sleepers.push_back(
+    {mutScheduler.clock + std::get<0>(argseconds), wait});
+  std::push_heap(mutScheduler.sleepers.begin(), mutScheduler.sleepers.end(),
+    task_sleeper_later);
+  return s7_make_integer(s7, mutScheduler.waits.at(wait).task);
+}
+
+static auto const name_ue_task_wait_until = "ue-task-wait-until";
+static auto
+ue_task_wait_until(s7_scheme * s7, s7_pointer args) -> s7_pointer {
+  auto const argcondition = scheme_arg_procedure_or_error(
+    s7, s7_car(args), 1, "condition");
+  if (argcondition.index() == 1)
+    return std::get<1>(argcondition).pointer;
+  auto const argproc = scheme_arg_procedure_or_error(
+    s7, s7_cadr(args), 2, "proc");
+  if (argproc.index() == 1)
+    return std::get<1>(argproc).pointer;
+  auto & mutScheduler = mutTaskSchedulers[s7];
+  auto const wait = task_add_wait(s7, mutScheduler,
+    std::get<0>(argcondition).pointer, std::get<0>(argproc).pointer);
+  mutScheduler.polls.push_back(wait);
+  return s7_make_integer(s7, mutScheduler.waits.at(wait).task);
+}
+
+static auto const name_ue_task_wait_event = "ue-task-wait-event";
+static auto
+ue_task_wait_event(s7_scheme * s7, s7_pointer args) -> s7_pointer {
+  auto const argchannel = scheme_arg_symbol_or_error(
+    s7, s7_car(args), 1, "channel");
+  if (argchannel.index() == 1)
+    return std::get<1>(argchannel).pointer;
+  auto const argproc = scheme_arg_procedure_or_error(
+    s7, s7_cadr(args), 2, "proc");
+  if (argproc.index() == 1)
+    return std::get<1>(argproc).pointer;
+  auto & mutScheduler = mutTaskSchedulers[s7];
+  auto const wait = task_add_wait(
+    s7, mutScheduler, nullptr, std::get<0>(argproc).pointer);
+  auto & mutBus = mutEventBuses[s7];
+  mutBus.channels[event_bus_channel_index(mutBus, s7_car(args))]
+    .taskWaits.push_back(wait);
+  return s7_make_integer(s7, mutScheduler.waits.at(wait).task);
+}
+
+static auto const name_ue_task_cancel = "ue-task-cancel";
+static auto
+ue_task_cancel(s7_scheme * s7, s7_pointer args) -> s7_pointer {
+  auto const arghandle = scheme_arg_integer_or_error(
+    s7, s7_car(args), 1, "handle");
+  if (arghandle.index() == 1)
+    return std::get<1>(arghandle).pointer;
+  auto const scheduleriter = mutTaskSchedulers.find(s7);
+  if (scheduleriter == mutTaskSchedulers.end())
+    return s7_f(s7);
+  auto & mutScheduler = scheduleriter->second;
+  std::vector<s7_int> cancelled; // usually the one wait it is blocked on
+  for (auto mutIter = mutScheduler.waits.begin();
+       mutIter != mutScheduler.waits.end(); )
+    if (mutIter->second.task != std::get<0>(arghandle))
+      ++mutIter;
+    else {
+      s7_gc_unprotect_at(s7, mutIter->second.protectLoc);
+      cancelled.push_back(mutIter->first);
+      mutIter = mutScheduler.waits.erase(mutIter);
+    }
+  if (cancelled.empty())
+    return s7_f(s7);
+  auto const isCancelled = [&cancelled](s7_int const wait) {
+    return std::find(cancelled.begin(), cancelled.end(), wait) != cancelled.end();
+  };
+  auto & mutSleepers = mutScheduler.sleepers;
+  auto const sleepersEnd = std::remove_if(mutSleepers.begin(), mutSleepers.end(),
+    [&isCancelled](AboaUeTaskSleeper const & sleeper) {
+      return isCancelled(sleeper.wait);
+    });
+  if (sleepersEnd != mutSleepers.end()) {
+    mutSleepers.erase(sleepersEnd, mutSleepers.end());
+    std::make_heap(mutSleepers.begin(), mutSleepers.end(), task_sleeper_later);
+  }
+  auto & mutPolls = mutScheduler.polls;
+  mutPolls.erase(std::remove_if(mutPolls.begin(), mutPolls.end(), isCancelled),
+    mutPolls.end());
+  auto const busiter = mutEventBuses.find(s7);
+  if (busiter != mutEventBuses.end())
+    for (auto & mutChannel : busiter->second.channels)
+      mutChannel.taskWaits.erase(std::remove_if(mutChannel.taskWaits.begin(),
+        mutChannel.taskWaits.end(), isCancelled), mutChannel.taskWaits.end());
+    // ^ so a task cancelled while it waits leaves nothing to skip or to pile up
+  return s7_t(s7);
+}
+
+// timers for ue-after and ue-every sit in a hierarchical wheel of
+// four levels of 256 slots, each level 256 times coarser than the last,
+// so scheduling and cancelling are O(1) and a frame visits only the slots
+// of the milliseconds it covers, refiling a coarser slot into the finer
+// levels once each time a finer level wraps around
+static auto constexpr timer_tick_seconds = 0.001;
+static auto constexpr timer_wheel_bits   = 8;
+static auto constexpr timer_wheel_slots  = 1 << timer_wheel_bits;
+static auto constexpr timer_wheel_levels = 4;
+
+struct AboaUeTimer {
+  s7_pointer const proc;
+  s7_int     const protectLoc;
+  uint64           expires; // tick
+  uint64     const period;  // ticks, 0 fires once
+};
+
+struct AboaUeTimerWheel {
+  std::array<std::array<std::vector<s7_int>, timer_wheel_slots>,
+    timer_wheel_levels>                   slots;
+  std::unordered_map<s7_int, AboaUeTimer> timers;
+    // ^ a cancelled handle stays in its slot until the wheel reaches it
+  uint64                                  now = 0;
+  double                                  pendingSeconds = 0;
+    // ^ the part of the last frame short of a whole tick
+  s7_int                                  nextHandle = 1;
+};
+
+static std::map<s7_scheme const *, AboaUeTimerWheel> mutTimerWheels;
+
+static auto
+timer_wheel_file(
+  AboaUeTimerWheel &       mutWheel,
+  s7_int             const handle,
+  uint64             const expires
+) -> void {
+  auto const delta = std::min<uint64>(expires - mutWheel.now,
+    (uint64(1) << (timer_wheel_bits * timer_wheel_levels)) - 1);
+  auto mutLevel = 0;
+  while (delta >> (timer_wheel_bits * (mutLevel + 1)))
+    mutLevel++;
+  auto const slot = ((mutWheel.now + delta) >> (timer_wheel_bits * mutLevel))
+    & (timer_wheel_slots - 1);
+  mutWheel.slots[mutLevel][slot].push_back(handle);
+}
+
+static auto
+timer_wheel_advance(
+  AboaUeTimerWheel &       mutWheel,
+  std::vector<s7_int> &    mutDue
+) -> void {
+  mutWheel.now++;
+  for (auto mutLevel = 1; mutLevel < timer_wheel_levels; mutLevel++) {
+    if (mutWheel.now & ((uint64(1) << (timer_wheel_bits * mutLevel)) - 1))
+      break; // the finer level has not wrapped around
+    std::vector<s7_int> refiled;
+    refiled.swap(mutWheel.slots[mutLevel][
+      (mutWheel.now >> (timer_wheel_bits * mutLevel)) & (timer_wheel_slots - 1)]);
+    for (auto const handle : refiled) {
+      auto const iter = mutWheel.timers.find(handle);
+      if (iter != mutWheel.timers.end())
+        timer_wheel_file(mutWheel, handle, iter->second.expires);
+    }
+  }
+  auto & mutSlot = mutWheel.slots[0][mutWheel.now & (timer_wheel_slots - 1)];
+  for (auto const handle : mutSlot) {
+    auto const iter = mutWheel.timers.find(handle);
+    if (iter == mutWheel.timers.end())
+      continue; // cancelled
+    if (iter->second.expires <= mutWheel.now)
+      mutDue.push_back(handle);
+    else
+      timer_wheel_file(mutWheel, handle, iter->second.expires);
+        // ^ only when it was capped at the span of the wheel
+  }
+  mutSlot.clear();
+}
+
+static auto
+timer_wheel_schedule(
+  s7_scheme *  const s7,
+  s7_pointer   const args,
+  char const * const caller,
+  bool         const repeating
+) -> s7_pointer {
+  auto const argseconds = scheme_arg_real_or_error(
+    s7, s7_car(args), 1, "seconds");
+  if (argseconds.index() == 1)
+    return std::get<1>(argseconds).pointer;
+  auto const argproc = scheme_arg_procedure_or_error(
+    s7, s7_cadr(args), 2, "proc");
+  if (argproc.index() == 1)
+    return std::get<1>(argproc).pointer;
+  if (std::get<0>(argseconds) < 0)
+    return s7_out_of_range_error(s7, caller, 1, s7_car(args), "not negative");
+  auto const ticks = std::max<uint64>(1,
+    uint64(std::ceil(std::get<0>(argseconds) / timer_tick_seconds)));
+    // ^ never due before the next frame
+  auto const proc = std::get<0>(argproc).pointer;
+  auto & mutWheel = mutTimerWheels[s7];
+  auto const handle = mutWheel.nextHandle++;
+  mutWheel.timers.emplace(handle, AboaUeTimer{proc, s7_gc_protect(s7, proc),
+    mutWheel.now + ticks, repeating ? ticks : 0});
+    // ^ released after a single firing or by ue-cancel-timer or shutdownAboaUe(...)
+  timer_wheel_file(mutWheel, handle, mutWheel.now + ticks);
+  return s7_make_integer(s7, handle);
+}
+
+static auto const name_ue_after = "ue-after";
+static auto
+ue_after(s7_scheme * s7, s7_pointer args) -> s7_pointer {
+  return timer_wheel_schedule(s7, args, name_ue_after, false);
+}
+
+static auto const name_ue_every = "ue-every";
+static auto
+ue_every(s7_scheme * s7, s7_pointer args) -> s7_pointer {
+  return timer_wheel_schedule(s7, args, name_ue_every, true);
+}
+
+static auto const name_ue_cancel_timer = "ue-cancel-timer";
+static auto
+ue_cancel_timer(s7_scheme * s7, s7_pointer args) -> s7_pointer {
+  auto const arghandle = scheme_arg_integer_or_error(
+    s7, s7_car(args), 1, "handle");
+  if (arghandle.index() == 1)
+    return std::get<1>(arghandle).pointer;
+  auto const wheeliter = mutTimerWheels.find(s7);
+  if (wheeliter == mutTimerWheels.end())
+    return s7_f(s7);
+  auto & mutTimers = wheeliter->second.timers;
+  auto const iter = mutTimers.find(std::get<0>(arghandle));
+  if (iter == mutTimers.end())
+    return s7_f(s7);
+  s7_gc_unprotect_at(s7, iter->second.protectLoc);
+  mutTimers.erase(iter);
   return s7_t(s7);
 }
 
@@ -807,6 +1584,117 @@ ue_hook_on_world_added(s7_scheme * s7, s7_pointer args) -> s7_pointer {
 }
 #endif
 
+// each hook returns a handle for ue-hook-remove, which removes its
+// engine delegates and releases its handler, as does shutdownAboaUe(...);
+// hooking the same handler twice returns the existing handle
+enum struct AboaUeHookKind {
+  GameViewportSubsystemWidgetAdded, WorldBeginPlay, WorldEndPlay
+};
+
+struct AboaUeHook {
+  AboaUeHookKind  const kind;
+  s7_pointer      const proc;
+  s7_int          const protectLoc;
+  FDelegateHandle       delegate;
+  TWeakObjectPtr<UGameViewportSubsystem> viewportSubsystem;
+  std::vector<std::pair<TWeakObjectPtr<UWorld>, FDelegateHandle>> worldDelegates;
+};
+
+struct AboaUeHookRegistry {
+  std::map<s7_int, AboaUeHook> hooks;
+  s7_int                       nextHandle = 1;
+};
+
+static std::map<s7_scheme const *, AboaUeHookRegistry> mutHookRegistries;
+
+static auto
+hook_find(
+  s7_scheme *    const s7,
+  AboaUeHookKind const kind,
+  s7_pointer     const proc
+) -> s7_int {
+  auto const registryiter = mutHookRegistries.find(s7);
+  if (registryiter != mutHookRegistries.end())
+    for (auto const & entry : registryiter->second.hooks)
+      if (entry.second.kind == kind && entry.second.proc == proc)
+        return entry.first;
+  return 0;
+}
+
+static auto
+hook_add(
+  s7_scheme *    const s7,
+  AboaUeHookKind const kind,
+  s7_pointer     const proc
+) -> std::pair<s7_int, AboaUeHook &> {
+  auto & mutRegistry = mutHookRegistries[s7];
+  auto const handle = mutRegistry.nextHandle++;
+  auto & mutHook = mutRegistry.hooks.emplace(handle,
+    AboaUeHook{kind, proc, s7_gc_protect(s7, proc)}).first->second;
+  return {handle, mutHook};
+}
+
+static auto
+hook_release(
+  s7_scheme *  const s7,
+  AboaUeHook &       mutHook
+) -> void {
+  switch (mutHook.kind) {
+    case AboaUeHookKind::GameViewportSubsystemWidgetAdded : {
+      auto const ugvs = mutHook.viewportSubsystem.Get();
+      if (ugvs)
+        ugvs->OnWidgetAdded.Remove(mutHook.delegate);
+      break;
+    }
+    case AboaUeHookKind::WorldBeginPlay : {
+      FWorldDelegates::OnWorldInitializedActors.Remove(mutHook.delegate);
+      for (auto const & worldDelegate : mutHook.worldDelegates) {
+        auto const world = worldDelegate.first.Get();
+        if (world)
+          world->OnWorldBeginPlay.Remove(worldDelegate.second);
+      }
+      mutHook.worldDelegates.clear();
+      break;
+    }
+    case AboaUeHookKind::WorldEndPlay : {
+      FWorldDelegates::OnWorldBeginTearDown.Remove(mutHook.delegate);
+      break;
+    }
+  }
+  s7_gc_unprotect_at(s7, mutHook.protectLoc);
+}
+
+static auto
+hook_world_begin_play_attach(
+  s7_scheme * const s7,
+  s7_int      const handle,
+  UWorld &          mutWorld
+) -> void {
+  auto const registryiter = mutHookRegistries.find(s7);
+  if (registryiter == mutHookRegistries.end())
+    return;
+  auto const hookiter = registryiter->second.hooks.find(handle);
+  if (hookiter == registryiter->second.hooks.end())
+    return;
+  auto & mutWorldDelegates = hookiter->second.worldDelegates;
+  mutWorldDelegates.erase(
+    std::remove_if(mutWorldDelegates.begin(), mutWorldDelegates.end(),
+      [](std::pair<TWeakObjectPtr<UWorld>, FDelegateHandle> const & item) {
+        return !item.first.IsValid(); // !!! destroyed worlds took their delegates
+      }),
+    mutWorldDelegates.end());
+  for (auto const & worldDelegate : mutWorldDelegates)
+    if (worldDelegate.first.Get() == &mutWorld)
+      return; // already attached to this world
+  auto const handler = hookiter->second.proc;
+  auto const world = &mutWorld;
+  mutWorldDelegates.emplace_back(world,
+    mutWorld.OnWorldBeginPlay.AddLambda([s7, handler, world]() {
+      s7_apply_function(s7, handler,
+        s7_cons(s7, s7_make_c_pointer(s7, world), s7_nil(s7)));
+    }));
+}
+
 static auto const name_ue_hook_on_game_viewport_subsystem_widget_added
                     = "ue-hook-on-game-viewport-subsystem-widget-added";
 static auto            ue_hook_on_game_viewport_subsystem_widget_added(
@@ -817,16 +1705,21 @@ static auto            ue_hook_on_game_viewport_subsystem_widget_added(
   if (arghandler.index() == 1)
     return std::get<1>(arghandler).pointer;
   auto const handler = std::get<0>(arghandler).pointer;
-  s7_gc_protect(s7, handler); // TODO: @@@ PROTECTED INDEFINITELY
+  auto const kind = AboaUeHookKind::GameViewportSubsystemWidgetAdded;
+  auto const existing = hook_find(s7, kind, handler);
+  if (existing)
+    return s7_make_integer(s7, existing);
   auto const ugvs = UGameViewportSubsystem::Get();
   if (!ugvs)
     return s7_f(s7);
-  ugvs->OnWidgetAdded.AddLambda(
+  auto const added = hook_add(s7, kind, handler);
+  added.second.viewportSubsystem = ugvs;
+  added.second.delegate = ugvs->OnWidgetAdded.AddLambda(
     [s7, handler](UWidget* uwidget, ULocalPlayer* ulocalplayer) {
       s7_apply_function(s7, handler,
         s7_cons(s7, s7_make_c_pointer(s7, uwidget), s7_nil(s7)));
     });
-  return s7_t(s7);
+  return s7_make_integer(s7, added.first);
 }
 
 static auto const name_ue_hook_on_world_begin_play = "ue-hook-on-world-begin-play";
@@ -837,31 +1730,137 @@ ue_hook_on_world_begin_play(s7_scheme * s7, s7_pointer args) -> s7_pointer {
   if (arghandler.index() == 1)
     return std::get<1>(arghandler).pointer;
   auto const handler = std::get<0>(arghandler).pointer;
-  s7_gc_protect(s7, handler); // TODO: @@@ PROTECTED INDEFINITELY
+  auto const kind = AboaUeHookKind::WorldBeginPlay;
+  auto const existing = hook_find(s7, kind, handler);
+  if (existing)
+    return s7_make_integer(s7, existing);
 #if ALK_TRACING
   UE_LOG(LogAlkScheme, Display, TEXT("TRACE C++ %s"),
     ANSI_TO_TCHAR(name_ue_hook_on_world_begin_play));
 #endif
-  FWorldDelegates::OnWorldInitializedActors.AddLambda(
-    [s7, handler](const UWorld::FActorsInitializedParams & params) {
+  auto const added = hook_add(s7, kind, handler);
+  auto const handle = added.first;
+  added.second.delegate = FWorldDelegates::OnWorldInitializedActors.AddLambda(
+    [s7, handle](const UWorld::FActorsInitializedParams & params) {
 #if ALK_TRACING
       UE_LOG(LogAlkScheme, Display, TEXT("TRACE C++ on world actors initialized"));
 #endif
       auto const world = params.World;
       if (world)
-        world->OnWorldBeginPlay.AddLambda([s7, handler, world]() {
-          s7_apply_function(s7, handler,
-            s7_cons(s7, s7_make_c_pointer(s7, world), s7_nil(s7)));
-        });
+        hook_world_begin_play_attach(s7, handle, *world);
     });
   ApplyLambdaOnAllWorlds([s7, handler](UWorld & mutWorld) {
     if (mutWorld.HasBegunPlay())
       s7_apply_function(s7, handler,
         s7_cons(s7, s7_make_c_pointer(s7, &mutWorld), s7_nil(s7)));
   });
+  return s7_make_integer(s7, handle);
+}
+
+static auto const name_ue_hook_on_world_end_play = "ue-hook-on-world-end-play";
+static auto
+ue_hook_on_world_end_play(s7_scheme * s7, s7_pointer args) -> s7_pointer {
+  auto const arghandler = scheme_arg_procedure_or_error(
+    s7, s7_car(args), 1, "handler");
+  if (arghandler.index() == 1)
+    return std::get<1>(arghandler).pointer;
+  auto const handler = std::get<0>(arghandler).pointer;
+  auto const kind = AboaUeHookKind::WorldEndPlay;
+  auto const existing = hook_find(s7, kind, handler);
+  if (existing)
+    return s7_make_integer(s7, existing);
+  auto const added = hook_add(s7, kind, handler);
+  added.second.delegate = FWorldDelegates::OnWorldBeginTearDown.AddLambda(
+    [s7, handler](UWorld * const world) {
+      if (world && world->HasBegunPlay())
+        s7_apply_function(s7, handler,
+          s7_cons(s7, s7_make_c_pointer(s7, world), s7_nil(s7)));
+    }); // ^ the worlds that began play, so each pairs with a begin-play call
+  return s7_make_integer(s7, added.first);
+}
+
+static auto const name_ue_hook_remove = "ue-hook-remove";
+static auto
+ue_hook_remove(s7_scheme * s7, s7_pointer args) -> s7_pointer {
+  auto const arghandle = scheme_arg_integer_or_error(
+    s7, s7_car(args), 1, "handle");
+  if (arghandle.index() == 1)
+    return std::get<1>(arghandle).pointer;
+  auto const registryiter = mutHookRegistries.find(s7);
+  if (registryiter == mutHookRegistries.end())
+    return s7_f(s7);
+  auto & mutHooks = registryiter->second.hooks;
+  auto const hookiter = mutHooks.find(std::get<0>(arghandle));
+  if (hookiter == mutHooks.end())
+    return s7_f(s7);
+  hook_release(s7, hookiter->second);
+  mutHooks.erase(hookiter);
   return s7_t(s7);
 }
 
+// a boot image keeps the hooks as (next-handle (name handle proc) ...),
+// restoring one hooks each proc again under the handle it had
+static struct {
+  AboaUeHookKind const kind;
+  char const *   const name;
+  s7_function    const hook;
+} const hook_kinds[] = {
+  { AboaUeHookKind::GameViewportSubsystemWidgetAdded,
+    name_ue_hook_on_game_viewport_subsystem_widget_added,
+         ue_hook_on_game_viewport_subsystem_widget_added },
+  { AboaUeHookKind::WorldBeginPlay,
+    name_ue_hook_on_world_begin_play, ue_hook_on_world_begin_play },
+  { AboaUeHookKind::WorldEndPlay,
+    name_ue_hook_on_world_end_play, ue_hook_on_world_end_play }};
+
+static auto
+hook_registry_image(s7_scheme * const s7) -> s7_pointer {
+  auto const registryiter = mutHookRegistries.find(s7);
+  if (registryiter == mutHookRegistries.end())
+    return s7_list(s7, 1, s7_make_integer(s7, 1));
+  s7rootFrame mutRoots(s7);
+  auto mutEntries = s7_nil(s7);
+  for (auto const & entry : registryiter->second.hooks)
+    for (auto const & kind : hook_kinds)
+      if (kind.kind == entry.second.kind)
+        mutEntries = mutRoots.root(s7_cons(s7,
+          s7_list(s7, 3, s7_make_symbol(s7, kind.name),
+            s7_make_integer(s7, entry.first), entry.second.proc),
+          mutEntries));
+  auto const entries = mutRoots.root(s7_reverse(s7, mutEntries));
+  return s7_cons(s7, mutRoots.root(
+    s7_make_integer(s7, registryiter->second.nextHandle)), entries);
+}
+
+static auto
+hook_registry_restore(
+  s7_scheme *  const s7,
+  s7_pointer   const image
+) -> bool {
+  if (!s7_is_pair(image) || !s7_is_integer(s7_car(image)))
+    return false;
+  for (auto mutEntry = s7_cdr(image);
+       s7_is_pair(mutEntry);
+       mutEntry = s7_cdr(mutEntry)) {
+    auto const entry = s7_car(mutEntry);
+    if (s7_list_length(s7, entry) != 3 || !s7_is_symbol(s7_car(entry))
+        || !s7_is_integer(s7_cadr(entry)))
+      return false;
+  }
+  for (auto mutEntry = s7_cdr(image);
+       s7_is_pair(mutEntry);
+       mutEntry = s7_cdr(mutEntry)) {
+    auto const entry = s7_car(mutEntry);
+    for (auto const & kind : hook_kinds)
+      if (FCStringAnsi::Strcmp(kind.name, s7_symbol_name(s7_car(entry))) == 0) {
+        mutHookRegistries[s7].nextHandle = s7_integer(s7_cadr(entry));
+        kind.hook(s7, s7_cdr(s7_cdr(entry)));
+      }
+  }
+  mutHookRegistries[s7].nextHandle = s7_integer(s7_car(image));
+  return true;
+}
+
 static auto const name_ue_log = "ue-log";
 static auto
 ue_log(s7_scheme * s7, s7_pointer args) -> s7_pointer {
@@ -1195,12 +2194,135 @@ static auto function_help_string(
   return std::string("(") + name + args + ")";
 }
 
-auto bootAboaUe() -> AboaUeMutant {
-  auto s7session = s7_init();
+static auto report_heap_resize(
+  s7_scheme *  const s7,
+  s7_int const oldSize,
+  s7_int const newSize,
+  s7_double const seconds
+) -> void {
+  SET_DWORD_STAT(STAT_AboaHeapCells, newSize);
+  INC_DWORD_STAT(STAT_AboaHeapResizes);
+  INC_FLOAT_STAT_BY(STAT_AboaHeapResizeMs, seconds * 1000.0);
+  UE_LOG(LogAlkScheme, Verbose, TEXT("s7 heap %s from %lld to %lld cells in %.3f ms"),
+    newSize < oldSize ? TEXT("shrank") : TEXT("grew"),
+    static_cast<long long>(oldSize), static_cast<long long>(newSize), seconds * 1000.0)
+}
+
+static auto allocate_slab(
+  void * const,
+  size_t const bytes,
+  size_t const alignment
+) -> void * {
+  LLM_SCOPE_BYTAG(AboaUE);
+  INC_MEMORY_STAT_BY(STAT_AboaSlabBytes, bytes);
+  return FMemory::Malloc(bytes, alignment);
+}
+
+static auto free_slab(
+  void * const,
+  void * const slab,
+  size_t const bytes
+) -> void {
+  DEC_MEMORY_STAT_BY(STAT_AboaSlabBytes, bytes);
+  FMemory::Free(slab);
+}
+
+static s7_allocator_t const fmemorySlabs = { allocate_slab, free_slab, nullptr };
+  // ^ the s7 blocks outside the cell heap (strings, vectors, tables, ports)
+  //   come from these, so they show under LLM's AboaUE tag
+
+static auto compiledModules()
+  -> std::vector<std::pair<char const *, AboaUeCompiledDefine>> & {
+  static std::vector<std::pair<char const *, AboaUeCompiledDefine>> mutModules;
+  return mutModules;
+} // ^ a function static, since the modules register during static init
+
+AboaUeCompiledModule::AboaUeCompiledModule(
+  char const *         const name,
+  AboaUeCompiledDefine const define
+) {
+  compiledModules().emplace_back(name, define);
+}
+
+static auto loadAboaUeBootImage(
+  AboaUeMutant const & mutant,
+  AboaUeCode   const & code,
+  FString      const & imagePath
+) -> bool {
+  // the file is the CityHash64 of the boot source it was made from, then the s7 image
+  TArray<uint8> mutFile;
+  uint64 const hash = CityHash64(code.source->data(), code.source->size());
+  if (!FFileHelper::LoadFileToArray(mutFile, *imagePath, FILEREAD_Silent)
+   || mutFile.Num() <= static_cast<int32>(sizeof(hash))
+   || FMemory::Memcmp(mutFile.GetData(), &hash, sizeof(hash)) != 0)
+    return false; // missing, or boot.aboa changed since
+  auto const s7 = mutant.s7session;
+  s7rootFrame mutRoots(s7);
+  auto const hooks = s7_load_rootlet_image(s7,
+    mutFile.GetData() + sizeof(hash), mutFile.Num() - sizeof(hash));
+  if (!hooks)
+    return false; // damaged, or made by another s7 build
+  if (!hook_registry_restore(s7, mutRoots.root(hooks))) {
+    UE_LOG(LogAlkScheme, Warning, TEXT("%s holds malformed hooks"), *imagePath)
+    return false;
+  }
+  UE_LOG(LogAlkScheme, Log, TEXT("Scheme session booted from %s"), *imagePath)
+  return true;
+}
+
+static auto saveAboaUeBootImage(
+  AboaUeMutant const & mutant,
+  AboaUeCode   const & code,
+  FString      const & imagePath,
+  s7_pointer   const   rootletBefore
+) -> void {
+  auto const s7 = mutant.s7session;
+  auto mutWorldBegunPlay = false;
+  ApplyLambdaOnAllWorlds([&mutWorldBegunPlay](UWorld & mutWorld) {
+    mutWorldBegunPlay |= mutWorld.HasBegunPlay();
+  });
+  if (mutWorldBegunPlay
+   || mutInputQueues.count(s7) || mutEventBuses.count(s7)
+   || mutTimerWheels.count(s7) || mutTaskSchedulers.count(s7)
+   || mutCallRegistries.count(s7)) {
+    UE_LOG(LogAlkScheme, Log,
+      TEXT("boot.aboa left input, events, timers, tasks or begun worlds, it will boot from source"))
+    return;
+  } // ^ only the rootlet and the hooks can be imaged, the rest lives in the engine
+  s7rootFrame mutRoots(s7);
+  auto const image = mutRoots.root(s7_rootlet_image(s7, rootletBefore,
+    mutRoots.root(hook_registry_image(s7))));
+  if (!s7_is_byte_vector(image)) {
+    UE_LOG(LogAlkScheme, Log,
+      TEXT("boot.aboa binds a value that cannot be imaged, it will boot from source"))
+    return;
+  }
+  TArray<uint8> mutFile;
+  uint64 const hash = CityHash64(code.source->data(), code.source->size());
+  mutFile.Append(reinterpret_cast<uint8 const *>(&hash), sizeof(hash));
+  mutFile.Append(s7_byte_vector_elements(image), s7_vector_length(image));
+  if (!FFileHelper::SaveArrayToFile(mutFile, *imagePath))
+    UE_LOG(LogAlkScheme, Warning, TEXT("Failed to write %s"), *imagePath)
+}
+
+auto bootAboaUe(
+  AboaUeHeapPolicy const & heapPolicy,
+  FString          const & codeCacheDir,
+  FString          const & bootImagePath
+) -> AboaUeMutant {
+  s7_set_allocator(nullptr, &fmemorySlabs); // before init, so it covers init
+  auto s7session = s7_init_with_heap_size(heapPolicy.initialSize);
   if (!s7session) {
     UE_LOG(LogAlkScheme, Error, TEXT("Failed to init s7 Scheme"))
     return {};
   }
+  SET_DWORD_STAT(STAT_AboaHeapCells, s7_integer(s7_let_field_ref(s7session,
+    s7_make_symbol(s7session, "heap-size"))));
+  s7_set_heap_resize_hook(s7session, report_heap_resize);
+  s7_set_heap_growth_factor(s7session, heapPolicy.growthFactor);
+  if (heapPolicy.maxSize > 0)
+    s7_let_field_set(s7session, s7_make_symbol(s7session, "max-heap-size"),
+      s7_make_integer(s7session, heapPolicy.maxSize));
   s7_define_function(s7session,
     name_ue_actor_attach_to_actor,
          ue_actor_attach_to_actor,
@@ -1284,6 +2406,45 @@ auto bootAboaUe() -> AboaUeMutant {
   s7_define_function(s7session,
     name_ue_bind_input_touch, ue_bind_input_touch, 3, 0, false,
     function_help_string(name_ue_bind_input_touch, " world event handler").c_str());
+  s7_define_function(s7session,
+    name_ue_unbind_input, ue_unbind_input, 1, 0, false,
+    function_help_string(name_ue_unbind_input, " handle").c_str());
+  s7_define_function(s7session,
+    name_ue_event_subscribe, ue_event_subscribe, 2, 0, false,
+    function_help_string(name_ue_event_subscribe, " channel handler").c_str());
+  s7_define_function(s7session,
+    name_ue_event_unsubscribe, ue_event_unsubscribe, 1, 0, false,
+    function_help_string(name_ue_event_unsubscribe, " handle").c_str());
+  s7_define_function(s7session,
+    name_ue_event_publish, ue_event_publish, 2, 0, false,
+    function_help_string(name_ue_event_publish, " channel args").c_str());
+  s7_define_function(s7session,
+    name_ue_event_post, ue_event_post, 2, 0, false,
+    function_help_string(name_ue_event_post, " channel args").c_str());
+  s7_define_function(s7session,
+    name_ue_task_spawn, ue_task_spawn, 1, 0, false,
+    function_help_string(name_ue_task_spawn, " thunk").c_str());
+  s7_define_function(s7session,
+    name_ue_task_wait_seconds, ue_task_wait_seconds, 2, 0, false,
+    function_help_string(name_ue_task_wait_seconds, " seconds proc").c_str());
+  s7_define_function(s7session,
+    name_ue_task_wait_until, ue_task_wait_until, 2, 0, false,
+    function_help_string(name_ue_task_wait_until, " condition proc").c_str());
+  s7_define_function(s7session,
+    name_ue_task_wait_event, ue_task_wait_event, 2, 0, false,
+    function_help_string(name_ue_task_wait_event, " channel proc").c_str());
+  s7_define_function(s7session,
+    name_ue_task_cancel, ue_task_cancel, 1, 0, false,
+    function_help_string(name_ue_task_cancel, " handle").c_str());
+  s7_define_function(s7session,
+    name_ue_after, ue_after, 2, 0, false,
+    function_help_string(name_ue_after, " seconds proc").c_str());
+  s7_define_function(s7session,
+    name_ue_every, ue_every, 2, 0, false,
+    function_help_string(name_ue_every, " seconds proc").c_str());
+  s7_define_function(s7session,
+    name_ue_cancel_timer, ue_cancel_timer, 1, 0, false,
+    function_help_string(name_ue_cancel_timer, " handle").c_str());
   s7_define_function(s7session,
     name_ue_find_uclass_by_name,
          ue_find_uclass_by_name,
@@ -1306,6 +2467,12 @@ auto bootAboaUe() -> AboaUeMutant {
   s7_define_function(s7session,
     name_ue_hook_on_world_begin_play, ue_hook_on_world_begin_play, 1, 0, false,
     function_help_string(name_ue_hook_on_world_begin_play, " handler").c_str());
+  s7_define_function(s7session,
+    name_ue_hook_on_world_end_play, ue_hook_on_world_end_play, 1, 0, false,
+    function_help_string(name_ue_hook_on_world_end_play, " handler").c_str());
+  s7_define_function(s7session,
+    name_ue_hook_remove, ue_hook_remove, 1, 0, false,
+    function_help_string(name_ue_hook_remove, " handle").c_str());
   s7_define_function(s7session,
     name_ue_log, ue_log, 1, 0, false,
     function_help_string(name_ue_log, " string").c_str());
@@ -1394,6 +2561,13 @@ auto bootAboaUe() -> AboaUeMutant {
     name_ue_world_current_spawn_actor,
       " class location rotation").c_str());
 
+  for (auto const & module : compiledModules()) {
+    module.second(s7session);
+    UE_LOG(LogAlkScheme, Log, TEXT("Defined compiled Aboa module %s"),
+      ANSI_TO_TCHAR(module.first))
+  }
+    // ^ before boot.aboa, which can still redefine them interpreted
+
   FString const scmPath = PluginSubpath(
     ANSI_TO_TCHAR("AboaUE"),
     ANSI_TO_TCHAR("Source/aboa"));
@@ -1414,21 +2588,366 @@ auto bootAboaUe() -> AboaUeMutant {
 #endif
   AboaUeMutant const mutant = {{scmPath}, s7session};
   auto const code = loadAboaUeCode(
-    FPaths::Combine(scmPath, TEXT("boot.aboa")));
-  if (!code.source.IsEmpty()) {
+    FPaths::Combine(scmPath, TEXT("boot.aboa")), codeCacheDir);
+  if (code.source->empty()
+   || (!bootImagePath.IsEmpty()
+       && loadAboaUeBootImage(mutant, code, bootImagePath)))
+    return mutant;
+  if (bootImagePath.IsEmpty()) {
     auto result = runAboaUeCode(mutant, code);
     UE_LOG(LogAlkScheme, Log, TEXT("Scheme session booted: %s"),
       *stringFromAboaUeDataDict(result, "result")
     );
+    return mutant;
   }
+  auto const rootletBefore = s7_rootlet_values(s7session);
+  auto const rootletBeforeLoc = s7_gc_protect(s7session, rootletBefore);
+    // ^ whatever boot.aboa binds or rebinds differs from this
+  auto mutRecord = s7_f(s7session);
+  auto const result = s7_load_c_string_record(
+    s7session, code.source->c_str(), code.source->size(), &mutRecord);
+  auto const bootedWhole = s7_is_pair(mutRecord);
+    // ^ the record is #f when an error cut the boot short
+  auto const text = s7_object_to_c_string(s7session, result);
+  UE_LOG(LogAlkScheme, Log, TEXT("Scheme session booted: %s"), ANSI_TO_TCHAR(text))
+  free(text);
+  if (bootedWhole)
+    saveAboaUeBootImage(mutant, code, bootImagePath, rootletBefore);
+  s7_gc_unprotect_at(s7session, rootletBeforeLoc);
   return mutant;
 }
 
-auto loadAboaUeCode(FString const &path) -> AboaUeCode {
-  FString mutSource;
-  if (!FFileHelper::LoadFileToString(mutSource, *path, FFileHelper::EHashOptions::None))
+auto releaseAboaUeSlabs(AboaUeMutant const & mutant) -> void {
+  auto const released = s7_gc_release_slabs(mutant.s7session);
+  if (released == 0 || !UE_LOG_ACTIVE(LogAlkScheme, Verbose))
+    return;
+  std::array<s7_slab_stats_t, 16> mutStats;
+  auto const classes = s7_slab_stats(mutant.s7session,
+    mutStats.data(), mutStats.size());
+  FString mutOccupancy;
+  for (s7_int mutI = 0; mutI < classes; mutI++)
+    if (mutStats[mutI].slabs > 0)
+      mutOccupancy += FString::Printf(TEXT(" %lld:%lld/%lld"),
+        static_cast<long long>(mutStats[mutI].chunk_bytes),
+        static_cast<long long>(mutStats[mutI].chunks - mutStats[mutI].free_chunks),
+        static_cast<long long>(mutStats[mutI].chunks));
+  UE_LOG(LogAlkScheme, Verbose,
+    TEXT("s7 released %lld bytes of empty slabs, bytes:used/carved%s"),
+    static_cast<long long>(released), *mutOccupancy)
+}
+
+auto shutdownAboaUe(AboaUeMutant const & mutant) -> void {
+  auto const s7 = mutant.s7session;
+  auto const busiter = mutEventBuses.find(s7);
+  if (busiter != mutEventBuses.end()) {
+    auto & mutBus = busiter->second;
+    auto const channeliter = mutBus.channelIndices.find(
+      s7_make_symbol(s7, "shutdown"));
+    if (channeliter != mutBus.channelIndices.end())
+      event_bus_publish(s7, mutBus, channeliter->second, s7_nil(s7), 0);
+    for (auto const & deferred : mutBus.deferred)
+      s7_gc_unprotect_at(s7, deferred.protectLoc);
+    for (auto const & channel : mutBus.channels)
+      for (auto const & subscriber : channel.subscribers)
+        s7_gc_unprotect_at(s7, subscriber.protectLoc);
+    mutEventBuses.erase(busiter);
+  }
+  auto const wheeliter = mutTimerWheels.find(s7);
+  if (wheeliter != mutTimerWheels.end()) {
+    for (auto const & timer : wheeliter->second.timers)
+      s7_gc_unprotect_at(s7, timer.second.protectLoc);
+    mutTimerWheels.erase(wheeliter);
+  }
+  auto const scheduleriter = mutTaskSchedulers.find(s7);
+  if (scheduleriter != mutTaskSchedulers.end()) {
+    for (auto const & wait : scheduleriter->second.waits)
+      s7_gc_unprotect_at(s7, wait.second.protectLoc);
+    mutTaskSchedulers.erase(scheduleriter);
+  }
+  auto const calliter = mutCallRegistries.find(s7);
+  if (calliter != mutCallRegistries.end()) {
+    for (auto const & callee : calliter->second.callees)
+      if (callee.second.thunk)
+        s7_gc_unprotect_at(s7, callee.second.protectLoc);
+    if (calliter->second.errorHandler) {
+      s7_gc_unprotect_at(s7, calliter->second.errorHandlerLoc);
+      s7_gc_unprotect_at(s7, calliter->second.errorFormatterLoc);
+    }
+    mutCallRegistries.erase(calliter);
+  }
+  auto const registryiter = mutHookRegistries.find(s7);
+  if (registryiter != mutHookRegistries.end()) {
+    for (auto & entry : registryiter->second.hooks)
+      hook_release(s7, entry.second);
+    mutHookRegistries.erase(registryiter);
+  }
+  auto const queueiter = mutInputQueues.find(s7);
+  if (queueiter != mutInputQueues.end()) {
+    while (!queueiter->second.bindings.empty())
+      queueiter->second.bindings.begin()->second->Unbind();
+    mutInputQueues.erase(queueiter);
+  }
+}
+
+auto dispatchAboaUeEvents(
+  AboaUeMutant const & mutant,
+  int64        const   stepBudget
+) -> void {
+  auto const s7 = mutant.s7session;
+  auto const busiter = mutEventBuses.find(s7);
+  if (busiter == mutEventBuses.end() || busiter->second.deferred.empty())
+    return;
+  auto & mutBus = busiter->second;
+  std::vector<AboaUeEventDeferred> deferred;
+  deferred.swap(mutBus.deferred);
+    // ^ events posted while we dispatch are delivered next frame
+  for (auto const & event : deferred)
+    event_bus_publish(s7, mutBus, event.channel, event.args, stepBudget);
+  for (auto const & event : deferred)
+    s7_gc_unprotect_at(s7, event.protectLoc);
+}
+
+auto dispatchAboaUeTimers(
+  AboaUeMutant const & mutant,
+  float        const   deltaSeconds,
+  int64        const   stepBudget
+) -> void {
+  auto const s7 = mutant.s7session;
+  auto const wheeliter = mutTimerWheels.find(s7);
+  if (wheeliter == mutTimerWheels.end())
+    return;
+  auto & mutWheel = wheeliter->second;
+  mutWheel.pendingSeconds += deltaSeconds;
+  auto const ticks = uint64(mutWheel.pendingSeconds / timer_tick_seconds);
+  mutWheel.pendingSeconds -= ticks * timer_tick_seconds;
+  if (mutWheel.timers.empty()) {
+    mutWheel.now += ticks;
+    return; // !!! only cancelled handles can be left in the slots
+  }
+  std::vector<s7_int> due;
+  for (uint64 mutI = 0; mutI < ticks; mutI++)
+    timer_wheel_advance(mutWheel, due);
+  for (auto const handle : due) {
+    auto iter = mutWheel.timers.find(handle);
+    if (iter == mutWheel.timers.end())
+      continue; // cancelled by a callback earlier in the batch
+    s7rootFrame mutRoots(s7);
+    auto const proc = mutRoots.root(iter->second.proc);
+    if (iter->second.period == 0) {
+      s7_gc_unprotect_at(s7, iter->second.protectLoc);
+      mutWheel.timers.erase(iter);
+    }
+    call_caught(s7, proc, s7_nil(s7), stepBudget, TEXT("Timer"), handle);
+      // ^ an error in one callback does not stop the batch
+    iter = mutWheel.timers.find(handle);
+    if (iter == mutWheel.timers.end())
+      continue; // fired once or cancelled itself
+    auto & mutTimer = iter->second;
+    mutTimer.expires = std::max(
+      mutTimer.expires + mutTimer.period, mutWheel.now + 1);
+      // ^ after a long frame repeats once instead of catching up
+    timer_wheel_file(mutWheel, handle, mutTimer.expires);
+  }
+}
+
+auto dispatchAboaUeTasks(
+  AboaUeMutant const & mutant,
+  float        const   deltaSeconds,
+  int64        const   stepBudget
+) -> void {
+  auto const s7 = mutant.s7session;
+  auto const scheduleriter = mutTaskSchedulers.find(s7);
+  if (scheduleriter == mutTaskSchedulers.end())
+    return;
+  auto & mutScheduler = scheduleriter->second;
+  mutScheduler.clock += deltaSeconds;
+  std::vector<s7_int> woken;
+  while (!mutScheduler.sleepers.empty()
+      && mutScheduler.sleepers.front().wakeTime <= mutScheduler.clock) {
+    std::pop_heap(mutScheduler.sleepers.begin(), mutScheduler.sleepers.end(),
+      task_sleeper_later);
+    woken.push_back(mutScheduler.sleepers.back().wait);
+    mutScheduler.sleepers.pop_back();
+  }
+    // ^ collected first so a task that waits 0 seconds again wakes next frame
+  for (auto const wait : woken)
+    task_resume(s7, mutScheduler, wait, s7_nil(s7), stepBudget);
+  if (mutScheduler.polls.empty())
+    return;
+  std::vector<s7_int> polls;
+  polls.swap(mutScheduler.polls);
+  std::vector<s7_int> mutWaiting;
+  for (auto const wait : polls) {
+    auto const iter = mutScheduler.waits.find(wait);
+    if (iter == mutScheduler.waits.end())
+      continue; // cancelled
+    auto const holds = call_caught(s7, iter->second.condition, s7_nil(s7),
+      stepBudget, TEXT("Wait-until condition of task"), iter->second.task);
+    if (!holds) {
+      auto const raisediter = mutScheduler.waits.find(wait);
+        // ^ !!! the condition may have added waits and rehashed them
+      if (raisediter != mutScheduler.waits.end()) {
+        s7_gc_unprotect_at(s7, raisediter->second.protectLoc);
+        mutScheduler.waits.erase(raisediter);
+      }
+    } // ^ the condition would raise again every frame
+    else if (holds != s7_f(s7))
+      task_resume(s7, mutScheduler, wait, s7_nil(s7), stepBudget);
+    else
+      mutWaiting.push_back(wait);
+  }
+  mutWaiting.insert(mutWaiting.end(),
+    mutScheduler.polls.begin(), mutScheduler.polls.end());
+    // ^ started waiting while we polled, first polled next frame
+  mutScheduler.polls.swap(mutWaiting);
+}
+
+auto dispatchAboaUeInput(
+  AboaUeMutant const & mutant,
+  int64        const   stepBudget
+) -> void {
+  auto const s7 = mutant.s7session;
+  auto const queueiter = mutInputQueues.find(s7);
+  if (queueiter == mutInputQueues.end() || queueiter->second.records.empty())
+    return;
+  auto & mutQueue = queueiter->second;
+  std::vector<AboaUeInputRecord> records;
+  records.swap(mutQueue.records);
+    // ^ !!! handlers may bind or unbind while we dispatch
+  std::vector<s7_int> handles; // one per distinct handler in arrival order
+  std::vector<s7_pointer> handlers;
+  for (auto const & record : records) {
+    auto const bindingiter = mutQueue.bindings.find(record.handle);
+    if (bindingiter == mutQueue.bindings.end())
+      continue; // unbound since the event arrived
+    auto const handler = bindingiter->second->Handler();
+    if (std::find(handlers.begin(), handlers.end(), handler) == handlers.end()) {
+      handles.push_back(record.handle);
+      handlers.push_back(handler);
+    }
+  }
+  for (size_t mutI = 0; mutI < handlers.size(); mutI++) {
+    if (mutQueue.bindings.find(handles[mutI]) == mutQueue.bindings.end())
+      continue; // !!! unbound by a handler called earlier, so maybe not protected
+    auto const handler = handlers[mutI];
+    s7_int mutCount = 0;
+    for (auto const & record : records) {
+      auto const bindingiter = mutQueue.bindings.find(record.handle);
+      if (bindingiter != mutQueue.bindings.end()
+       && bindingiter->second->Handler() == handler)
+        mutCount++;
+    }
+    auto const s7vec = s7_make_float_vector(
+      s7, mutCount * input_record_stride, 1, nullptr);
+    auto mutElements = s7_float_vector_elements(s7vec);
+    for (auto const & record : records) {
+      auto const bindingiter = mutQueue.bindings.find(record.handle);
+      if (bindingiter == mutQueue.bindings.end()
+       || bindingiter->second->Handler() != handler)
+        continue;
+      *mutElements++ = record.handle;
+      *mutElements++ = record.kind;
+      *mutElements++ = record.finger;
+      *mutElements++ = record.location.X;
+      *mutElements++ = record.location.Y;
+      *mutElements++ = record.location.Z;
+    }
+    call_caught(s7, handler, s7_cons(s7, s7vec, s7_nil(s7)), stepBudget,
+      TEXT("Input binding"), handles[mutI]);
+  }
+}
+
+auto loadAboaUeCode(
+  FString const &path,
+  FString const &cacheDir
+) -> AboaUeCode {
+  // reads the file straight into the one buffer the reader will scan,
+  // std::string keeps the NUL after it that s7_load_c_string requires
+  auto mutSource = std::make_shared<std::string>();
+  TUniquePtr<IFileHandle> const file(
+    FPlatformFileManager::Get().GetPlatformFile().OpenRead(*path));
+  if (!file)
     UE_LOG(LogAlkScheme, Error, TEXT("Failed to read %s"), *path)
-  return {path, mutSource};
+  else {
+    auto const size = file->Size();
+    uint8 bom[3] = {};
+    auto const hasBom = size >= 3 && file->Read(bom, 3)
+      && bom[0] == 0xEF && bom[1] == 0xBB && bom[2] == 0xBF;
+    if (!hasBom)
+      file->Seek(0);
+    mutSource->resize(size - (hasBom ? 3 : 0));
+    if (!file->Read(
+          reinterpret_cast<uint8 *>(mutSource->data()), mutSource->size())) {
+      UE_LOG(LogAlkScheme, Error, TEXT("Failed to read %s"), *path)
+      mutSource->clear();
+    }
+  }
+  if (cacheDir.IsEmpty() || mutSource->empty())
+    return {path, std::move(mutSource), nullptr};
+  auto const pathHash = static_cast<unsigned long long>(CityHash64(
+    reinterpret_cast<char const *>(*path), path.Len() * sizeof(TCHAR)));
+  auto mutForms = std::make_shared<AboaUeCodeForms>(AboaUeCodeForms{
+    FPaths::Combine(cacheDir, FString::Printf(TEXT("%016llx-%016llx.forms"),
+      pathHash, static_cast<unsigned long long>(
+        CityHash64(mutSource->data(), mutSource->size())))),
+    FString::Printf(TEXT("%016llx-*.forms"), pathHash)});
+  FFileHelper::LoadFileToArray(
+    mutForms->image, *mutForms->cachePath, FILEREAD_Silent);
+    // ^ a miss leaves it empty, the first run fills it
+  return {path, std::move(mutSource), std::move(mutForms)};
+}
+
+static auto saveAboaUeCodeForms(
+  AboaUeCodeForms & mutForms
+) -> void {
+  if (!FFileHelper::SaveArrayToFile(mutForms.image, *mutForms.cachePath)) {
+    UE_LOG(LogAlkScheme, Warning, TEXT("Failed to write %s"), *mutForms.cachePath)
+    return;
+  }
+  auto const dir = FPaths::GetPath(mutForms.cachePath);
+  auto const current = FPaths::GetCleanFilename(mutForms.cachePath);
+  TArray<FString> mutStale;
+  IFileManager::Get().FindFiles(
+    mutStale, *FPaths::Combine(dir, mutForms.staleFiles), true, false);
+  for (auto & stale : mutStale)
+    if (stale != current)
+      IFileManager::Get().Delete(*FPaths::Combine(dir, stale), false, false, true);
+      // ^ the forms of earlier revisions of this script
+}
+
+static auto evalAboaUeCodeForms(
+  AboaUeMutant  const & mutant,
+  AboaUeCode    const & code
+) -> s7_pointer {
+  auto const s7 = mutant.s7session;
+  auto & mutForms = *code.forms;
+  auto const & source = *code.source;
+  s7rootFrame mutRoots(s7);
+  auto const record = mutForms.image.Num() > 0
+    ? s7_image_read(s7, mutForms.image.GetData(), mutForms.image.Num())
+    : nullptr;
+    // ^ null too when the file is damaged or was made by another s7 build
+  if (record)
+    return s7_load_c_string_replay(
+      s7, source.c_str(), source.size(), mutRoots.root(record));
+      // ^ errors report the lines a load of the source would
+  auto mutRecord = s7_f(s7);
+  auto const result = mutRoots.root(s7_load_c_string_record(
+    s7, source.c_str(), source.size(), &mutRecord));
+    // ^ evaluates each form as it is read, as a plain load does
+  mutForms.image.Reset();
+  if (!s7_is_pair(mutRecord)
+      || !s7_is_null(s7, s7_name_to_value(s7, "*$readers*")))
+    return result;
+    // ^ a load cut short by an error is not cached, nor are forms a
+    //   reader macro made, which might read differently next time
+  auto const image = s7_image_write(s7, mutRoots.root(mutRecord));
+  if (s7_is_byte_vector(image)) {
+    mutForms.image.Append(
+      s7_byte_vector_elements(image), s7_vector_length(image));
+    saveAboaUeCodeForms(mutForms);
+  }
+  return result;
 }
 
 auto makeAboaUeResult(
@@ -1451,13 +2970,39 @@ auto makeAboaUeResult(
   return makeAboaUeDataDict({{"result", ref}});
 }
 
+auto resetAboaUeCallErrors(AboaUeMutant const & mutant) -> void {
+  auto const calliter = mutCallRegistries.find(mutant.s7session);
+  if (calliter == mutCallRegistries.end())
+    return;
+  for (auto & entry : calliter->second.callees) {
+    auto & mutCallee = entry.second;
+    if (mutCallee.suspended)
+      UE_LOG(LogAlkScheme, Log,
+        TEXT("Resuming %s after skipping %lld calls"),
+        ANSI_TO_TCHAR(entry.first.c_str()),
+        static_cast<long long>(mutCallee.skipped))
+    mutCallee.errors = 0;
+    mutCallee.suspended = false;
+    mutCallee.skipped = 0;
+  }
+}
+
 auto callAboaUeCode(
-  AboaUeMutant    const & mutant,
-  FString         const & callee,
-  AboaUeDataDict  const & args
+  AboaUeMutant      const & mutant,
+  FString           const & callee,
+  AboaUeDataDict    const & args,
+  AboaUeCallOptions const & options
 ) -> AboaUeDataDict {
-  auto mutCallExpr = std::string("(") + TCHAR_TO_ANSI(*callee);
-  std::stack<s7_int> mutProtectStack;
+  auto const calleeName = std::string(TCHAR_TO_ANSI(*callee));
+  auto & mutRegistry = call_registry(mutant.s7session);
+  auto & mutCallee = mutRegistry.callees[calleeName];
+    // ^ !!! the map is node based, so a nested call adding callees keeps this valid
+  if (mutCallee.suspended) {
+    mutCallee.skipped++;
+    return AboaUeDataDict();
+  }
+  auto mutCallExpr = "(" + calleeName;
+  s7rootFrame mutRoots(mutant.s7session);
   for (auto & arg : args) {
     auto & key = arg.first;
     auto & ref = arg.second;
@@ -1524,18 +3069,39 @@ auto callAboaUeCode(
     auto argName = std::string("arg--") + TCHAR_TO_ANSI(*key);
     mutCallExpr += " " ;
     mutCallExpr += argName;
-    mutProtectStack.push(
-      s7_gc_protect(mutant.s7session,
-        s7_define_constant(mutant.s7session, argName.c_str(), s7value)));
+    mutRoots.root(
+      s7_define_constant(mutant.s7session, argName.c_str(), s7value));
   }
   mutCallExpr += ')';
-  auto result = makeAboaUeResult(mutant,
-    s7_eval_c_string(mutant.s7session, mutCallExpr.c_str()));
-  while (!mutProtectStack.empty()) {
-    s7_gc_unprotect_at(mutant.s7session, mutProtectStack.top());
-    mutProtectStack.pop();
+  auto const s7 = mutant.s7session;
+  if (!mutCallee.thunk || mutCallee.expr != mutCallExpr) {
+    if (mutCallee.thunk)
+      s7_gc_unprotect_at(s7, mutCallee.protectLoc);
+    mutCallee.thunk = s7_eval_c_string(s7, ("(> () " + mutCallExpr + ")").c_str());
+    mutCallee.protectLoc = s7_gc_protect(s7, mutCallee.thunk);
+    mutCallee.expr = mutCallExpr;
+  } // ^ read once, later calls only look up the callee and the args by name
+  auto const budget = call_budget_arm(s7, options.stepBudget);
+  auto const result = mutRoots.root(s7_call_with_catch(
+    s7, s7_t(s7), mutCallee.thunk, mutRegistry.errorHandler));
+  auto const outerStepsLeft = call_budget_lift(s7, budget);
+  auto mutReturn = AboaUeDataDict();
+  if (result != mutRegistry.lastError) {
+    mutCallee.errors = 0;
+    mutReturn = makeAboaUeResult(mutant, result);
+  } else {
+    mutRegistry.lastError = nullptr;
+    if (options.errorLimit > 0 && ++mutCallee.errors >= options.errorLimit) {
+      mutCallee.suspended = true;
+      UE_LOG(LogAlkScheme, Error,
+        TEXT("Suspending %s after %d errors in a row until its script reloads, the last %s"),
+        *callee, mutCallee.errors, *call_error_message(s7, result))
+    } else
+      UE_LOG(LogAlkScheme, Error,
+        TEXT("%s %s"), *callee, *call_error_message(s7, result))
   }
-  return result;
+  s7_set_step_budget(s7, outerStepsLeft);
+  return mutReturn;
 }
 
 auto runAboaUeCode(
@@ -1544,8 +3110,10 @@ auto runAboaUeCode(
   FString         const & callee,
   AboaUeDataDict  const & args
 ) -> AboaUeDataDict {
-  auto s7obj = s7_eval_c_string(
-    mutant.s7session, TCHAR_TO_ANSI(*code.source));
+  auto s7obj = code.forms
+    ? evalAboaUeCodeForms(mutant, code)
+    : s7_load_c_string(
+        mutant.s7session, code.source->c_str(), code.source->size());
   return callee.IsEmpty()
     ? makeAboaUeResult(mutant, s7obj)
     : callAboaUeCode(mutant, callee, args);
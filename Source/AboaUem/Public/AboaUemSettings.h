@@ -0,0 +1,69 @@
+// Copyright © 2025 Christopher Augustus
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+
+#include "AboaUemSettings.generated.h"
+
+UCLASS(config=Engine, defaultconfig, meta=(DisplayName="AboaUE"))
+class ABOAUEM_API UAboaUemSettings : public UDeveloperSettings
+{
+  GENERATED_BODY()
+
+public:
+  // garbage collection of the s7 heap, in cells,
+  // overridable per platform in Config/<Platform>/<Platform>Engine.ini
+  UPROPERTY(config, EditAnywhere, Category = GarbageCollection, meta=(ClampMin=0))
+    int32 GcSweepBudgetMicroseconds = 500;
+      // ^ incremental sweep per frame, 0 sweeps one slice; the mark that
+      //   starts each cycle is not bounded by this and runs whole in one frame
+  UPROPERTY(config, EditAnywhere, Category = GarbageCollection, meta=(ClampMin=0, ClampMax=1))
+    float GcCollectFreeFraction = 0.25f;
+      // ^ collect after the world tick when less of the heap is free
+  UPROPERTY(config, EditAnywhere, Category = GarbageCollection, meta=(ClampMin=1))
+    float GcDeferHeapGrowth = 2.0f;
+      // ^ during Aboa callbacks grow the heap instead of collecting, up to this
+      //   multiple of its size at the frame's first callback, 1 never defers
+  UPROPERTY(config, EditAnywhere, Category = Heap, meta=(ClampMin=1024))
+    int64 HeapInitialSize = 64000;
+      // ^ cells allocated at boot, also the floor when shrinking
+  UPROPERTY(config, EditAnywhere, Category = Heap, meta=(ClampMin=0))
+    float HeapGrowthFactor = 0.0f;
+      // ^ multiplies the heap when it grows, 0 keeps the s7 doubling
+  UPROPERTY(config, EditAnywhere, Category = Heap, meta=(ClampMin=0))
+    int64 HeapMaxSize = 0;
+      // ^ cells, 0 is unlimited
+  UPROPERTY(config, EditAnywhere, Category = Heap)
+    bool bHeapShrinkAfterLevelLoad = true;
+      // ^ release the heap blocks that emptied out when a map finishes loading
+  UPROPERTY(config, EditAnywhere, Category = Heap)
+    bool bReleaseEmptySlabsAfterGc = true;
+      // ^ return the slabs of strings, vectors and tables that a collection
+      //   emptied out to FMemory
+  UPROPERTY(config, EditAnywhere, Category = Errors, meta=(ClampMin=0))
+    int32 CallErrorLimit = 10;
+      // ^ errors in a row after which a callee is skipped until its
+      //   script reloads, 0 keeps calling it
+  UPROPERTY(config, EditAnywhere, Category = Errors, meta=(ClampMin=0))
+    int64 CallStepBudget = 0;
+      // ^ eval steps a call may take before it raises budget-exceeded,
+      //   which counts as one of its errors, 0 is unlimited; it also
+      //   bounds each input handler, event subscriber, timer callback
+      //   and task continuation the frame dispatches
+  UPROPERTY(config, EditAnywhere, Category = Boot)
+    bool bCacheCodeForms = true;
+      // ^ keep the forms of each script as read in Saved/AboaUE/Cache,
+      //   with the line each error in them reports, so loading unchanged
+      //   code decodes them instead of parsing, older revisions are pruned
+  UPROPERTY(config, EditAnywhere, Category = Boot)
+    bool bBootFromImage = false;
+      // ^ save the rootlet and hooks boot.aboa leaves to Saved/AboaUE/boot.image
+      //   and restore them on later starts instead of evaluating boot.aboa,
+      //   pays off when boot.aboa computes data rather than only defining
+};
@@ -12,6 +12,7 @@
 #define S7_MINOR_VERSION 6
 
 #include <stdint.h>           /* for int64_t */
+#include <stddef.h>           /* [c4augustus] for size_t */
 
 typedef int64_t s7_int;
 typedef double s7_double;
@@ -50,6 +51,7 @@ typedef struct s7_scheme s7_scheme;
 typedef struct s7_cell *s7_pointer;
 
 s7_scheme *s7_init(void);
+s7_scheme *s7_init_with_heap_size(s7_int initial_heap_size);         /* [c4augustus] s7_init uses INITIAL_HEAP_SIZE cells */
   /* s7_scheme is our interpreter
    * s7_pointer is a Scheme object of any (Scheme) type
    * s7_init creates the interpreter.
@@ -104,6 +106,31 @@ void s7_autoload_set_names(s7_scheme *sc, const char **names, s7_int size);
    *     s7_load_with_environment(s7, "somelib.so", s7_inlet(s7, s7_list(s7, 2, s7_make_symbol(s7, "init_func"), s7_make_symbol(s7, "somelib_init"))))
    *   s7_load_with_environment returns NULL if it can't load the file.
    */
+
+s7_pointer s7_load_c_string_record(s7_scheme *sc, const char *content, s7_int bytes, s7_pointer *record); /* [c4augustus] */
+s7_pointer s7_load_c_string_replay(s7_scheme *sc, const char *content, s7_int bytes, s7_pointer record);  /* [c4augustus] */
+
+  /* s7_load_c_string_record loads content as s7_load_c_string does, and sets record to a list with an entry for
+   *   each top-level form read: (form line . position), line and position being where the reader stopped after it.
+   *   If the load stops early (an error say), record is #f.  s7_load_c_string_replay evaluates the forms in a record
+   *   with a loader port on the same content current, moved to each entry's line and position, so errors report
+   *   what the load reported, without reading content again.  A record can be imaged, see s7_image_write.
+   */
+
+s7_pointer s7_image_write(s7_scheme *sc, s7_pointer obj);           /* [c4augustus] byte-vector, #f if obj holds something that can't be imaged */
+s7_pointer s7_image_read(s7_scheme *sc, const uint8_t *image, s7_int size); /* [c4augustus] NULL if damaged or from another s7 build */
+s7_pointer s7_rootlet_values(s7_scheme *sc);                         /* [c4augustus] vector of each rootlet slot's value */
+s7_pointer s7_rootlet_image(s7_scheme *sc, s7_pointer before, s7_pointer effects); /* [c4augustus] byte-vector or #f */
+s7_pointer s7_load_rootlet_image(s7_scheme *sc, const uint8_t *image, s7_int size); /* [c4augustus] effects, NULL if refused */
+
+  /* an image is a binary copy of an object graph: shared structure and cycles survive, closures are re-made
+   *   from their source in their (imaged) environment, c-functions and syntax are looked up by name.
+   *   s7_rootlet_image images the rootlet bindings made or changed since s7_rootlet_values returned before,
+   *   along with effects, any imageable object the caller wants back.  s7_load_rootlet_image defines those
+   *   bindings again and returns effects; nothing is evaluated, so a session restores the state a startup file
+   *   left without running it.  State outside the rootlet (C side registrations say) is the caller's to keep
+   *   in effects and redo.  An image that would rebind an immutable name is refused before anything is defined.
+   */
 void s7_quit(s7_scheme *sc);
   /* this tries to break out of the current evaluation, leaving everything else intact */
 
@@ -113,6 +140,18 @@ void s7_set_begin_hook(s7_scheme *sc, void (*hook)(s7_scheme *sc, bool *val));
    *   s7_begin_hook returns the current begin_hook function or NULL.
    */
 
+s7_int s7_set_step_budget(s7_scheme *sc, s7_int steps);              /* [c4augustus] returns the steps left of the previous budget */
+s7_int s7_step_budget(s7_scheme *sc);                                 /* [c4augustus] steps left, 0 when there is no budget */
+  /* once the evaluator has taken steps more steps it raises budget-exceeded, an error like any other that catch
+   *   and s7_call_with_catch intercept; steps 0 cancels the budget.  A step is one form the eval loop evaluates or
+   *   one pass of a loop that the tail-call and do optimizations run in C; a counted do loop whose end is fixed when
+   *   it starts is charged for all its passes up front.  Once spent the budget stays spent, each later step raises
+   *   budget-exceeded again, so a catch in the budgeted code cannot carry on; a C function handler of
+   *   s7_call_with_catch runs unbudgeted, and the budget stays spent after that until s7_set_step_budget.
+   *   The dynamic-wind exit thunks the error unwinds through each get the whole budget again, an error in one or
+   *   its return spends it again.
+   */
+
 s7_pointer s7_eval(s7_scheme *sc, s7_pointer code, s7_pointer e);    /* (eval code e) -- e is the optional environment */
 s7_pointer s7_eval_with_location(s7_scheme *sc, s7_pointer code, s7_pointer e, const char *caller, const char *file, s7_int line);
 void s7_provide(s7_scheme *sc, const char *feature);                 /* add feature (as a symbol) to the *features* list */
@@ -154,6 +193,58 @@ bool s7_history_enabled(s7_scheme *sc);
 bool s7_set_history_enabled(s7_scheme *sc, bool enabled);
 
 s7_pointer s7_gc_on(s7_scheme *sc, bool on);                         /* (gc on) */
+bool s7_gc_sweep_step(s7_scheme *sc, s7_int budget_us);              /* [c4augustus] stepped sweep after a whole mark, returns true when a cycle completes */
+
+  /* s7_gc_sweep_step runs part of a collection within roughly budget_us microseconds.  Once the free heap drops below
+   *   GC_SWEEP_START_FRACTION it marks everything at once, then each call sweeps another slice of the heap until the
+   *   cycle completes.  If the heap runs out first, the next allocation finishes the sweep itself.  Call it between
+   *   evaluations (once per frame, say), never from inside a c-function.
+   * Only the sweep is spread out.  The mark has no write barriers to let it stop part way, so the call that starts
+   *   a cycle takes as long as marking everything live, whatever budget_us is, and that frame still spikes in
+   *   proportion to the live heap.
+   */
+
+bool s7_gc_maybe_collect(s7_scheme *sc, s7_double threshold);        /* [c4augustus] collect now if less than threshold of the heap is free */
+s7_int s7_gc_defer(s7_scheme *sc, s7_int heap_limit);                /* [c4augustus] returns the previous heap_limit */
+
+  /* s7_gc_maybe_collect runs a full collection (finishing any s7_gc_sweep_step cycle) when the free fraction of the heap
+   *   is below threshold, and returns true if it did.  Like s7_gc_sweep_step, call it between evaluations.
+   * s7_gc_defer makes the allocator grow the heap instead of collecting while the heap is smaller than heap_limit
+   *   cells; 0 turns it off.  Save the old limit it returns and restore it when the latency-critical code is done.
+   */
+
+void s7_set_heap_growth_factor(s7_scheme *sc, s7_double factor);     /* [c4augustus] 0 = s7's own 2x or 4x */
+void s7_set_heap_resize_hook(s7_scheme *sc, void (*hook)(s7_scheme *sc, s7_int old_size, s7_int new_size, s7_double seconds)); /* [c4augustus] */
+s7_int s7_gc_shrink_heap(s7_scheme *sc, s7_int min_size);            /* [c4augustus] returns the new heap size */
+
+  /* heap sizes are in cells.  The resize hook is called after every heap growth or shrink with the time it took; it runs
+   *   inside the allocator, so it must not call back into s7.  s7_gc_shrink_heap collects, then frees the most recently
+   *   added heap blocks while nothing in them survived and the heap stays at least min_size.  Cells never move, so
+   *   shrinking is best-effort: call it where most of the heap has just become garbage (after a level change, say).
+   */
+
+typedef struct {
+  void *(*alloc)(void *data, size_t bytes, size_t alignment);             /* NULL if it fails */
+  void (*free)(void *data, void *ptr, size_t bytes);
+  void *data;
+} s7_allocator_t;                                                     /* [c4augustus] */
+
+typedef struct {
+  s7_int chunk_bytes, slabs, chunks, free_chunks;
+} s7_slab_stats_t;                                                    /* [c4augustus] */
+
+void s7_set_allocator(s7_scheme *sc, const s7_allocator_t *allocator); /* [c4augustus] sc NULL sets the default for s7_init */
+s7_int s7_slab_stats(s7_scheme *sc, s7_slab_stats_t *stats, s7_int max_classes); /* [c4augustus] returns the classes filled */
+s7_int s7_gc_release_slabs(s7_scheme *sc);                           /* [c4augustus] returns the bytes released */
+
+  /* strings, vectors, hash tables, ports and the like keep their contents outside the cell heap in blocks of 8 to 64K
+   *   bytes, one free list per power of two.  Those blocks are carved from slabs, one size class per slab, that the
+   *   allocator supplies aligned to their own size (64K, or 16 blocks for the larger classes).  A NULL allocator means
+   *   malloc.  Each slab remembers the allocator that made it, so switching only affects slabs made afterward; set the
+   *   default before s7_init to cover everything the session allocates.  The stats count carved chunks and the ones on
+   *   the free lists.  s7_gc_release_slabs hands slabs whose chunks are all free back to their allocator; call it after
+   *   a collection, between evaluations.  Blocks over 64K are malloc'd and freed one by one as before.
+   */
 
 s7_int s7_gc_protect(s7_scheme *sc, s7_pointer x);
 void s7_gc_unprotect_at(s7_scheme *sc, s7_int loc);
@@ -181,6 +272,16 @@ s7_pointer s7_gc_unprotect_via_location(s7_scheme *sc, s7_int loc);
    *                s7_cons(s7, s7_make_integer(s7, 123), s7_nil(s7)));
    */
 
+s7_int s7_gc_push_root_frame(s7_scheme *sc);                        /* [c4augustus] returns the frame to pop */
+s7_pointer s7_gc_root(s7_scheme *sc, s7_pointer x);                  /* [c4augustus] returns x */
+void s7_gc_pop_root_frame(s7_scheme *sc, s7_int frame);              /* [c4augustus] */
+
+  /* root frames are a cheaper s7_gc_protect for C locals with a lexical lifetime.  Push a frame, pass each
+   *   local through s7_gc_root, and pop the frame on the way out; everything rooted since the push is released
+   *   at once.  Frames must nest (pop in reverse order of push), which a C++ scope guard gives for free.
+   *   The roots are a plain stack, so rooting is an append and the GC marks only what is live on it.
+   */
+
 bool s7_is_eq(s7_pointer a, s7_pointer b);                                   /* (eq? a b) */
 bool s7_is_eqv(s7_scheme *sc, s7_pointer a, s7_pointer b);                   /* (eqv? a b) */
 bool s7_is_equal(s7_scheme *sc, s7_pointer a, s7_pointer b);                 /* (equal? a b) */
@@ -605,6 +706,7 @@ s7_pointer s7_apply_function_star(s7_scheme *sc, s7_pointer fnc, s7_pointer args
 s7_pointer s7_call(s7_scheme *sc, s7_pointer func, s7_pointer args);
 s7_pointer s7_call_with_location(s7_scheme *sc, s7_pointer func, s7_pointer args, const char *caller, const char *file, s7_int line);
 s7_pointer s7_call_with_catch(s7_scheme *sc, s7_pointer tag, s7_pointer body, s7_pointer error_handler);
+s7_pointer s7_apply_with_catch(s7_scheme *sc, s7_pointer tag, s7_pointer body, s7_pointer args, s7_pointer error_handler); /* [c4augustus] */
 
   /* s7_call takes a Scheme function and applies it to 'args' (a list of arguments) returning the result.
    *   s7_pointer kar;
@@ -617,6 +719,7 @@ s7_pointer s7_call_with_catch(s7_scheme *sc, s7_pointer tag, s7_pointer body, s7
    *   s7_apply_function does not -- it assumes the catch has been set up already.
    * s7_call_with_catch wraps an explicit catch around a function call ("body" above);
    *   s7_call_with_catch(sc, tag, body, err) is equivalent to (catch tag body err).
+   *   s7_apply_with_catch is the same with body applied to args, (catch tag (lambda () (apply body args)) err).
    */
 
 bool s7_is_dilambda(s7_pointer obj);
@@ -17,12 +17,28 @@ typedef void * AboaUeDataAny;
 #endif
 
 #include <map>
+#include <memory>
+#include <string>
 
 struct s7_scheme;
 
+struct AboaUeCodeForms {
+  FString const cachePath;
+    // ^ Saved/AboaUE/Cache/<CityHash64 of the path>-<of the source>.forms
+  FString const staleFiles;
+    // ^ the wildcard for every revision of this path, pruned on a save
+  TArray<uint8> image;
+    // ^ the s7 image of the forms as read, each with the line and position
+    //   a load reports for it, empty until loaded or first run
+};
+
 struct AboaUeCode {
   FString const path;
-  FString const source;
+  std::shared_ptr<std::string const> const source;
+    // ^ the UTF-8 bytes as read, handed to the s7 reader without conversion,
+    //   shared so caching the code does not copy the text
+  std::shared_ptr<AboaUeCodeForms> const forms;
+    // ^ null unless loaded with a cache directory
 };
 
 enum struct AboaUeDataType {
@@ -55,16 +71,91 @@ struct AboaUeMutant {
     // because struct s7_scheme is incomplete in s7.h
 };
 
-auto bootAboaUe() -> AboaUeMutant;
+struct AboaUeHeapPolicy {
+  int64 const initialSize;
+    // ^ cells, s7 raises this to at least 1024
+  float const growthFactor;
+    // ^ 0 keeps the s7 doubling
+  int64 const maxSize;
+    // ^ cells, 0 is unlimited
+};
+
+typedef void (*AboaUeCompiledDefine)(s7_scheme *);
+
+struct ABOAUEM_API AboaUeCompiledModule {
+  AboaUeCompiledModule(
+    char const *         const name,
+    AboaUeCompiledDefine const define);
+};
+  // ^ the C++ that Source/aboa/aot.aboa generates holds a static one,
+  //   so bootAboaUe defines its functions before evaluating boot.aboa
+
+auto bootAboaUe(
+  AboaUeHeapPolicy const & heapPolicy,
+  FString          const & codeCacheDir = "",
+  FString          const & bootImagePath = "") -> AboaUeMutant;
+  // ^ with an image path, restores the session an earlier boot of the same
+  //   boot.aboa saved there, else boots from source and saves the image
+
+auto releaseAboaUeSlabs(
+  AboaUeMutant const & mutant) -> void;
+  // ^ call after a collection to return the emptied s7 slabs to FMemory,
+  //   logs each size class's occupancy when it released any
+
+auto shutdownAboaUe(
+  AboaUeMutant const & mutant) -> void;
+  // ^ releases native bindings before the session is freed
+
+auto dispatchAboaUeInput(
+  AboaUeMutant const & mutant,
+  int64        const   stepBudget = 0) -> void;
+  // ^ call once per frame to deliver the queued input events; each
+  //   handler, subscriber, callback and task below runs under a catch
+  //   and a stepBudget like that of AboaUeCallOptions, logging what it raised
+
+auto dispatchAboaUeEvents(
+  AboaUeMutant const & mutant,
+  int64        const   stepBudget = 0) -> void;
+  // ^ call once per frame to deliver the events posted with ue-event-post
+
+auto dispatchAboaUeTimers(
+  AboaUeMutant const & mutant,
+  float        const   deltaSeconds,
+  int64        const   stepBudget = 0) -> void;
+  // ^ call once per frame to fire the ue-after and ue-every callbacks
+  //   that came due, in one batch
+
+auto dispatchAboaUeTasks(
+  AboaUeMutant const & mutant,
+  float        const   deltaSeconds,
+  int64        const   stepBudget = 0) -> void;
+  // ^ call once per frame to resume the tasks whose waits are over
 
 auto loadAboaUeCode(
-  FString const &path) -> AboaUeCode;
+  FString const &path,
+  FString const &cacheDir = "") -> AboaUeCode;
+  // ^ with a cache directory, runs decode the forms saved there for the
+  //   same source instead of reading it, and save them when missing
+
+struct AboaUeCallOptions {
+  int32 const errorLimit = 0;
+    // ^ errors in a row that suspend the callee, 0 never suspends
+  int64 const stepBudget = 0;
+    // ^ eval steps after which the call raises budget-exceeded, 0 is unlimited;
+    //   a catch in the script cannot carry on past it, every later step raises again
+};
 
 auto callAboaUeCode(
-  AboaUeMutant    const & mutant,
-  FString         const & callee = "",
-  AboaUeDataDict  const & args = AboaUeDataDict()
+  AboaUeMutant      const & mutant,
+  FString           const & callee = "",
+  AboaUeDataDict    const & args = AboaUeDataDict(),
+  AboaUeCallOptions const & options = AboaUeCallOptions()
 ) -> AboaUeDataDict;
+  // ^ logs an error the callee raises and returns an empty dictionary
+
+auto resetAboaUeCallErrors(
+  AboaUeMutant const & mutant) -> void;
+  // ^ call after reloading a script to resume the suspended callees
 
 auto runAboaUeCode(
   AboaUeMutant    const & mutant,